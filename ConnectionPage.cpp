@@ -36,6 +36,10 @@ ConnectionPage::ConnectionPage(UIManager* ui, TFT_eSPI* tft)
 void ConnectionPage::build() {
     Serial.println("Building ConnectionPage...");
     
+    // Label startet mit "Disconnected" → nächstes update() gleicht ab (auch nach unload())
+    isConnected = false;
+    isPaired = false;
+    
     int16_t contentX = layout.contentX;
     int16_t contentY = layout.contentY;
     int16_t contentW = layout.contentWidth;
@@ -45,13 +49,13 @@ void ConnectionPage::build() {
     int16_t valueX = contentX + labelWidth + 10;
     int16_t valueWidth = contentW - labelWidth - 20;
     
-    UILabel* labelStatus = new UILabel(contentX + 10, yPos, labelWidth, 30, "Status:");
+    UILabel* labelStatus = arena.create<UILabel>(contentX + 10, yPos, labelWidth, 30, "Status:");
     labelStatus->setAlignment(TextAlignment::LEFT);
     labelStatus->setFontSize(2);
     labelStatus->setTransparent(true);
     addContentElement(labelStatus);
     
-    labelStatusValue = new UILabel(valueX, yPos, valueWidth, 30, "Disconnected");
+    labelStatusValue = arena.create<UILabel>(valueX, yPos, valueWidth, 30, "Disconnected");
     labelStatusValue->setAlignment(TextAlignment::LEFT);
     labelStatusValue->setFontSize(2);
     labelStatusValue->setTextColor(COLOR_RED);
@@ -60,13 +64,13 @@ void ConnectionPage::build() {
     
     yPos += 40;
     
-    UILabel* labelOwnMac = new UILabel(contentX + 10, yPos, labelWidth, 25, "Own MAC:");
+    UILabel* labelOwnMac = arena.create<UILabel>(contentX + 10, yPos, labelWidth, 25, "Own MAC:");
     labelOwnMac->setAlignment(TextAlignment::LEFT);
     labelOwnMac->setFontSize(1);
     labelOwnMac->setTransparent(true);
     addContentElement(labelOwnMac);
     
-    labelOwnMacValue = new UILabel(valueX, yPos, valueWidth, 25, "00:00:00:00:00:00");
+    labelOwnMacValue = arena.create<UILabel>(valueX, yPos, valueWidth, 25, "00:00:00:00:00:00");
     labelOwnMacValue->setAlignment(TextAlignment::LEFT);
     labelOwnMacValue->setFontSize(1);
     labelOwnMacValue->setTextColor(COLOR_CYAN);
@@ -75,13 +79,13 @@ void ConnectionPage::build() {
     
     yPos += 30;
     
-    UILabel* labelPeerMac = new UILabel(contentX + 10, yPos, labelWidth, 25, "Peer MAC:");
+    UILabel* labelPeerMac = arena.create<UILabel>(contentX + 10, yPos, labelWidth, 25, "Peer MAC:");
     labelPeerMac->setAlignment(TextAlignment::LEFT);
     labelPeerMac->setFontSize(1);
     labelPeerMac->setTransparent(true);
     addContentElement(labelPeerMac);
     
-    labelPeerMacValue = new UILabel(valueX, yPos, valueWidth, 25, peerMacStr);
+    labelPeerMacValue = arena.create<UILabel>(valueX, yPos, valueWidth, 25, peerMacStr);
     labelPeerMacValue->setAlignment(TextAlignment::LEFT);
     labelPeerMacValue->setFontSize(1);
     labelPeerMacValue->setTextColor(COLOR_YELLOW);
@@ -95,7 +99,7 @@ void ConnectionPage::build() {
     int16_t btnSpacing = 10;
     int16_t btnX = contentX + 10;
     
-    btnPair = new UIButton(btnX, yPos, btnWidth, btnHeight, "PAIR");
+    btnPair = arena.create<UIButton>(btnX, yPos, btnWidth, btnHeight, "PAIR");
     btnPair->setFontSize(1);
     btnPair->on(EventType::CLICK, [this](EventData* data) {
         this->onPairClicked();
@@ -104,7 +108,7 @@ void ConnectionPage::build() {
     
     btnX += btnWidth + btnSpacing;
     
-    btnDisconnect = new UIButton(btnX, yPos, btnWidth, btnHeight, "DISCONNECT");
+    btnDisconnect = arena.create<UIButton>(btnX, yPos, btnWidth, btnHeight, "DISCONNECT");
     btnDisconnect->on(EventType::CLICK, [this](EventData* data) {
         btnDisconnect->setFontSize(1);
         this->onDisconnectClicked();
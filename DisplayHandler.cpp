@@ -8,9 +8,20 @@
 #include "include/UserConfig.h"
 #include <stdarg.h>
 
+// ST7796 Scroll-Befehle
+static const uint8_t CMD_NORON    = 0x13;   // Normal Display Mode (beendet Scroll-Modus)
+static const uint8_t CMD_VSCRDEF  = 0x33;   // Vertical Scrolling Definition
+static const uint8_t CMD_VSCRSADD = 0x37;   // Vertical Scrolling Start Address
+
 DisplayHandler::DisplayHandler() 
     : initialized(false)
     , currentBrightness(128)
+    , scrollAxis(ScrollAxis::VERTICAL)
+    , scrollReversed(false)
+    , scrollStart(0)
+    , scrollLength(0)
+    , scrollOffset(0)
+    , scrollSteps(0)
 {
 }
 
@@ -20,12 +31,7 @@ DisplayHandler::~DisplayHandler() {
 bool DisplayHandler::begin(UserConfig* config) {
     DEBUG_PRINTLN("DisplayHandler: Initialisiere Display...");
     
-    // ═══════════════════════════════════════════════════════════════
-    // KRITISCH: Touch CS auf HIGH (inaktiv!)
-    // ═══════════════════════════════════════════════════════════════
-    disableTouch();
-    digitalWrite(TOUCH_CS, HIGH);  // Touch inaktiv
-    delay(100);
+    // Touch CS ist bereits inaktiv (SpiBusArbiter::begin() vor Display-Init)
     
     // ═══════════════════════════════════════════════════════════════
     // Backlight initialisieren und einschalten
@@ -47,6 +53,10 @@ bool DisplayHandler::begin(UserConfig* config) {
     // WICHTIG: Rotation 3 = Landscape richtig rum
     tft.setRotation(DISPLAY_ROTATION);
     
+    // Gate-Achse des Panels: im Querformat die X-Achse, ab Rotation 2 gespiegelt
+    scrollAxis = (DISPLAY_ROTATION & 1) ? ScrollAxis::HORIZONTAL : ScrollAxis::VERTICAL;
+    scrollReversed = DISPLAY_ROTATION >= 2;
+    
     // Display löschen
     tft.fillScreen(TFT_BLACK);
     
@@ -58,13 +68,6 @@ bool DisplayHandler::begin(UserConfig* config) {
     return true;
 }
 
-void DisplayHandler::disableTouch() {
-    DEBUG_PRINTLN("DisplayHandler: Deaktiviere Touch (CS auf HIGH)...");
-    pinMode(TOUCH_CS, OUTPUT);
-    //digitalWrite(TOUCH_CS, HIGH);  // Touch inaktiv
-    DEBUG_PRINTLN("DisplayHandler: ✅ Touch CS inaktiv");
-}
-
 void DisplayHandler::initBacklight(uint8_t brightness) {
     DEBUG_PRINTLN("DisplayHandler: Initialisiere Backlight...");
     
@@ -91,6 +94,10 @@ void DisplayHandler::setBacklight(uint8_t brightness) {
     ledcWrite(TFT_BL, currentBrightness);
 }
 
+void DisplayHandler::setBacklightLevel(uint8_t level) {
+    ledcWrite(TFT_BL, level);
+}
+
 void DisplayHandler::setBacklightOn(bool on) {
     if (on) {
         setBacklight(currentBrightness);
@@ -99,6 +106,87 @@ void DisplayHandler::setBacklightOn(bool on) {
     }
 }
 
+// ═══════════════════════════════════════════════════════════════
+// Hardware-Scrolling
+// ═══════════════════════════════════════════════════════════════
+
+int16_t DisplayHandler::getScrollAxisLength() {
+    return scrollAxis == ScrollAxis::HORIZONTAL ? tft.width() : tft.height();
+}
+
+bool DisplayHandler::setScrollArea(int16_t start, int16_t length) {
+    if (!initialized) return false;
+    
+    int16_t axisLength = getScrollAxisLength();
+    if (start < 0 || length <= 0 || start + length > axisLength) {
+        Serial.printf("DisplayHandler: ❌ Ungültiger Scroll-Bereich %d+%d (Achse %d)\n", start, length, axisLength);
+        return false;
+    }
+    
+    // Gespiegelt: Screen-Anfang liegt am Ende der Gate-Reihenfolge
+    uint16_t top = scrollReversed ? axisLength - start - length : start;
+    writeScrollArea(top, length, axisLength - top - length);
+    writeScrollStart(top);
+    
+    scrollStart = start;
+    scrollLength = length;
+    scrollOffset = 0;
+    return true;
+}
+
+void DisplayHandler::setScrollOffset(int16_t offset) {
+    if (!initialized || scrollLength == 0) return;
+    
+    offset %= scrollLength;
+    if (offset < 0) offset += scrollLength;
+    
+    int16_t axisLength = getScrollAxisLength();
+    uint16_t top = scrollReversed ? axisLength - scrollStart - scrollLength : scrollStart;
+    
+    // Gespiegelt läuft der Ringpuffer in Gate-Richtung rückwärts
+    uint16_t line = scrollReversed ? (scrollLength - offset) % scrollLength : offset;
+    writeScrollStart(top + line);
+    
+    scrollOffset = offset;
+    scrollSteps++;
+}
+
+int16_t DisplayHandler::mapScrollPosition(int16_t screenPos) const {
+    if (scrollLength == 0 || screenPos < scrollStart || screenPos >= scrollStart + scrollLength) {
+        return screenPos;
+    }
+    return scrollStart + (screenPos - scrollStart + scrollOffset) % scrollLength;
+}
+
+void DisplayHandler::resetScroll() {
+    if (!initialized) return;
+    
+    uint16_t axisLength = getScrollAxisLength();
+    writeScrollArea(0, axisLength, 0);
+    writeScrollStart(0);
+    tft.writecommand(CMD_NORON);
+    
+    scrollStart = 0;
+    scrollLength = 0;
+    scrollOffset = 0;
+}
+
+void DisplayHandler::writeScrollArea(uint16_t top, uint16_t length, uint16_t bottom) {
+    tft.writecommand(CMD_VSCRDEF);
+    tft.writedata(top >> 8);
+    tft.writedata(top & 0xFF);
+    tft.writedata(length >> 8);
+    tft.writedata(length & 0xFF);
+    tft.writedata(bottom >> 8);
+    tft.writedata(bottom & 0xFF);
+}
+
+void DisplayHandler::writeScrollStart(uint16_t line) {
+    tft.writecommand(CMD_VSCRSADD);
+    tft.writedata(line >> 8);
+    tft.writedata(line & 0xFF);
+}
+
 void DisplayHandler::drawText(const char* text, int16_t x, int16_t y, uint16_t color, uint8_t size) {
     if (!initialized) return;
     
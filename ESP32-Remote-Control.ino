@@ -24,6 +24,9 @@
 #include "include/userConf.h"
 #include "include/Globals.h"
 #include "include/SerialCommandHandler.h"
+#include "include/SpiBusArbiter.h"
+#include "include/UIFont.h"
+#include "include/ScreenCapture.h"
 
 // UIManager (für Widget-Verwaltung)
 UIManager* ui = nullptr;
@@ -92,8 +95,10 @@ void setup() {
     // ═══════════════════════════════════════════════════════════════
     Serial.println("→ GPIO...");
     
-    pinMode(TOUCH_CS, OUTPUT);
-    digitalWrite(TOUCH_CS, HIGH);
+    // HSPI-Arbiter: alle Chip-Selects inaktiv, bevor Display/Touch starten
+    if (!spiBus.begin()) {
+        Serial.println("  ⚠️ HSPI-Arbiter N/A - Display/Touch unkoordiniert");
+    }
     pinMode(TFT_BL, OUTPUT);
     
     Serial.println("  ✅ GPIO OK");
@@ -113,6 +118,12 @@ void setup() {
     display.setBacklight(userConfig.getBacklightDefault());
     display.setBacklightOn(true);
     
+    // Display-Bursts: eine SPI-Transaktion pro Burst statt pro Zeichenbefehl
+    spiBus.attach(&display.getTft().getSPIinstance());
+    spiBus.setBurstHooks(SpiDevice::DISPLAY,
+                         []() { display.getTft().startWrite(); },
+                         []() { display.getTft().endWrite(); });
+    
     Serial.println("  ✅ Display OK");
     logger.logBootStep("Display", true, "480x320 @ Rotation 3");
     
@@ -125,6 +136,8 @@ void setup() {
     if (touch.begin(hspi, &userConfig)) {
         Serial.println("  ✅ Touch OK");
         
+        touch.setBusArbiter(&spiBus);
+        
         touch.setCalibration(
             userConfig.getTouchMinX(),
             userConfig.getTouchMaxX(), 
@@ -134,6 +147,13 @@ void setup() {
         touch.setThreshold(userConfig.getTouchThreshold());
         touch.setRotation(userConfig.getTouchRotation());
         
+        // IRQ-getriebener Sampling-Task (Fallback: Polling in loop())
+        if (touch.startSampling()) {
+            Serial.println("  ✅ Touch Sampling-Task aktiv");
+        } else {
+            Serial.println("  ⚠️ Touch Sampling-Task N/A - Polling");
+        }
+        
         Serial.printf("  Calibration: X=%d-%d, Y=%d-%d, Threshold=%d, Rotation=%d\n",
                      userConfig.getTouchMinX(), userConfig.getTouchMaxX(),
                      userConfig.getTouchMinY(), userConfig.getTouchMaxY(),
@@ -251,13 +271,32 @@ void setup() {
     TFT_eSPI* tft = &display.getTft();
     ui = new UIManager(tft, &touch);
     Serial.println("  ✅ UIManager erstellt");
+#if UI_SPRITE_RENDER
+    if (!ui->setSpriteRendering(true)) {
+        Serial.println("  ⚠️ Sprite-Rendering nicht verfügbar, zeichne direkt");
+    }
+#endif
     logger.logBootStep("UIManager", true);
     
+    // ═══════════════════════════════════════════════════════════════
+    // Atlas-Font laden (optional, vor dem Aufbau der Pages)
+    // ═══════════════════════════════════════════════════════════════
+    if (sdAvailable && UI_FONT_FILE[0] != '\0' && sdCard.fileExists(UI_FONT_FILE)) {
+        Serial.println("→ Font...");
+        if (uiFont.loadFromSD(&sdCard, UI_FONT_FILE)) {
+            Serial.println("  ✅ Font OK");
+        } else {
+            Serial.println("  ⚠️ Font nicht geladen, eingebauter Font");
+        }
+    }
+    
     // ═══════════════════════════════════════════════════════════════
     // PageManager erstellen (mit UILayout) + Pages
     // ═══════════════════════════════════════════════════════════════
     Serial.println("→ PageManager...");
     pageManager = new PageManager(tft, ui);
+    pageManager->setBusArbiter(&spiBus);
+    pageManager->setDisplayHandler(&display);
     
     if (!pageManager->init(&battery, &powerMgr)) {
         Serial.println("  ❌ PageManager init failed!");
@@ -268,6 +307,9 @@ void setup() {
     Serial.println("  ✅ PageManager OK (Pages erstellt und registriert)");
     logger.logBootStep("PageManager", true, "UILayout + 5 Pages");
     
+    // Screenshot/Stream liest den Bildspeicher über den gemeinsamen HSPI-Bus
+    screenCapture.begin(tft, &spiBus);
+    
     // ═══════════════════════════════════════════════════════════════
     // Serial Command Handler
     // ═══════════════════════════════════════════════════════════════
@@ -342,7 +384,8 @@ void loop() {
     // Touch
     // ═══════════════════════════════════════════════════════════════
 
-    if (touch.isAvailable() && lastLoopStart - lastTouchUpdate >= 100) {
+    // Nur im Polling-Modus - der Sampling-Task liefert Events selbst
+    if (touch.isAvailable() && !touch.isSampling() && lastLoopStart - lastTouchUpdate >= 100) {
         touch.updateIfIRQ();
         lastTouchUpdate = lastLoopStart;
     }
@@ -422,5 +465,8 @@ void loop() {
         pageManager->draw();    // UI zeichnen (ruft ui->drawUpdates() auf)
     }
     
+    // Screen-Stream (nur wenn aktiv, begrenzt auf UI_SCREEN_BUDGET_US)
+    screenCapture.update();
+    
     delay(10);
 }
\ No newline at end of file
@@ -19,6 +19,9 @@
 #include "include/UserConfig.h"
 #include "include/PowerManager.h"
 #include "include/ESPNowRemoteController.h"
+#include "include/SpiBusArbiter.h"
+#include "include/UIFont.h"
+#include "include/ScreenCapture.h"
 
 // Globale Instanzen
 DisplayHandler display;
@@ -30,6 +33,9 @@ TouchManager touch;
 UserConfig userConfig;
 PowerManager powerMgr;
 ESPNowRemoteController espNow;
+SpiBusArbiter spiBus;
+UIFont uiFont("UI");
+ScreenCapture screenCapture;
 
 // PageManager als Pointer (wird in setup() erstellt)
 PageManager* pageManager = nullptr;
\ No newline at end of file
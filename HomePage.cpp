@@ -11,6 +11,7 @@
 #include "include/BatteryMonitor.h"
 #include "include/ESPNowRemoteController.h"
 #include "include/Globals.h"
+#include "include/UIFont.h"
 
 HomePage::HomePage(UIManager* ui, TFT_eSPI* tft) 
     : UIPage("Home", ui, tft) {
@@ -20,7 +21,7 @@ void HomePage::build() {
     Serial.println("Building HomePage...");
     
     // Willkommens-Text
-    UILabel* lblWelcome = new UILabel(
+    UILabel* lblWelcome = arena.create<UILabel>(
         layout.contentX + 20, 
         layout.contentY + 20, 
         layout.contentWidth - 40, 
@@ -28,12 +29,13 @@ void HomePage::build() {
         "ESP32 Remote Control"
     );
     lblWelcome->setFontSize(3);
+    if (uiFont.isLoaded()) lblWelcome->setFont(&uiFont);    // Statt pixelverdoppeltem Font 3
     lblWelcome->setAlignment(TextAlignment::CENTER);
     lblWelcome->setTransparent(true);
     addContentElement(lblWelcome);
     
     // Info-Text
-    UILabel* lblInfo = new UILabel(
+    UILabel* lblInfo = arena.create<UILabel>(
         layout.contentX + 20, 
         layout.contentY + 75, 
         layout.contentWidth - 40, 
@@ -49,7 +51,7 @@ void HomePage::build() {
     int16_t statusY = layout.contentY + 115;
     
     // Battery Status
-    UILabel* lblBattery = new UILabel(
+    UILabel* lblBattery = arena.create<UILabel>(
         layout.contentX + 20, 
         statusY, 
         200, 
@@ -63,7 +65,7 @@ void HomePage::build() {
     addContentElement(lblBattery);
     
     // Connection Status
-    UILabel* lblConnection = new UILabel(
+    UILabel* lblConnection = arena.create<UILabel>(
         layout.contentX + 240, 
         statusY, 
         200, 
@@ -85,7 +87,7 @@ void HomePage::build() {
     int16_t btnX2 = btnX1 + btnWidth + btnSpacing;
     
     // Remote Button
-    UIButton* btnRemote = new UIButton(btnX1, btnY, btnWidth, btnHeight, "Remote Control");
+    UIButton* btnRemote = arena.create<UIButton>(btnX1, btnY, btnWidth, btnHeight, "Remote Control");
     btnRemote->on(EventType::CLICK, [](EventData* data) {
         Serial.println("→ Remote Control");
         ::pageManager->showPageDeferred(PAGE_REMOTE);
@@ -93,7 +95,7 @@ void HomePage::build() {
     addContentElement(btnRemote);
     
     // Connection Button
-    UIButton* btnConnection = new UIButton(btnX2, btnY, btnWidth, btnHeight, "Connection");
+    UIButton* btnConnection = arena.create<UIButton>(btnX2, btnY, btnWidth, btnHeight, "Connection");
     btnConnection->on(EventType::CLICK, [](EventData* data) {
         Serial.println("→ Connection");
         ::pageManager->showPageDeferred(PAGE_CONNECTION);
@@ -103,7 +105,7 @@ void HomePage::build() {
     btnY += btnHeight + btnSpacing;
     
     // Settings Button
-    UIButton* btnSettings = new UIButton(btnX1, btnY, btnWidth, btnHeight, "Settings");
+    UIButton* btnSettings = arena.create<UIButton>(btnX1, btnY, btnWidth, btnHeight, "Settings");
     btnSettings->on(EventType::CLICK, [](EventData* data) {
         Serial.println("→ Settings");
         ::pageManager->showPageDeferred(PAGE_SETTINGS);
@@ -111,13 +113,16 @@ void HomePage::build() {
     addContentElement(btnSettings);
     
     // Info Button
-    UIButton* btnInfo = new UIButton(btnX2, btnY, btnWidth, btnHeight, "System Info");
+    UIButton* btnInfo = arena.create<UIButton>(btnX2, btnY, btnWidth, btnHeight, "System Info");
     btnInfo->on(EventType::CLICK, [](EventData* data) {
         Serial.println("→ System Info");
         ::pageManager->showPageDeferred(PAGE_INFO);
     });
     addContentElement(btnInfo);
     
+    // Status sofort anzeigen (nach unload() nicht erst beim nächsten Intervall)
+    updateStatus();
+    
     Serial.println("  ✅ HomePage build complete");
 }
 
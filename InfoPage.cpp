@@ -29,7 +29,7 @@ void InfoPage::build() {
     int16_t tbY = layout.contentY + 10;
     int16_t tbHeight = layout.contentHeight - 60;
     
-    txtInfo = new UITextBox(layout.contentX + 10, tbY, layout.contentWidth - 20, tbHeight);
+    txtInfo = arena.create<UITextBox>(layout.contentX + 10, tbY, layout.contentWidth - 20, tbHeight);
     txtInfo->setFontSize(1);
     txtInfo->setLineHeight(14);
     addContentElement(txtInfo);
@@ -37,7 +37,7 @@ void InfoPage::build() {
     updateInfo();
     
     int16_t buttonHeight = 40;
-    UIButton* btnRefresh = new UIButton(
+    UIButton* btnRefresh = arena.create<UIButton>(
         layout.contentX + (layout.contentWidth - 150) / 2,
         layout.contentY + layout.contentHeight - buttonHeight - 10, 
         150, buttonHeight, "Refresh"
@@ -11,6 +11,10 @@
 #include "include/SettingsPage.h"
 #include "include/InfoPage.h"
 #include "include/UserConfig.h"
+#include "include/UIFrameBuffer.h"
+#include "include/SDCardHandler.h"
+#include "include/DisplayHandler.h"
+#include <esp_heap_caps.h>
 
 // Externe Referenzen
 extern UserConfig userConfig;
@@ -28,8 +32,26 @@ PageManager::PageManager(TFT_eSPI* display, UIManager* uiMgr)
     , currentPageId(-1)
     , currentPageIndex(-1)
     , initialized(false)
+    , busArbiter(nullptr)
     , deferredPageId(-1)
+    , deferredSlide(0)
+    , displayHandler(nullptr)
+    , slideEnabled(UI_PAGE_SLIDE)
+    , pageCacheSize(UI_PAGE_CACHE_SIZE)
+    , useCounter(0)
+    , evictions(0)
+    , flushPending(false)
+    , flushLocked(false)
+    , flushStartUs(0)
+    , targetFps(0)
+    , frameIntervalUs(0)
+    , frameBudgetUs(UI_FRAME_BUDGET_US)
+    , nextFrameUs(0)
 {
+    setTargetFps(UI_TARGET_FPS);
+    resetFrameStats();
+    memset(&slide, 0, sizeof(slide));
+    memset(&slideStats, 0, sizeof(slideStats));
 }
 
 PageManager::~PageManager() {
@@ -62,6 +84,9 @@ bool PageManager::init(BatteryMonitor* battery, PowerManager* powerMgr) {
     // PageManager Referenz an Layout übergeben (für Zurück-Button)
     layout.setPageManager(this);
     
+    // Backlight-Fade vor dem Sleep läuft im Frame-Takt statt blockierend
+    powerMgr->setAnimator(ui->getAnimator());
+    
     initialized = true;
     
     Serial.println("PageManager: ✅ Initialisierung abgeschlossen!");
@@ -92,6 +117,15 @@ bool PageManager::init(BatteryMonitor* battery, PowerManager* powerMgr) {
     
     Serial.printf("  ✅ %d Pages registriert\n", getPageCount());
     
+    // ═══════════════════════════════════════════════════════════════
+    // Swipe-Navigation (Gesten die kein Widget konsumiert hat)
+    // ═══════════════════════════════════════════════════════════════
+    ui->setGestureHandler([this](EventType type, EventData* data) {
+        if (type == EventType::SWIPE) {
+            handleSwipe(static_cast<SwipeDirection>(data->value));
+        }
+    });
+    
     return true;
 }
 
@@ -107,6 +141,7 @@ bool PageManager::addPage(UIPage* page, int pageId) {
     PageEntry entry;
     entry.page = page;
     entry.pageId = pageId;
+    entry.lastUsed = 0;
     
     pages.push_back(entry);
     
@@ -131,6 +166,14 @@ bool PageManager::showPage(int pageId) {
         return false;
     }
     
+    // Seitenwechsel zeichnet Layout + Content → ein Display-Burst
+    // (Pages zeichnen teils direkt → laufenden Tile-Transfer erst abschließen)
+    completeFlush(true);
+    SpiBusGuard busGuard(busArbiter, SpiDevice::DISPLAY);
+    
+    // Laufender Slide: Scrolling zurücksetzen bevor direkt gezeichnet wird
+    finishSlide();
+    
     // Aktuelle Seite verstecken
     if (currentPageIndex != -1 && currentPageIndex < pages.size()) {
         pages[currentPageIndex].page->hide();
@@ -139,17 +182,22 @@ bool PageManager::showPage(int pageId) {
     // Neue Seite anzeigen
     currentPageIndex = index;
     currentPageId = pageId;
+    pages[currentPageIndex].lastUsed = ++useCounter;
     pages[currentPageIndex].page->show();
     
+    // Gebaut wird erst beim ersten Anzeigen → Cache-Grenze danach prüfen
+    evictPages();
+    
     Serial.printf("PageManager: Zeige Seite '%s' (ID=%d)\n", 
                  pages[currentPageIndex].page->getPageName(), pageId);
     
     return true;
 }
 
-void PageManager::showPageDeferred(int pageId) {
+void PageManager::showPageDeferred(int pageId, int8_t slide) {
     Serial.printf("PageManager: Verzögerter Wechsel zu Seite ID=%d\n", pageId);
     deferredPageId = pageId;
+    deferredSlide = slide;
 }
 
 bool PageManager::showPageByIndex(int index) {
@@ -160,6 +208,15 @@ bool PageManager::showPageByIndex(int index) {
     return showPage(pages[index].pageId);
 }
 
+bool PageManager::redrawScreen() {
+    if (!showPage(currentPageId)) return false;
+    
+    // Ein Damage über alles: Hintergründe (paintBackground) + alle Widgets,
+    // unabhängig von der Änderungserkennung im UILayout
+    ui->invalidate(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    return true;
+}
+
 void PageManager::nextPage() {
     if (pages.empty()) return;
     
@@ -176,6 +233,22 @@ void PageManager::previousPage() {
     showPageByIndex(prevIndex);
 }
 
+void PageManager::handleSwipe(SwipeDirection direction) {
+    if (pages.empty() || currentPageIndex < 0) return;
+    
+    // Nur horizontale Swipes wechseln die Seite
+    int step = 0;
+    if (direction == SwipeDirection::LEFT) step = 1;        // Finger nach links → nächste Seite
+    else if (direction == SwipeDirection::RIGHT) step = -1; // Finger nach rechts → vorherige Seite
+    if (step == 0) return;
+    
+    int index = (currentPageIndex + step + pages.size()) % pages.size();
+    
+    // Aufruf kommt aus ui->update() → verzögert wechseln
+    // Neue Seite läuft in Swipe-Richtung ein
+    showPageDeferred(pages[index].pageId, step);
+}
+
 UIPage* PageManager::getCurrentPage() {
     if (currentPageIndex >= 0 && currentPageIndex < pages.size()) {
         return pages[currentPageIndex].page;
@@ -204,17 +277,32 @@ void PageManager::update() {
     // KRITISCH: UI-Manager update für Touch-Handling!
     ui->update();
     
+    // Kein completeFlush() hier: der Tile-Transfer des letzten draw() läuft
+    // weiter, gewartet wird nur vor direktem Zeichnen (Seitenwechsel, drawsInUpdate())
+    
     // Deferred page change verarbeiten (NACH ui->update!)
+    // showPage()/startSlide() schließen den Transfer selbst ab und belegen den Bus
     if (deferredPageId != -1) {
         Serial.printf("  Verarbeite verzögerten Page-Wechsel zu ID=%d\n", deferredPageId);
-        showPage(deferredPageId);
+        if (deferredSlide == 0 || !startSlide(deferredPageId, deferredSlide)) {
+            showPage(deferredPageId);
+        }
         deferredPageId = -1;
+        deferredSlide = 0;
     }
     
-    // Page update
+    // Page update (nicht während des Slides: Pages zeichnen teils direkt,
+    // der Bildspeicher außerhalb des aufgedeckten Streifens zeigt noch die alte Page)
     UIPage* currentPage = getCurrentPage();
-    if (currentPage && currentPage->isVisible()) {
-        currentPage->update();
+    if (currentPage && currentPage->isVisible() && !slide.active) {
+        if (currentPage->drawsInUpdate()) {
+            completeFlush(true);
+            SpiBusGuard busGuard(busArbiter, SpiDevice::DISPLAY);
+            currentPage->update();
+        } else {
+            // Nur Setter → Damage, gezeichnet wird im nächsten draw()
+            currentPage->update();
+        }
     }
 }
 
@@ -222,10 +310,485 @@ void PageManager::draw() {
     if (!initialized | !ui) {
         return;
     }
+    
+    // Frame-Takt: zwischen zwei Frames sofort zurück
+    // (Input/Funk laufen in loop() weiter und warten nie auf einen Frame)
+    uint32_t startUs = micros();
+    if (frameIntervalUs > 0) {
+        if (nextFrameUs == 0) nextFrameUs = startUs;    // Takt startet mit erstem draw()
+        if ((int32_t)(startUs - nextFrameUs) < 0) return;
         
+        // Komplett übersprungene Frame-Slots zählen, Raster beibehalten
+        uint32_t late = startUs - nextFrameUs;
+        uint32_t missed = late / frameIntervalUs;
+        frameStats.missedFrames += missed;
+        nextFrameUs += (missed + 1) * frameIntervalUs;
+    }
+    
+    // Vorheriger Frame überträgt noch → loop() nicht blockieren
+    if (!completeFlush(false)) {
+        frameStats.busyPolls++;
+        if (frameIntervalUs > 0) frameStats.missedFrames++;
+        return;
+    }
+    
+    // Animationen auf den Frame-Zeitpunkt setzen (Widgets melden dabei ihr Damage)
+    // Erst nach dem Flush: onComplete-Callbacks dürfen direkt zeichnen (Sleep-Fade)
+    ui->getAnimator()->update(millis());
+    
+    // Page-Slide: pro Frame nur den neu aufgedeckten Streifen
+    if (slide.active) {
+        SpiBusGuard busGuard(busArbiter, SpiDevice::DISPLAY);
+        stepSlide();
+        return;
+    }
+    
+    uint32_t framesBefore = ui->getRenderStats().frames;
+    
     // UI-Manager zeichnet alle Widgets (Header/Footer/Content)
+    // als ein Display-Burst (eine SPI-Transaktion, ein Gerätewechsel)
+    // Kein SpiBusGuard: bei asynchronem Flush bleibt der Bus über draw() hinaus belegt
+    bool locked = busArbiter && busArbiter->isReady() && busArbiter->acquire(SpiDevice::DISPLAY);
+    uint32_t renderStartUs = micros();
+    ui->drawUpdates(frameBudgetUs);
+    bool rendered = ui->getRenderStats().frames != framesBefore;
+    
+    if (rendered) {
+        if (ui->getRenderStats().lastDeferred > 0) frameStats.deferredFrames++;
+        uint32_t blockUs = micros() - startUs;
+        frameStats.frames++;
+        frameStats.lastBlockUs = blockUs;
+        frameStats.totalBlockUs += blockUs;
+        if (blockUs > frameStats.maxBlockUs) frameStats.maxBlockUs = blockUs;
+    }
+    
+    if (ui->isFlushBusy()) {
+        // Fertigmeldung (und Flush-Dauer) wird beim nächsten draw() abgeholt
+        flushPending = true;
+        flushLocked = locked;
+        flushStartUs = renderStartUs;
+        return;
+    }
+    
+    // Synchron übertragen: Transfer ist mit drawUpdates() fertig
+    if (rendered) frameStats.lastFlushUs = micros() - renderStartUs;
+    
+    if (locked) busArbiter->release(SpiDevice::DISPLAY);
+}
+
+void PageManager::setTargetFps(uint8_t fps) {
+    targetFps = fps;
+    frameIntervalUs = fps > 0 ? 1000000UL / fps : 0;
+    nextFrameUs = 0;
+}
+
+bool PageManager::completeFlush(bool wait) {
+    if (!flushPending) return true;
+    
+    if (!wait && ui->isFlushBusy()) return false;
+    
+    ui->waitFlush();
+    frameStats.lastFlushUs = micros() - flushStartUs;
+    flushPending = false;
+    
+    if (flushLocked) {
+        busArbiter->release(SpiDevice::DISPLAY);
+        flushLocked = false;
+    }
+    return true;
+}
+
+void PageManager::resetFrameStats() {
+    memset(&frameStats, 0, sizeof(frameStats));
+}
+
+void PageManager::printFrameStats() {
+    const char* mode = "Direkt";
+    if (ui && ui->isSpriteRendering()) {
+        if (!ui->isTileDMA()) mode = "Sprite, blockierend";
+        else mode = ui->isAsyncFlush() ? "Sprite + DMA, asynchron" : "Sprite + DMA, synchron";
+    }
+    
+    Serial.println("\n=== Frame-Statistik (PageManager::draw) ===");
+    Serial.printf("Modus:           %s\n", mode);
+    if (targetFps > 0) {
+        Serial.printf("Ziel-FPS:        %d (%lu us/Frame), Budget %lu us\n",
+                      targetFps, frameIntervalUs, frameBudgetUs);
+    } else {
+        Serial.printf("Ziel-FPS:        ungebremst, Budget %lu us\n", frameBudgetUs);
+    }
+    Serial.printf("Frames:          %lu\n", frameStats.frames);
+    Serial.printf("Verpasst:        %lu Frame-Slots\n", frameStats.missedFrames);
+    Serial.printf("Budget erschöpft: %lu x (Rest-Damage im nächsten Frame)\n", frameStats.deferredFrames);
+    Serial.printf("Loop blockiert:  letzter %lu us, max %lu us, Ø %lu us\n",
+                  frameStats.lastBlockUs, frameStats.maxBlockUs,
+                  frameStats.frames > 0 ? (unsigned long)(frameStats.totalBlockUs / frameStats.frames) : 0UL);
+    Serial.printf("Flush:           %lu us (Start bis letzter Transfer fertig)\n", frameStats.lastFlushUs);
+    Serial.printf("Transfer lief:   %lu x (draw() ohne Warten zurück)\n", frameStats.busyPolls);
+    Serial.printf("Ausstehend:      %s\n", flushPending ? "JA" : "nein");
+    Serial.println("===========================================\n");
+}
+
+// ═══════════════════════════════════════════════════════════════
+// PAGE-SLIDE (Hardware-Scrolling)
+// ═══════════════════════════════════════════════════════════════
+
+void PageManager::setPageSlide(bool enable) {
+    if (!enable) finishSlide();
+    slideEnabled = enable;
+}
+
+bool PageManager::startSlide(int pageId, int8_t direction) {
+    if (!slideEnabled || !displayHandler || ui->isRedirected()) return false;
+    
+    completeFlush(true);
+    SpiBusGuard busGuard(busArbiter, SpiDevice::DISPLAY);
+    finishSlide();
+    
+    int16_t axisLength = displayHandler->getScrollAxisLength();
+    if (!displayHandler->setScrollArea(0, axisLength)) return false;
+    
+    // Bis zum ersten Streifen darf nichts in den Bildspeicher:
+    // show() zeichnet Hintergründe direkt (leerer Viewport), Damage verwirft das leere Fenster
+    ui->setDrawWindow(0, 0, 0, 0);
+    tft->setViewport(0, 0, 0, 0, false);
+    bool shown = showPage(pageId);
+    tft->resetViewport();
+    
+    if (!shown) {
+        ui->clearDrawWindow();
+        displayHandler->resetScroll();
+        return false;
+    }
+    
+    slide.active = true;
+    slide.direction = direction > 0 ? 1 : -1;
+    slide.axisLength = axisLength;
+    slide.exposed = 0;
+    slide.progress = 0.0f;
+    slide.startMs = millis();
+    slide.steps = 0;
+    slide.pixels = 0;
+    
+    // Fortschritt über die Zeit (gleiche Dauer bei jeder Framerate)
+    slide.tween = ui->getAnimator()->animate(UI_PAGE_SLIDE_MS, Easing::EASE_OUT,
+                                             [this](float t) { slide.progress = t; });
+    if (slide.tween == 0) slide.progress = 1.0f;     // Pool voll → in einem Schritt
+    
+    return true;
+}
+
+void PageManager::stepSlide() {
+    int16_t target = slide.progress >= 1.0f ? slide.axisLength : (int16_t)(slide.progress * slide.axisLength);
+    if (target <= slide.exposed) return;
+    
+    int16_t x, y, w, h;
+    
+    // Neu aufgedeckter Streifen: neue Page an ihrer endgültigen Position
+    getSlideRect(slide.exposed, target, &x, &y, &w, &h);
+    ui->invalidate(x, y, w, h);
+    
+    // Fenster: alles Aufgedeckte (Updates der neuen Page dort sind erlaubt)
+    getSlideRect(0, target, &x, &y, &w, &h);
+    ui->setDrawWindow(x, y, w, h);
+    
+    // Ohne Budget: der Streifen muss komplett sein bevor er sichtbar wird
     ui->drawUpdates();
+    ui->waitFlush();
+    slide.pixels += ui->getRenderStats().lastPixels;
+    slide.exposed = target;
+    slide.steps++;
+    
+    if (target >= slide.axisLength) {
+        finishSlide();
+        return;
+    }
+    
+    // Screen-Position p zeigt Bildspeicher (p + offset) % Länge
+    displayHandler->setScrollOffset(slide.direction > 0 ? target : slide.axisLength - target);
+}
+
+void PageManager::finishSlide() {
+    if (!slide.active) return;
+    slide.active = false;
+    
+    if (slide.tween != 0) {
+        ui->getAnimator()->cancel(slide.tween);
+        slide.tween = 0;
+    }
     
+    // Abgebrochen: ohne Offset zeigt der Rest noch die alte Page → neu zeichnen
+    bool aborted = slide.exposed < slide.axisLength;
+    if (aborted) {
+        int16_t x, y, w, h;
+        getSlideRect(slide.exposed, slide.axisLength, &x, &y, &w, &h);
+        ui->invalidate(x, y, w, h);
+        slideStats.aborted++;
+    }
+    
+    ui->clearDrawWindow();
+    displayHandler->resetScroll();
+    
+    slideStats.slides++;
+    slideStats.lastMs = millis() - slide.startMs;
+    slideStats.lastSteps = slide.steps;
+    slideStats.lastPixels = slide.pixels;
+}
+
+void PageManager::getSlideRect(int16_t from, int16_t to, int16_t* x, int16_t* y, int16_t* w, int16_t* h) {
+    // Von rechts/unten einlaufend wird die Page vom Anfang her aufgedeckt, sonst vom Ende
+    int16_t start = slide.direction > 0 ? from : slide.axisLength - to;
+    int16_t length = to - from;
+    
+    if (displayHandler->getScrollAxis() == ScrollAxis::HORIZONTAL) {
+        *x = start;
+        *y = 0;
+        *w = length;
+        *h = tft->height();
+    } else {
+        *x = 0;
+        *y = start;
+        *w = tft->width();
+        *h = length;
+    }
+}
+
+void PageManager::printSlideStats() {
+    Serial.println("\n=== Page-Slide (Hardware-Scrolling) ===");
+    if (!displayHandler) {
+        Serial.println("⚠️ Kein DisplayHandler gesetzt - Seiten wechseln sofort");
+        Serial.println("=======================================\n");
+        return;
+    }
+    
+    bool horizontal = displayHandler->getScrollAxis() == ScrollAxis::HORIZONTAL;
+    uint32_t screenPixels = (uint32_t)tft->width() * tft->height();
+    
+    Serial.printf("Status:          %s (%d ms, Swipe-Navigation)\n", slideEnabled ? "AN" : "AUS", UI_PAGE_SLIDE_MS);
+    Serial.printf("Scroll-Achse:    %s, %d px\n", horizontal ? "horizontal" : "vertikal",
+                  displayHandler->getScrollAxisLength());
+    Serial.printf("Slides:          %lu (%lu abgebrochen)\n", slideStats.slides, slideStats.aborted);
+    Serial.printf("Scroll-Befehle:  %lu (VSCRSADD)\n", displayHandler->getScrollSteps());
+    
+    if (slideStats.slides > 0) {
+        // Software-Slide: jeder Schritt zeichnet den ganzen Screen verschoben neu
+        uint32_t softwarePixels = screenPixels * slideStats.lastSteps;
+        Serial.printf("Letzter Slide:   %lu ms, %u Schritte, %lu Pixel gepusht\n",
+                      slideStats.lastMs, slideStats.lastSteps, slideStats.lastPixels);
+        Serial.printf("Software-Slide:  %lu Pixel (Vollbild pro Schritt) → %.1fx\n", softwarePixels,
+                      slideStats.lastPixels > 0 ? (float)softwarePixels / slideStats.lastPixels : 0.0f);
+    }
+    Serial.println("=======================================\n");
+}
+
+void PageManager::setPageCacheSize(uint8_t size) {
+    pageCacheSize = size;
+    
+    // Page-Wechsel zeichnet nicht, entladen braucht keinen Bus
+    evictPages();
+}
+
+bool PageManager::unloadPage(int pageId) {
+    int index = findPageIndex(pageId);
+    if (index == -1 || index == currentPageIndex) return false;
+    
+    if (pages[index].page->isBuilt()) evictions++;
+    return pages[index].page->unload();
+}
+
+void PageManager::evictPages() {
+    if (pageCacheSize == 0) return;
+    
+    while (true) {
+        int built = 0;
+        int oldest = -1;
+        
+        for (size_t i = 0; i < pages.size(); i++) {
+            if (!pages[i].page->isBuilt()) continue;
+            built++;
+            
+            // Aktuelle Page nie entladen
+            if ((int)i == currentPageIndex) continue;
+            if (oldest == -1 || pages[i].lastUsed < pages[oldest].lastUsed) oldest = i;
+        }
+        
+        if (built <= pageCacheSize || oldest == -1) return;
+        
+        Serial.printf("PageManager: Page-Cache voll (%d/%d) → entlade '%s'\n",
+                      built, pageCacheSize, pages[oldest].page->getPageName());
+        pages[oldest].page->unload();
+        evictions++;
+    }
+}
+
+void PageManager::printPageStats() {
+    Serial.println("\n=== Pages ===");
+    Serial.printf("Cache: %d Pages (%s), %lu entladen seit Start\n",
+                  pageCacheSize, pageCacheSize == 0 ? "unbegrenzt" : "LRU", evictions);
+    
+    for (size_t i = 0; i < pages.size(); i++) {
+        UIPage* page = pages[i].page;
+        const UIArena& arena = page->getArena();
+        
+        Serial.printf("  [%d] %-16s %-9s %2dx gebaut, Aufbau %6lu us (Layout %4lu us), Abbau %6lu us, Arena %5u Byte%s\n",
+                      pages[i].pageId, page->getPageName(),
+                      (int)i == currentPageIndex ? "AKTIV" : (page->isBuilt() ? "gebaut" : "entladen"),
+                      page->getBuildCount(), page->getLastBuildUs(), page->getLastLayoutUs(), page->getLastUnloadUs(),
+                      (unsigned)arena.getCapacity(), arena.isPsram() ? " (PSRAM)" : "");
+    }
+    Serial.printf("Flex-Layout: %lu measure, %lu arrange, %lu aus dem Cache\n",
+                  (unsigned long)UIFlexBox::getMeasureCount(), (unsigned long)UIFlexBox::getArrangeCount(),
+                  (unsigned long)UIFlexBox::getCacheHits());
+    Serial.println("=============\n");
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Offscreen-Rendering (Benchmark, Golden-Images)
+// ═══════════════════════════════════════════════════════════════
+
+uint32_t PageManager::renderOffscreen(UIFrameBuffer* frameBuffer) {
+    // Ganzer Screen: Hintergrund + alle Widgets (Retained-Widgets komplett)
+    frameBuffer->resetStats();
+    uint32_t startUs = micros();
+    ui->invalidate(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    ui->drawUpdates();
+    return micros() - startUs;
+}
+
+void PageManager::benchmarkRender(uint16_t frames) {
+    if (!initialized || pages.empty()) {
+        Serial.println("PageManager: ❌ Keine Pages");
+        return;
+    }
+    
+    UIFrameBuffer frameBuffer(tft);
+    if (!frameBuffer.begin()) {
+        Serial.println("PageManager: ❌ Framebuffer nicht verfügbar (PSRAM?)");
+        return;
+    }
+    
+    int startPageId = currentPageId;
+    
+    Serial.printf("\n=== Render-Benchmark (Vollbild + %u Update-Frames pro Page) ===\n", frames);
+    
+    for (size_t i = 0; i < pages.size(); i++) {
+        // Seitenwechsel normal auf dem Display, gemessen wird nur offscreen
+        showPage(pages[i].pageId);
+        UIPage* page = pages[i].page;
+        ui->redirect(&frameBuffer);
+        
+        uint32_t fullUs = renderOffscreen(&frameBuffer);
+        UIDrawStats fullStats = frameBuffer.getStats();
+        
+        // Update-Frames im Frame-Takt (periodische Page-Updates laufen mit, ui fps 0 = ungebremst)
+        frameBuffer.resetStats();
+        uint32_t updateUs = 0;
+        for (uint16_t frame = 0; frame < frames; frame++) {
+            uint32_t slotUs = micros();
+            page->update();
+            
+            uint32_t drawStartUs = micros();
+            ui->drawUpdates();
+            updateUs += micros() - drawStartUs;
+            
+            while (micros() - slotUs < frameIntervalUs) delay(1);
+        }
+        UIDrawStats updateStats = frameBuffer.getStats();
+        
+        ui->redirect(nullptr);
+        
+        Serial.printf("[%d] %s: Vollbild %lu us, Update %lu us/Frame\n",
+                      pages[i].pageId, page->getPageName(), fullUs, frames > 0 ? updateUs / frames : 0);
+        UIFrameBuffer::printStats("Vollbild", fullStats);
+        if (frames > 0) UIFrameBuffer::printStats("Update", updateStats, frames);
+    }
+    
+    Serial.println("================================================================\n");
+    showPage(startPageId);
+}
+
+int PageManager::runGoldenTest(SDCardHandler* sd, bool save) {
+    if (!initialized || pages.empty()) {
+        Serial.println("PageManager: ❌ Keine Pages");
+        return -1;
+    }
+    if (!sd || !sd->isAvailable()) {
+        Serial.println("PageManager: ❌ SD-Karte nicht verfügbar");
+        return -1;
+    }
+    
+    UIFrameBuffer frameBuffer(tft);
+    if (!frameBuffer.begin()) {
+        Serial.println("PageManager: ❌ Framebuffer nicht verfügbar (PSRAM?)");
+        return -1;
+    }
+    
+    size_t imageBytes = frameBuffer.getByteSize();
+    uint16_t* reference = nullptr;
+    
+    if (save) {
+        if (!sd->fileExists(UI_GOLDEN_DIR)) sd->createDir(UI_GOLDEN_DIR);
+    } else {
+        reference = static_cast<uint16_t*>(heap_caps_malloc(imageBytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+        if (!reference) {
+            Serial.println("PageManager: ❌ Kein Speicher für Referenzbild");
+            return -1;
+        }
+    }
+    
+    int startPageId = currentPageId;
+    int failures = 0;
+    
+    Serial.printf("\n=== Golden-Images (%s, %s) ===\n", save ? "speichern" : "vergleichen", UI_GOLDEN_DIR);
+    
+    for (size_t i = 0; i < pages.size(); i++) {
+        int pageId = pages[i].pageId;
+        const char* pageName = pages[i].page->getPageName();
+        
+        showPage(pageId);
+        ui->redirect(&frameBuffer);
+        renderOffscreen(&frameBuffer);
+        ui->redirect(nullptr);
+        
+        char path[48];
+        snprintf(path, sizeof(path), "%s/page_%d.raw", UI_GOLDEN_DIR, pageId);
+        uint32_t crc = frameBuffer.checksum();
+        
+        if (save) {
+            bool ok = sd->writeBinaryFile(path, reinterpret_cast<const uint8_t*>(frameBuffer.getPixels()), imageBytes);
+            Serial.printf("  %s [%d] %-16s %s (CRC %08lX)\n", ok ? "✅" : "❌", pageId, pageName, path, crc);
+            if (!ok) failures++;
+            continue;
+        }
+        
+        int bytes = sd->readBinaryFile(path, reinterpret_cast<uint8_t*>(reference), imageBytes);
+        if (bytes != (int)imageBytes) {
+            Serial.printf("  ⚠️ [%d] %-16s kein Referenzbild (%s)\n", pageId, pageName, path);
+            failures++;
+            continue;
+        }
+        
+        int16_t dx, dy, dw, dh;
+        uint32_t mismatches = frameBuffer.compare(reference, &dx, &dy, &dw, &dh);
+        if (mismatches == 0) {
+            Serial.printf("  ✅ [%d] %-16s identisch (CRC %08lX)\n", pageId, pageName, crc);
+        } else {
+            Serial.printf("  ❌ [%d] %-16s %lu Pixel abweichend in x=%d y=%d %dx%d\n",
+                          pageId, pageName, mismatches, dx, dy, dw, dh);
+            failures++;
+        }
+    }
+    
+    if (reference) free(reference);
+    showPage(startPageId);
+    
+    if (save) {
+        Serial.printf("%d von %d Referenzbildern geschrieben\n", (int)pages.size() - failures, (int)pages.size());
+    } else {
+        Serial.printf("%d von %d Pages identisch\n", (int)pages.size() - failures, (int)pages.size());
+    }
+    Serial.println("=================================\n");
+    return failures;
 }
 
 int PageManager::findPageIndex(int pageId) {
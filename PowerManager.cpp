@@ -5,6 +5,9 @@
  */
 
 #include "include/PowerManager.h"
+#include "include/SpiBusArbiter.h"
+#include "include/PageManager.h"
+#include "include/Globals.h"
 
 PowerManager::PowerManager()
     : battery(nullptr)
@@ -15,6 +18,10 @@ PowerManager::PowerManager()
     , autoSleepTimer(0)
     , fadeTimeMs(1000)
     , beforeSleepCallback(nullptr)
+    , animator(nullptr)
+    , sleepPending(false)
+    , pendingWakeSource(WakeSource::TOUCH)
+    , pendingTimerSeconds(0)
     , criticalWarningShown(false)
     , criticalWarningStart(0)
 {
@@ -51,6 +58,9 @@ void PowerManager::sleep(WakeSource wakeSource, uint32_t timerSeconds) {
         return;
     }
     
+    // Fade-Out läuft bereits
+    if (sleepPending) return;
+    
     DEBUG_PRINTLN("\n╔════════════════════════════════════════╗");
     DEBUG_PRINTLN("║       ENTERING SLEEP MODE              ║");
     DEBUG_PRINTLN("╚════════════════════════════════════════╝");
@@ -63,10 +73,31 @@ void PowerManager::sleep(WakeSource wakeSource, uint32_t timerSeconds) {
     
     // Backlight ausblenden
     if (display && fadeTimeMs > 0) {
+        if (animator) {
+            // Im Frame-Takt ausblenden, Deep-Sleep wenn fertig
+            DEBUG_PRINTLN("PowerManager: Fade-Out Backlight (nicht blockierend)...");
+            pendingWakeSource = wakeSource;
+            pendingTimerSeconds = timerSeconds;
+            
+            TweenId fade = animator->animateValue(display->getBacklight(), 0, fadeTimeMs, Easing::EASE_IN,
+                [this](int32_t level) { display->setBacklightLevel(level); },
+                nullptr,
+                [this]() { enterSleep(pendingWakeSource, pendingTimerSeconds); });
+            
+            if (fade != 0) {
+                sleepPending = true;
+                return;
+            }
+        }
+        
         DEBUG_PRINTLN("PowerManager: Fade-Out Backlight...");
         fadeBacklight();
     }
     
+    enterSleep(wakeSource, timerSeconds);
+}
+
+void PowerManager::enterSleep(WakeSource wakeSource, uint32_t timerSeconds) {
     // Peripherie herunterfahren
     DEBUG_PRINTLN("PowerManager: Shutdown Peripherals...");
     shutdownPeripherals();
@@ -155,7 +186,7 @@ String PowerManager::getWakeupReason() {
 }
 
 void PowerManager::update() {
-    if (!initialized || !autoSleepEnabled || !battery) {
+    if (!initialized || !autoSleepEnabled || !battery || sleepPending) {
         return;
     }
     
@@ -192,8 +223,14 @@ void PowerManager::shutdownPeripherals() {
     // Display komplett löschen (schwarz) vor Sleep
     if (display) {
         DEBUG_PRINTLN("  Display löschen...");
-        TFT_eSPI& tft = display->getTft();
-        tft.fillScreen(TFT_BLACK);  // Komplett schwarz
+        
+        // Laufenden Tile-Transfer abschließen, Touch-Task vom Bus fernhalten
+        if (pageManager) pageManager->waitFlush();
+        {
+            SpiBusGuard busGuard(&spiBus, SpiDevice::DISPLAY);
+            TFT_eSPI& tft = display->getTft();
+            tft.fillScreen(TFT_BLACK);  // Komplett schwarz
+        }
         delay(50);  // Kurz warten bis geschrieben
         
         display->setBacklightOn(false);
@@ -205,14 +242,14 @@ void PowerManager::shutdownPeripherals() {
 void PowerManager::fadeBacklight() {
     if (!display) return;
     
-    uint8_t brightness = 255;  // Aktuell (angenommen)
+    uint8_t brightness = display->getBacklight();
     uint32_t startTime = millis();
     
     while (millis() - startTime < fadeTimeMs) {
         float progress = (float)(millis() - startTime) / (float)fadeTimeMs;
-        uint8_t newBrightness = 255 * (1.0 - progress);
+        uint8_t newBrightness = brightness * (1.0 - progress);
         
-        display->setBacklight(newBrightness);
+        display->setBacklightLevel(newBrightness);
         delay(10);
     }
     
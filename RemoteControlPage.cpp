@@ -16,6 +16,10 @@ RemoteControlPage::RemoteControlPage(UIManager* ui, TFT_eSPI* tft)
     : UIPage("Remote Control", ui, tft)
     , joystickX(0)
     , joystickY(0)
+    , lastJoyX(0)
+    , lastJoyY(0)
+    , wasConnected(false)
+    , joystickView(nullptr)
     , labelConnectionStatus(nullptr)
     , labelJoystickX(nullptr)
     , labelJoystickY(nullptr)
@@ -28,60 +32,88 @@ RemoteControlPage::RemoteControlPage(UIManager* ui, TFT_eSPI* tft)
 void RemoteControlPage::build() {
     Serial.println("Building RemoteControlPage...");
     
+    // Widgets starten bei 0 / DISCONNECTED (auch nach unload())
+    lastJoyX = 0;
+    lastJoyY = 0;
+    wasConnected = false;
+    
+    // Layout: links Status + Battery, rechts Joystick mit Werten darunter
+    // ┌────────────────────────────┬──────────┐
+    // │ Status                     │          │
+    // │                            │ Joystick │
+    // │ Remote Battery:            │          │
+    // │ [=====Bar=====]  [0.0V]    │ [Y] [X]  │
+    // └────────────────────────────┴──────────┘
+    UIFlexBox* root = arena.create<UIFlexBox>(FlexDirection::ROW, 10, 10);
+    UIFlexBox* left = arena.create<UIFlexBox>(FlexDirection::COLUMN);
+    UIFlexBox* right = arena.create<UIFlexBox>(FlexDirection::COLUMN, 10);
+    UIFlexBox* batteryRow = arena.create<UIFlexBox>(FlexDirection::ROW, 10);
+    UIFlexBox* joyValuesRow = arena.create<UIFlexBox>(FlexDirection::ROW, 10);
+    
+    root->add(left).grow = 1;
+    root->add(right, JOYSTICK_AREA_SIZE);
+    right->setJustify(FlexJustify::END);
+    left->setAlign(FlexAlign::START);
+    
     // Status-Bar
-    int16_t statusY = layout.contentY + 5;
-    labelConnectionStatus = new UILabel(layout.contentX + 10, statusY, 150, 25, "DISCONNECTED");
+    labelConnectionStatus = arena.create<UILabel>(0, 0, 0, 0, "DISCONNECTED");
     labelConnectionStatus->setAlignment(TextAlignment::LEFT);
     labelConnectionStatus->setFontSize(1);
     labelConnectionStatus->setTextColor(COLOR_RED);
     labelConnectionStatus->setTransparent(true);
     addContentElement(labelConnectionStatus);
+    left->add(labelConnectionStatus, 150, 25);     // Feste Breite: Text wechselt
     
-    // Joystick-Bereich
-    int16_t joyStartY = layout.contentY + 40;
-    joystickAreaSize = 180;
-    joystickAreaX = layout.contentX + 280;
-    joystickAreaY = joyStartY;
-    joystickCenterX = joystickAreaX + joystickAreaSize / 2;
-    joystickCenterY = joystickAreaY + joystickAreaSize / 2;
+    // Joystick-Bereich (Retained-Widget: zeichnet nur den bewegten Knopf)
+    joystickView = arena.create<UIJoystickView>(0, 0, JOYSTICK_AREA_SIZE);
+    addContentElement(joystickView);
+    right->add(joystickView);
     
-    int16_t joyValuesY = joystickAreaY + joystickAreaSize + 10;
+    labelJoystickY = arena.create<UILabel>(0, 0, 0, 0, "Y: 0");
+    labelJoystickY->setAlignment(TextAlignment::LEFT);
+    labelJoystickY->setFontSize(1);
+    labelJoystickY->setTransparent(false);
+    addContentElement(labelJoystickY);
     
-    labelJoystickX = new UILabel(joystickAreaX + (joystickAreaSize / 2), joyValuesY, joystickAreaSize / 2 - 5, 20, "X: 0");
+    labelJoystickX = arena.create<UILabel>(0, 0, 0, 0, "X: 0");
     labelJoystickX->setAlignment(TextAlignment::LEFT);
     labelJoystickX->setFontSize(1);
     labelJoystickX->setTransparent(false);
     addContentElement(labelJoystickX);
     
-    labelJoystickY = new UILabel(joystickAreaX, joyValuesY, joystickAreaSize / 2 - 5, 25, "Y: 0");
-    labelJoystickY->setAlignment(TextAlignment::LEFT);
-    labelJoystickY->setFontSize(1);
-    labelJoystickY->setTransparent(false);
-    addContentElement(labelJoystickY);
+    right->add(joyValuesRow, LAYOUT_AUTO, 25);
+    joyValuesRow->add(labelJoystickY).grow = 1;
+    joyValuesRow->add(labelJoystickX).grow = 1;
+    
+    // Battery-Anzeige (unten links)
+    left->addSpacer();
     
-    // Battery-Anzeige
-    int16_t batteryY = layout.contentY + layout.contentHeight - 60;
-    UILabel* labelRemoteBattery = new UILabel(layout.contentX + 10, batteryY, 150, 25, "Remote Battery:");
+    UILabel* labelRemoteBattery = arena.create<UILabel>(0, 0, 0, 0, "Remote Battery:");
     labelRemoteBattery->setAlignment(TextAlignment::LEFT);
     labelRemoteBattery->setFontSize(1);
     labelRemoteBattery->setTransparent(true);
     addContentElement(labelRemoteBattery);
+    left->add(labelRemoteBattery, 150, 25);
     
-    batteryY += 25;
-    int16_t batteryWidth = (layout.contentWidth - 20) / 2;
-    
-    barRemoteBattery = new UIProgressBar(layout.contentX + 10, batteryY, batteryWidth - 80, 25);
+    barRemoteBattery = arena.create<UIProgressBar>(0, 0, 0, 0);
     barRemoteBattery->setValue(0);
     barRemoteBattery->setBarColor(COLOR_RED);
     barRemoteBattery->setShowText(false);
     addContentElement(barRemoteBattery);
     
-    labelRemoteBatteryValue = new UILabel(layout.contentX + 10 + batteryWidth - 70, batteryY, 70, 25, "0.0V");
+    labelRemoteBatteryValue = arena.create<UILabel>(0, 0, 0, 0, "0.0V");
     labelRemoteBatteryValue->setAlignment(TextAlignment::CENTER);
     labelRemoteBatteryValue->setFontSize(1);
     labelRemoteBatteryValue->setTransparent(true);
     addContentElement(labelRemoteBatteryValue);
     
+    left->add(batteryRow, LAYOUT_AUTO, 25);
+    batteryRow->add(barRemoteBattery, 150, 25);
+    batteryRow->add(labelRemoteBatteryValue, 70, 25);
+    
+    // Bounds löst UIPage nach build() auf (und bei geändertem Content-Bereich)
+    setContentLayout(root);
+    
     Serial.println("  ✅ RemoteControlPage build complete");
 }
 
@@ -93,7 +125,6 @@ void RemoteControlPage::update() {
     }
     
     // Connection Status
-    static bool wasConnected = false;
     bool isConnected = espNow.isInitialized() && espNow.isConnected();
     
     if (isConnected != wasConnected) {
@@ -107,12 +138,12 @@ void RemoteControlPage::update() {
         wasConnected = isConnected;
     }
     
-    // Joystick
-    static int16_t lastJoyX = 0, lastJoyY = 0;
-    //if (joystickX != lastJoyX || joystickY != lastJoyY) {
-
-        drawJoystickPosition();
-                    
+    // Joystick (nur bei Änderung - Widget zeichnet dann nur den Knopf neu)
+    if (joystickX != lastJoyX || joystickY != lastJoyY) {
+        if (joystickView) {
+            joystickView->setValue(joystickX, joystickY);
+        }
+        
         lastJoyX = joystickX;
         lastJoyY = joystickY;
         
@@ -121,33 +152,10 @@ void RemoteControlPage::update() {
         labelJoystickX->setText(buffer);
         sprintf(buffer, "Y: %d", joystickY);
         labelJoystickY->setText(buffer);
-    //}
+    }
 }
 
 void RemoteControlPage::setJoystickPosition(int16_t x, int16_t y) {
     joystickX = constrain(x, -100, 100);
     joystickY = constrain(y, -100, 100);
 }
-
-void RemoteControlPage::drawJoystickPosition() {
-    
-    if (!tft) {
-        Serial.println("    ERROR: tft ist nullptr!");
-        return;
-    }
-
-    tft->fillRect(joystickAreaX, joystickAreaY, joystickAreaSize + 5, joystickAreaSize + 5, COLOR_BLACK);
-
-    int16_t radius = joystickAreaSize / 2 - 8;
-    tft->drawCircle(joystickCenterX, joystickCenterY, radius, COLOR_WHITE);
-    tft->drawCircle(joystickCenterX, joystickCenterY, radius + 1, COLOR_WHITE);
-    tft->drawLine(joystickCenterX - 20, joystickCenterY, joystickCenterX + 20, joystickCenterY, COLOR_GRAY);
-    tft->drawLine(joystickCenterX, joystickCenterY - 20, joystickCenterX, joystickCenterY + 20, COLOR_GRAY);
-
-    int16_t posX = joystickCenterX + (joystickX * radius) / 100;
-    int16_t posY = joystickCenterY - (joystickY * radius) / 100;
-    
-    tft->fillCircle(posX, posY, 8, COLOR_DARKGRAY);
-    tft->fillCircle(posX, posY, 8, COLOR_BLUE);
-    tft->fillCircle(posX - 0, posY - 0, 3, COLOR_CYAN);
-}
\ No newline at end of file
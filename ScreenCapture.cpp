@@ -0,0 +1,296 @@
+/**
+ * ScreenCapture.cpp
+ */
+
+#include "include/ScreenCapture.h"
+#include "include/SpiBusArbiter.h"
+#include "include/PageManager.h"
+#include "include/Globals.h"
+#include <esp_rom_crc.h>
+
+static const char BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+ScreenCapture::ScreenCapture()
+    : tft(nullptr), arbiter(nullptr), lineLength(0), lineSent(0),
+      streaming(false), intervalMs(UI_SCREEN_INTERVAL_MS),
+      frameActive(false), frameFull(false), forceFull(true), cursor(0),
+      frameNumber(0), frameStartMs(0), frameTiles(0), frameBytes(0) {
+    memset(tileCrc, 0, sizeof(tileCrc));
+    memset(&stats, 0, sizeof(stats));
+}
+
+ScreenCapture::~ScreenCapture() {
+}
+
+void ScreenCapture::begin(TFT_eSPI* tft, SpiBusArbiter* arbiter) {
+    this->tft = tft;
+    this->arbiter = arbiter;
+    forceFull = true;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Einzelbild + Streaming
+// ═══════════════════════════════════════════════════════════════
+
+bool ScreenCapture::captureFrame() {
+    if (!tft) return false;
+
+    if (streaming) {
+        // Kein zweiter Frame zwischen den Stream-Zeilen → nächster Stream-Frame komplett
+        forceFull = true;
+        Serial.println("ScreenCapture: Nächster Stream-Frame wird ein Vollbild");
+        return true;
+    }
+
+    if (pageManager) pageManager->waitFlush();
+    if (!canRead()) {
+        Serial.println("ScreenCapture: ⚠️ Page-Slide läuft, bitte erneut versuchen");
+        return false;
+    }
+
+    beginFrame(true);
+    flushLine(true);
+
+    for (uint16_t i = 0; i < TILE_COUNT; i++) {
+        if (prepareTile(i, true)) flushLine(true);
+    }
+
+    endFrame();
+    flushLine(true);
+    return true;
+}
+
+void ScreenCapture::startStream(uint16_t interval) {
+    intervalMs = interval;
+    streaming = true;
+    forceFull = true;
+    frameActive = false;
+    frameStartMs = millis() - intervalMs;   // Erster Frame sofort
+
+    Serial.printf("ScreenCapture: ✅ Stream gestartet (Frame alle >= %u ms, %u us pro loop())\n",
+                  intervalMs, (unsigned)UI_SCREEN_BUDGET_US);
+}
+
+void ScreenCapture::stopStream() {
+    if (!streaming) return;
+
+    // Angefangene Zeile abschließen, sonst verwirft der Host die nächste Ausgabe
+    flushLine(true);
+    streaming = false;
+    frameActive = false;
+
+    Serial.println("\nScreenCapture: Stream gestoppt");
+}
+
+void ScreenCapture::update() {
+    if (!streaming || !tft) return;
+
+    // Ausstehende Zeile zuerst (nur so viel wie der TX-Puffer aufnimmt)
+    if (!flushLine(false)) {
+        stats.busyPolls++;
+        return;
+    }
+
+    if (!frameActive) {
+        if (millis() - frameStartMs < intervalMs) return;
+        if (!canRead()) {
+            stats.busyPolls++;
+            return;
+        }
+
+        // Keyframe: verlorene Zeilen (z.B. Log-Ausgabe dazwischen) werden spätestens hier ersetzt
+        bool full = forceFull || (UI_SCREEN_KEYFRAME > 0 && frameNumber % UI_SCREEN_KEYFRAME == 0);
+        beginFrame(full);
+        if (!flushLine(false)) return;
+    }
+
+    uint32_t startUs = micros();
+    while (cursor < TILE_COUNT) {
+        // Tile-Transfer / Slide seit dem letzten Aufruf → später weiter
+        if (!canRead()) {
+            stats.busyPolls++;
+            return;
+        }
+
+        bool ready = prepareTile(cursor, frameFull);
+        cursor++;
+        if (ready && !flushLine(false)) return;
+        if (micros() - startUs >= UI_SCREEN_BUDGET_US) return;
+    }
+
+    endFrame();
+    flushLine(false);
+}
+
+bool ScreenCapture::canRead() const {
+    if (!pageManager) return true;
+    return !pageManager->isFlushPending() && !pageManager->isSliding();
+}
+
+void ScreenCapture::beginFrame(bool full) {
+    frameActive = true;
+    frameFull = full;
+    forceFull = false;
+    cursor = 0;
+    frameStartMs = millis();
+    frameTiles = 0;
+    frameBytes = 0;
+
+    lineLength = snprintf(line, sizeof(line), "\nSCR F %lu %d %d %d %d\n",
+                          (unsigned long)frameNumber, DISPLAY_WIDTH, DISPLAY_HEIGHT, TILE, full ? 1 : 0);
+    lineSent = 0;
+}
+
+void ScreenCapture::endFrame() {
+    lineLength = snprintf(line, sizeof(line), "SCR E %lu %u %lu\n",
+                          (unsigned long)frameNumber, frameTiles, (unsigned long)frameBytes);
+    lineSent = 0;
+
+    frameActive = false;
+    frameNumber++;
+    stats.frames++;
+    stats.lastFrameMs = millis() - frameStartMs;
+    stats.lastFrameTiles = frameTiles;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Kachel lesen + kodieren
+// ═══════════════════════════════════════════════════════════════
+
+bool ScreenCapture::prepareTile(uint16_t index, bool force) {
+    int16_t x = (index % TILES_X) * TILE;
+    int16_t y = (index / TILES_X) * TILE;
+    int16_t w = min((int16_t)TILE, (int16_t)(DISPLAY_WIDTH - x));
+    int16_t h = min((int16_t)TILE, (int16_t)(DISPLAY_HEIGHT - y));
+    size_t count = (size_t)w * h;
+
+    {
+        // readRect schaltet selbst auf den Lese-Takt, der Arbiter hält Touch fern
+        SpiBusGuard busGuard(arbiter, SpiDevice::DISPLAY);
+        tft->readRect(x, y, w, h, pixels);
+    }
+
+    uint32_t crc = esp_rom_crc32_le(0, reinterpret_cast<const uint8_t*>(pixels), count * sizeof(uint16_t));
+    if (!force && crc == tileCrc[index]) {
+        stats.tilesSkipped++;
+        return false;
+    }
+    tileCrc[index] = crc;
+
+    size_t rleLength = encodeRLE(pixels, count);
+
+    int header = snprintf(line, sizeof(line), "SCR T %d %d %d %d %08lx ",
+                          x, y, w, h, (unsigned long)adler32(rle, rleLength));
+    size_t length = header + encodeBase64(rle, rleLength, line + header);
+    line[length++] = '\n';
+    lineLength = length;
+    lineSent = 0;
+
+    frameTiles++;
+    frameBytes += length;
+    stats.tilesSent++;
+    stats.rawBytes += count * sizeof(uint16_t);
+    stats.rleBytes += rleLength;
+    stats.lineBytes += length;
+    return true;
+}
+
+bool ScreenCapture::flushLine(bool block) {
+    while (lineSent < lineLength) {
+        size_t chunk = lineLength - lineSent;
+        if (!block) {
+            int space = Serial.availableForWrite();
+            if (space <= 0) return false;
+            if ((size_t)space < chunk) chunk = space;
+        }
+        lineSent += Serial.write(reinterpret_cast<const uint8_t*>(line + lineSent), chunk);
+        if (!block && lineSent < lineLength) return false;
+    }
+
+    lineLength = 0;
+    lineSent = 0;
+    return true;
+}
+
+size_t ScreenCapture::encodeRLE(const uint16_t* data, size_t count) {
+    size_t out = 0;
+    size_t i = 0;
+
+    while (i < count) {
+        // Wiederholung ab i?
+        size_t run = 1;
+        while (i + run < count && run < 128 && data[i + run] == data[i]) run++;
+
+        if (run >= 2) {
+            rle[out++] = 0x80 | (run - 1);
+            // Speicher-Reihenfolge = High-Byte zuerst (readRect liefert Display-Reihenfolge)
+            rle[out++] = data[i] & 0xFF;
+            rle[out++] = data[i] >> 8;
+            i += run;
+            continue;
+        }
+
+        // Einzelpixel bis zur nächsten Wiederholung
+        size_t literal = 1;
+        while (i + literal < count && literal < 128 &&
+               !(i + literal + 1 < count && data[i + literal] == data[i + literal + 1])) {
+            literal++;
+        }
+
+        rle[out++] = literal - 1;
+        for (size_t k = 0; k < literal; k++) {
+            rle[out++] = data[i + k] & 0xFF;
+            rle[out++] = data[i + k] >> 8;
+        }
+        i += literal;
+    }
+    return out;
+}
+
+size_t ScreenCapture::encodeBase64(const uint8_t* data, size_t length, char* out) {
+    size_t o = 0;
+
+    for (size_t i = 0; i < length; i += 3) {
+        uint32_t chunk = (uint32_t)data[i] << 16;
+        if (i + 1 < length) chunk |= (uint32_t)data[i + 1] << 8;
+        if (i + 2 < length) chunk |= data[i + 2];
+
+        out[o++] = BASE64_CHARS[(chunk >> 18) & 0x3F];
+        out[o++] = BASE64_CHARS[(chunk >> 12) & 0x3F];
+        out[o++] = i + 1 < length ? BASE64_CHARS[(chunk >> 6) & 0x3F] : '=';
+        out[o++] = i + 2 < length ? BASE64_CHARS[chunk & 0x3F] : '=';
+    }
+    return o;
+}
+
+uint32_t ScreenCapture::adler32(const uint8_t* data, size_t length) {
+    uint32_t a = 1, b = 0;
+    for (size_t i = 0; i < length; i++) {
+        a = (a + data[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    return (b << 16) | a;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Statistik
+// ═══════════════════════════════════════════════════════════════
+
+void ScreenCapture::printStats() {
+    Serial.println("\n=== Screen-Capture ===");
+    Serial.printf("Stream:          %s", streaming ? "AN" : "AUS");
+    if (streaming) Serial.printf(" (Frame alle >= %u ms, Keyframe alle %d)", intervalMs, UI_SCREEN_KEYFRAME);
+    Serial.println();
+    Serial.printf("Kacheln:         %dx%d px, %d x %d = %u\n", TILE, TILE, TILES_X, TILES_Y, TILE_COUNT);
+    Serial.printf("Frames:          %lu (letzter: %u Kacheln, %lu ms)\n",
+                  stats.frames, stats.lastFrameTiles, stats.lastFrameMs);
+
+    uint32_t checked = stats.tilesSent + stats.tilesSkipped;
+    Serial.printf("Gesendet:        %lu Kacheln, %lu unverändert (%.0f%% gespart)\n",
+                  stats.tilesSent, stats.tilesSkipped, checked > 0 ? 100.0f * stats.tilesSkipped / checked : 0.0f);
+    Serial.printf("Byte:            %llu roh → %llu RLE (%.1fx) → %llu Zeilen\n",
+                  stats.rawBytes, stats.rleBytes,
+                  stats.rleBytes > 0 ? (float)stats.rawBytes / stats.rleBytes : 0.0f, stats.lineBytes);
+    Serial.printf("Ausgesetzt:      %lu x (Transfer/Slide/TX-Puffer)\n", stats.busyPolls);
+    Serial.println("======================\n");
+}
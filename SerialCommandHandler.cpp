@@ -4,6 +4,15 @@
 
 #include "include/SerialCommandHandler.h"
 #include "include/setupConf.h"
+#include "include/PageManager.h"
+#include "include/UIManager.h"
+#include "include/UIArena.h"
+#include "include/UIFont.h"
+#include "include/UITheme.h"
+#include "include/SpiBusArbiter.h"
+#include "include/TouchManager.h"
+#include "include/DisplayHandler.h"
+#include "include/ScreenCapture.h"
 
 SerialCommandHandler::SerialCommandHandler() 
     : sdHandler(nullptr), logger(nullptr), battery(nullptr), 
@@ -176,6 +185,18 @@ void SerialCommandHandler::processCommand(const String& cmd) {
     else if (command == "espnow") {
         handleESPNow();
     }
+    else if (command == "ui") {
+        handleUI(args);
+    }
+    else if (command == "spi") {
+        handleSPI(args);
+    }
+    else if (command == "screen") {
+        handleScreen(args);
+    }
+    else if (command == "touchcal") {
+        handleTouchCal(args);
+    }
     else {
         Serial.printf("❌ Unbekannter Befehl: '%s'\n", command.c_str());
         Serial.println("   Tippe 'help' für Befehlsliste");
@@ -209,6 +230,33 @@ void SerialCommandHandler::handleHelp() {
     Serial.println("  sysinfo               - System-Informationen");
     Serial.println("  battery               - Battery-Status");
     Serial.println("  espnow                - ESP-NOW Status");
+    Serial.println("  spi [reset]           - HSPI-Bus Auslastung (Display/Touch)");
+    Serial.println();
+    Serial.println("🖥️  UI-BEFEHLE:");
+    Serial.println("  ui                    - UI-Elemente, Hit-Grid, Compositor + Frame-Zeiten");
+    Serial.println("  ui reset              - Compositor-Statistik zurücksetzen");
+    Serial.println("  ui sprite [on|off]    - PSRAM-Tile-Rendering (DMA) schalten");
+    Serial.println("  ui async [on|off]     - Letzten DMA-Transfer nicht abwarten");
+    Serial.println("  ui fps [n]            - Ziel-Framerate (0 = ungebremst)");
+    Serial.println("  ui arena              - Widget-Speicher pro Page + freier Heap");
+    Serial.println("  ui pages              - Pages: Aufbau/Abbau-Zeit, Cache-Status");
+    Serial.println("  ui layout             - Header/Footer: geänderte / unveränderte Felder");
+    Serial.println("  ui cache [n]          - Max. gebaute Pages (0 = alle behalten)");
+    Serial.println("  ui budget [us]        - Max. Renderzeit pro Frame (0 = unbegrenzt)");
+    Serial.println("  ui bench [n]          - Hit-Test Benchmark (n Widgets, Std: 128)");
+    Serial.println("  ui render [n]         - Offscreen-Render-Benchmark pro Page (Pixel, Primitive, Überzeichnung)");
+    Serial.println("  ui golden [save]      - Pages mit Referenzbildern auf SD vergleichen / speichern");
+    Serial.println("  ui perf [reset]       - Render-Profil pro Element (Draws, Zeit, Pixel)");
+    Serial.println("  ui overlay [on|off]   - Neu gezeichnete Bereiche auf dem Display umranden");
+    Serial.println("  ui font [bench [n]]   - Atlas-Fonts + Glyph-Cache / Text-Durchsatz gegen drawString()");
+    Serial.println("  ui events             - Event-Handler-Pool + Byte pro Widget (vorher/nachher)");
+    Serial.println("  ui theme [dark|contrast] - Style-Tabelle / Theme live wechseln");
+    Serial.println("  ui slide [on|off]     - Page-Slide per Hardware-Scrolling (Swipe) / Statistik");
+    Serial.println("  screen                - Screenshot (RLE-Kacheln, Host: tools/screen_capture.py)");
+    Serial.println("  screen stream [ms]    - Bildschirm-Stream, nur geänderte Kacheln (Std: 500 ms)");
+    Serial.println("  screen stop|stats     - Stream beenden / Statistik");
+    Serial.println("  touchcal [3|5]        - Touch kalibrieren (Affin, Std: 5 Punkte)");
+    Serial.println("  touchcal clear        - Affin-Kalibrierung verwerfen (Min/Max)");
     Serial.println();
     Serial.println("❓ HILFE:");
     Serial.println("  help                  - Diese Hilfe anzeigen");
@@ -425,6 +473,360 @@ void SerialCommandHandler::handleESPNow() {
     printSeparator();
 }
 
+void SerialCommandHandler::handleSPI(const String& args) {
+    if (!spiBus.isReady()) {
+        Serial.println("❌ HSPI-Arbiter nicht verfügbar");
+        return;
+    }
+    
+    if (args == "reset") {
+        spiBus.resetStats();
+        Serial.println("✅ HSPI-Statistik zurückgesetzt");
+    } else if (args.length() == 0) {
+        spiBus.printStats();
+    } else {
+        Serial.printf("❌ Unbekannter spi Befehl: '%s'\n", args.c_str());
+        Serial.println("   Gültig: reset");
+    }
+}
+
+void SerialCommandHandler::handleUI(const String& args) {
+    int spaceIdx = args.indexOf(' ');
+    String subCmd = (spaceIdx > 0) ? args.substring(0, spaceIdx) : args;
+    String subArgs = (spaceIdx > 0) ? args.substring(spaceIdx + 1) : "";
+    subCmd.toLowerCase();
+    subArgs.trim();
+    
+    if (subCmd.length() == 0) {
+        UIManager* ui = pageManager ? pageManager->getUIManager() : nullptr;
+        if (!ui) {
+            Serial.println("❌ UIManager nicht verfügbar");
+            return;
+        }
+        ui->printDebugInfo();
+        pageManager->printFrameStats();
+    } else if (subCmd == "bench") {
+        int count = subArgs.length() > 0 ? subArgs.toInt() : 128;
+        if (count <= 0 || count > 1000) {
+            Serial.println("❌ Fehler: Anzahl muss zwischen 1 und 1000 liegen");
+            return;
+        }
+        UIManager::benchmarkHitTest(count);
+    } else if (subCmd == "reset") {
+        UIManager* ui = pageManager ? pageManager->getUIManager() : nullptr;
+        if (!ui) {
+            Serial.println("❌ UIManager nicht verfügbar");
+            return;
+        }
+        ui->resetRenderStats();
+        pageManager->resetFrameStats();
+        Serial.println("✅ Compositor- und Frame-Statistik zurückgesetzt");
+    } else if (subCmd == "sprite") {
+        UIManager* ui = pageManager ? pageManager->getUIManager() : nullptr;
+        if (!ui) {
+            Serial.println("❌ UIManager nicht verfügbar");
+            return;
+        }
+        if (subArgs.length() == 0) {
+            Serial.printf("Sprite-Rendering: %s\n",
+                          ui->isSpriteRendering() ? (ui->isTileDMA() ? "AN (DMA)" : "AN (blockierend)") : "AUS");
+            return;
+        }
+        subArgs.toLowerCase();
+        if (subArgs != "on" && subArgs != "off") {
+            Serial.println("❌ Fehler: ui sprite [on|off]");
+            return;
+        }
+        pageManager->waitFlush();
+        if (!ui->setSpriteRendering(subArgs == "on")) {
+            Serial.println("❌ Sprite-Tile nicht verfügbar (PSRAM?), bleibe bei direktem Zeichnen");
+            return;
+        }
+        ui->resetRenderStats();
+        pageManager->resetFrameStats();
+        Serial.printf("✅ Sprite-Rendering %s\n", subArgs == "on" ? "aktiviert" : "deaktiviert");
+    } else if (subCmd == "async") {
+        UIManager* ui = pageManager ? pageManager->getUIManager() : nullptr;
+        if (!ui) {
+            Serial.println("❌ UIManager nicht verfügbar");
+            return;
+        }
+        if (subArgs.length() == 0) {
+            Serial.printf("Asynchroner Flush: %s%s\n", ui->isAsyncFlush() ? "AN" : "AUS",
+                          ui->isTileDMA() ? "" : " (wirkt nur mit 'ui sprite on' + DMA)");
+            return;
+        }
+        subArgs.toLowerCase();
+        if (subArgs != "on" && subArgs != "off") {
+            Serial.println("❌ Fehler: ui async [on|off]");
+            return;
+        }
+        pageManager->waitFlush();
+        ui->setAsyncFlush(subArgs == "on");
+        pageManager->resetFrameStats();
+        Serial.printf("✅ Asynchroner Flush %s\n", subArgs == "on" ? "aktiviert" : "deaktiviert");
+    } else if (subCmd == "arena") {
+        UIArena::printAll();
+    } else if (subCmd == "pages") {
+        if (!pageManager) {
+            Serial.println("❌ PageManager nicht verfügbar");
+            return;
+        }
+        pageManager->printPageStats();
+    } else if (subCmd == "layout") {
+        if (!pageManager) {
+            Serial.println("❌ PageManager nicht verfügbar");
+            return;
+        }
+        pageManager->getLayout()->printStats();
+    } else if (subCmd == "cache") {
+        if (!pageManager) {
+            Serial.println("❌ PageManager nicht verfügbar");
+            return;
+        }
+        if (subArgs.length() == 0) {
+            Serial.printf("Page-Cache: %d (0 = alle behalten)\n", pageManager->getPageCacheSize());
+            return;
+        }
+        int size = subArgs.toInt();
+        if (size < 0 || size > 16 || (size == 0 && subArgs != "0")) {
+            Serial.println("❌ Fehler: Cache-Größe muss zwischen 0 und 16 liegen");
+            return;
+        }
+        pageManager->setPageCacheSize(size);
+        Serial.printf("✅ Page-Cache: %d\n", size);
+    } else if (subCmd == "fps") {
+        if (!pageManager) {
+            Serial.println("❌ PageManager nicht verfügbar");
+            return;
+        }
+        if (subArgs.length() == 0) {
+            Serial.printf("Ziel-FPS: %d (0 = ungebremst)\n", pageManager->getTargetFps());
+            return;
+        }
+        int fps = subArgs.toInt();
+        if (fps < 0 || fps > 120 || (fps == 0 && subArgs != "0")) {
+            Serial.println("❌ Fehler: FPS muss zwischen 0 und 120 liegen");
+            return;
+        }
+        pageManager->setTargetFps(fps);
+        pageManager->resetFrameStats();
+        Serial.printf("✅ Ziel-FPS: %d\n", fps);
+    } else if (subCmd == "budget") {
+        if (!pageManager) {
+            Serial.println("❌ PageManager nicht verfügbar");
+            return;
+        }
+        if (subArgs.length() == 0) {
+            Serial.printf("Frame-Budget: %lu us (0 = unbegrenzt)\n", pageManager->getFrameBudget());
+            return;
+        }
+        long us = subArgs.toInt();
+        if (us < 0 || us > 1000000 || (us == 0 && subArgs != "0")) {
+            Serial.println("❌ Fehler: Budget muss zwischen 0 und 1000000 us liegen");
+            return;
+        }
+        pageManager->setFrameBudget(us);
+        pageManager->resetFrameStats();
+        Serial.printf("✅ Frame-Budget: %ld us\n", us);
+    } else if (subCmd == "render") {
+        if (!pageManager) {
+            Serial.println("❌ PageManager nicht verfügbar");
+            return;
+        }
+        int frames = subArgs.length() > 0 ? subArgs.toInt() : UI_RENDER_BENCH_FRAMES;
+        if (frames < 0 || frames > 600 || (frames == 0 && subArgs.length() > 0 && subArgs != "0")) {
+            Serial.println("❌ Fehler: Frames müssen zwischen 0 und 600 liegen");
+            return;
+        }
+        pageManager->benchmarkRender(frames);
+    } else if (subCmd == "golden") {
+        if (!pageManager) {
+            Serial.println("❌ PageManager nicht verfügbar");
+            return;
+        }
+        subArgs.toLowerCase();
+        if (subArgs.length() > 0 && subArgs != "save") {
+            Serial.println("❌ Fehler: ui golden [save]");
+            return;
+        }
+        pageManager->runGoldenTest(sdHandler, subArgs == "save");
+    } else if (subCmd == "perf") {
+        UIManager* ui = pageManager ? pageManager->getUIManager() : nullptr;
+        if (!ui) {
+            Serial.println("❌ UIManager nicht verfügbar");
+            return;
+        }
+        subArgs.toLowerCase();
+        if (subArgs.length() == 0) {
+            ui->printPerfStats();
+        } else if (subArgs == "reset") {
+            ui->resetPerfStats();
+            Serial.println("✅ Render-Profil zurückgesetzt");
+        } else {
+            Serial.println("❌ Fehler: ui perf [reset]");
+        }
+    } else if (subCmd == "overlay") {
+        UIManager* ui = pageManager ? pageManager->getUIManager() : nullptr;
+        if (!ui) {
+            Serial.println("❌ UIManager nicht verfügbar");
+            return;
+        }
+        if (subArgs.length() == 0) {
+            Serial.printf("Damage-Overlay: %s\n", ui->isPerfOverlay() ? "AN" : "AUS");
+            return;
+        }
+        subArgs.toLowerCase();
+        if (subArgs != "on" && subArgs != "off") {
+            Serial.println("❌ Fehler: ui overlay [on|off]");
+            return;
+        }
+        ui->setPerfOverlay(subArgs == "on");
+        Serial.printf("✅ Damage-Overlay %s\n", subArgs == "on" ? "aktiviert" : "deaktiviert");
+    } else if (subCmd == "events") {
+        UIManager* ui = pageManager ? pageManager->getUIManager() : nullptr;
+        if (!ui) {
+            Serial.println("❌ UIManager nicht verfügbar");
+            return;
+        }
+        ui->printWidgetSizes();
+    } else if (subCmd == "theme") {
+        UIManager* ui = pageManager ? pageManager->getUIManager() : nullptr;
+        if (!ui) {
+            Serial.println("❌ UIManager nicht verfügbar");
+            return;
+        }
+        subArgs.toLowerCase();
+        if (subArgs.length() == 0) {
+            UITheme::printStats();
+            return;
+        }
+        
+        ThemeId theme = ThemeId::COUNT;
+        for (uint8_t i = 0; i < (uint8_t)ThemeId::COUNT; i++) {
+            if (subArgs == UITheme::getThemeName((ThemeId)i)) theme = (ThemeId)i;
+        }
+        if (theme == ThemeId::COUNT) {
+            Serial.println("❌ Fehler: ui theme [dark|contrast]");
+            return;
+        }
+        if (theme == UITheme::getTheme()) {
+            Serial.printf("⚠️ Theme '%s' ist bereits aktiv\n", subArgs.c_str());
+            return;
+        }
+        ui->setTheme(theme);
+    } else if (subCmd == "slide") {
+        if (!pageManager) {
+            Serial.println("❌ PageManager nicht verfügbar");
+            return;
+        }
+        if (subArgs.length() == 0) {
+            pageManager->printSlideStats();
+            return;
+        }
+        subArgs.toLowerCase();
+        if (subArgs != "on" && subArgs != "off") {
+            Serial.println("❌ Fehler: ui slide [on|off]");
+            return;
+        }
+        pageManager->waitFlush();
+        pageManager->setPageSlide(subArgs == "on");
+        Serial.printf("✅ Page-Slide %s\n", subArgs == "on" ? "aktiviert" : "deaktiviert");
+    } else if (subCmd == "font") {
+        subArgs.toLowerCase();
+        if (subArgs.length() == 0) {
+            UIFont::printStats();
+            return;
+        }
+        
+        int space = subArgs.indexOf(' ');
+        String action = space >= 0 ? subArgs.substring(0, space) : subArgs;
+        String countArg = space >= 0 ? subArgs.substring(space + 1) : "";
+        countArg.trim();
+        if (action != "bench") {
+            Serial.println("❌ Fehler: ui font [bench [n]]");
+            return;
+        }
+        int iterations = countArg.length() > 0 ? countArg.toInt() : UI_FONT_BENCH_ITERATIONS;
+        if (iterations < 1 || iterations > 5000) {
+            Serial.println("❌ Fehler: Anzahl muss zwischen 1 und 5000 liegen");
+            return;
+        }
+        UIFont::benchmark(&display.getTft(), &uiFont, iterations);
+    } else {
+        Serial.printf("❌ Unbekannter ui Befehl: '%s'\n", subCmd.c_str());
+        Serial.println("   Gültig: bench, reset, sprite, async, fps, budget, arena, pages, cache, render, golden, perf, overlay, font, events, theme, slide");
+    }
+}
+
+void SerialCommandHandler::handleScreen(const String& args) {
+    int spaceIdx = args.indexOf(' ');
+    String subCmd = (spaceIdx > 0) ? args.substring(0, spaceIdx) : args;
+    String subArgs = (spaceIdx > 0) ? args.substring(spaceIdx + 1) : "";
+    subCmd.toLowerCase();
+    subArgs.trim();
+    
+    if (subCmd.length() == 0) {
+        screenCapture.captureFrame();
+    } else if (subCmd == "stream") {
+        int interval = subArgs.length() > 0 ? subArgs.toInt() : UI_SCREEN_INTERVAL_MS;
+        if (interval < 50 || interval > 60000) {
+            Serial.println("❌ Fehler: Intervall muss zwischen 50 und 60000 ms liegen");
+            return;
+        }
+        screenCapture.startStream(interval);
+    } else if (subCmd == "stop") {
+        screenCapture.stopStream();
+    } else if (subCmd == "stats") {
+        screenCapture.printStats();
+    } else {
+        Serial.printf("❌ Unbekannter screen Befehl: '%s'\n", subCmd.c_str());
+        Serial.println("   Gültig: stream [ms], stop, stats");
+    }
+}
+
+void SerialCommandHandler::handleTouchCal(const String& args) {
+    if (!touch.isAvailable()) {
+        Serial.println("❌ Touch nicht verfügbar");
+        return;
+    }
+    
+    if (args == "clear") {
+        touch.clearAffineCalibration();
+        if (config) config->clearTouchAffine();
+        Serial.println("✅ Affin-Kalibrierung verworfen (Min/Max aktiv)");
+        Serial.println("   'config save' zum dauerhaften Speichern");
+        return;
+    }
+    
+    int points = args.length() > 0 ? args.toInt() : 5;
+    if (points != 3 && points != 5) {
+        Serial.println("❌ Fehler: Punkte müssen 3 oder 5 sein");
+        Serial.println("   Verwendung: touchcal [3|5|clear]");
+        return;
+    }
+    
+    Serial.printf("👆 %d-Punkt-Kalibrierung: Kreuze auf dem Display nacheinander berühren\n", points);
+    
+    // Kalibrierung zeichnet direkt → laufenden Tile-Transfer abschließen, Bus freigeben
+    if (pageManager) pageManager->waitFlush();
+    
+    bool ok = touch.runCalibration(&display.getTft(), points);
+    
+    if (ok && config) {
+        touch.saveCalibrationToConfig(config);
+        Serial.println("✅ Kalibrierung übernommen");
+        Serial.println("   'config save' zum dauerhaften Speichern");
+    } else if (!ok) {
+        Serial.println("❌ Kalibrierung fehlgeschlagen - alte Werte bleiben aktiv");
+    }
+    
+    // Display wurde komplett überschrieben → Seite + Header/Footer neu aufbauen
+    if (pageManager) {
+        pageManager->redrawScreen();
+    }
+}
+
 // ═══════════════════════════════════════════════════════════════════
 // HILFSFUNKTIONEN
 // ═══════════════════════════════════════════════════════════════════
@@ -23,13 +23,18 @@ SettingsPage::SettingsPage(UIManager* ui, TFT_eSPI* tft)
 void SettingsPage::build() {
     Serial.println("Building SettingsPage...");
     
-    UILabel* lblTitle = new UILabel(layout.contentX + 20, layout.contentY + 20, layout.contentWidth - 40, 30, "Brightness");
+    // Eine Spalte, Einträge linksbündig untereinander
+    UIFlexBox* root = arena.create<UIFlexBox>(FlexDirection::COLUMN, 0, 20);
+    
+    UILabel* lblTitle = arena.create<UILabel>(0, 0, 0, 0, "Brightness");
     lblTitle->setFontSize(2);
     lblTitle->setAlignment(TextAlignment::LEFT);
     lblTitle->setTransparent(true);
     addContentElement(lblTitle);
+    root->add(lblTitle, LAYOUT_AUTO, 30);
     
-    UISlider* sldBrightness = new UISlider(layout.contentX + 20, layout.contentY + 45, 400, 40);
+    // Wert wird rechts neben dem Slider gezeichnet → feste Breite statt STRETCH
+    UISlider* sldBrightness = arena.create<UISlider>(0, 0, 400, 40);
     sldBrightness->setValue(userConfig.getBacklightDefault());
     sldBrightness->setShowValue(true);
     sldBrightness->on(EventType::VALUE_CHANGED, [](EventData* data) {
@@ -37,27 +42,24 @@ void SettingsPage::build() {
         display.setBacklight(brightness);
     });
     addContentElement(sldBrightness);
+    root->add(sldBrightness).align = FlexAlign::START;
 
-    UICheckBox* chkAutoShutdown = new UICheckBox(layout.contentX + 20, layout.contentY + 90, 30, "Auto shutdown");
+    UICheckBox* chkAutoShutdown = arena.create<UICheckBox>(0, 0, 30, "Auto shutdown");
     chkAutoShutdown->setChecked(userConfig.getAutoShutdownEnabled());
     chkAutoShutdown->on(EventType::VALUE_CHANGED, [this](EventData* data) {
         userConfig.setAutoShutdownEnabled(data->value);       
     });
     addContentElement(chkAutoShutdown);
+    root->add(chkAutoShutdown).align = FlexAlign::START;
 
-    UILabel* lblInfo = new UILabel(layout.contentX + 20, layout.contentY + 120, layout.contentWidth - 40, 60, "Config via SD-Card config.json");
+    UILabel* lblInfo = arena.create<UILabel>(0, 0, 0, 0, "Config via SD-Card config.json");
     lblInfo->setFontSize(1);
     lblInfo->setAlignment(TextAlignment::CENTER);
     lblInfo->setTransparent(true);
     addContentElement(lblInfo);
+    root->add(lblInfo, LAYOUT_AUTO, 60);
 
-    UIButton* btnCalibrate = new UIButton(
-        layout.contentX + 140,
-        layout.contentY + 180,
-        200,
-        40,
-        "Calibrate Center"
-    );
+    UIButton* btnCalibrate = arena.create<UIButton>(0, 0, 200, 40, "Calibrate Center");
 
     btnCalibrate->on(EventType::CLICK, [](EventData* data) {
         Serial.println("→ Kalibriere Joystick Center...");
@@ -65,6 +67,9 @@ void SettingsPage::build() {
         Serial.println("  Fertig! Joystick neutral halten!");
     });
     addContentElement(btnCalibrate);
+    root->add(btnCalibrate).align = FlexAlign::CENTER;
+    
+    setContentLayout(root);
     
     Serial.println("  ✅ SettingsPage build complete");
 }
\ No newline at end of file
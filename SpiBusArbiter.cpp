@@ -0,0 +1,231 @@
+/**
+ * SpiBusArbiter.cpp
+ */
+
+#include "include/SpiBusArbiter.h"
+
+SpiBusArbiter::SpiBusArbiter()
+    : spi(nullptr)
+    , mutex(nullptr)
+    , owner(SpiDevice::NONE)
+    , lastDevice(SpiDevice::NONE)
+    , depth(0)
+    , holdStart(0)
+    , clockDevice(SpiDevice::NONE)
+    , deviceSwitches(0)
+    , clockSwitches(0)
+    , conflicts(0)
+    , statsStart(0)
+{
+    for (uint8_t i = 0; i < DEVICE_COUNT; i++) {
+        beginHooks[i] = nullptr;
+        endHooks[i] = nullptr;
+        managedSettings[i] = false;
+        appliedDivider[i] = 0;
+    }
+    memset(stats, 0, sizeof(stats));
+}
+
+SpiBusArbiter::~SpiBusArbiter() {
+    if (mutex) {
+        vSemaphoreDelete(mutex);
+        mutex = nullptr;
+    }
+}
+
+bool SpiBusArbiter::begin() {
+    DEBUG_PRINTLN("SpiBusArbiter: Initialisiere HSPI-Arbiter...");
+
+    // Alle Chip-Selects inaktiv, bevor irgendein Gerät den Bus anspricht
+    pinMode(TOUCH_CS, OUTPUT);
+    digitalWrite(TOUCH_CS, HIGH);
+    pinMode(TFT_CS, OUTPUT);
+    digitalWrite(TFT_CS, HIGH);
+
+    if (!mutex) {
+        mutex = xSemaphoreCreateRecursiveMutex();
+    }
+
+    if (!mutex) {
+        DEBUG_PRINTLN("SpiBusArbiter: ❌ Mutex erstellen fehlgeschlagen!");
+        return false;
+    }
+
+    resetStats();
+
+    DEBUG_PRINTF("SpiBusArbiter: ✅ Bereit (Display %lu Hz, Touch %lu Hz)\n",
+                 (unsigned long)TFT_SPI_FREQUENCY, (unsigned long)TOUCH_SPI_FREQUENCY);
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// BELEGUNG
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool SpiBusArbiter::acquire(SpiDevice device, uint32_t timeoutMs) {
+    if (!mutex || device == SpiDevice::NONE || device == SpiDevice::COUNT) return false;
+
+    SpiDeviceStats& s = stats[static_cast<uint8_t>(device)];
+
+    uint32_t waitStart = micros();
+    TickType_t ticks = (timeoutMs == portMAX_DELAY) ? portMAX_DELAY : pdMS_TO_TICKS(timeoutMs);
+
+    if (xSemaphoreTakeRecursive(mutex, ticks) != pdTRUE) {
+        s.timeouts++;
+        return false;
+    }
+
+    if (depth > 0) {
+        // Gleicher Task hält den Bus bereits
+        if (owner != device) {
+            // Anderes Gerät mitten im Burst → CS-Konflikt, ablehnen
+            conflicts++;
+            xSemaphoreGiveRecursive(mutex);
+            return false;
+        }
+        depth++;
+        return true;
+    }
+
+    uint32_t waited = micros() - waitStart;
+    s.waitUs += waited;
+    if (waited > s.maxWaitUs) s.maxWaitUs = waited;
+    s.acquisitions++;
+
+    if (device != lastDevice) {
+        deviceSwitches++;
+        lastDevice = device;
+    }
+    applyClock(device);
+
+    owner = device;
+    depth = 1;
+    holdStart = micros();
+
+    SpiBurstHook& hook = beginHooks[static_cast<uint8_t>(device)];
+    if (hook) hook();
+
+    return true;
+}
+
+void SpiBusArbiter::release(SpiDevice device) {
+    if (!mutex || depth == 0 || owner != device) return;
+
+    if (--depth == 0) {
+        SpiBurstHook& hook = endHooks[static_cast<uint8_t>(device)];
+        if (hook) hook();
+
+        SpiDeviceStats& s = stats[static_cast<uint8_t>(device)];
+        uint32_t held = micros() - holdStart;
+        s.busyUs += held;
+        if (held > s.maxHoldUs) s.maxHoldUs = held;
+
+        owner = SpiDevice::NONE;
+    }
+
+    xSemaphoreGiveRecursive(mutex);
+}
+
+void SpiBusArbiter::setBurstHooks(SpiDevice device, SpiBurstHook onBegin, SpiBurstHook onEnd) {
+    if (device == SpiDevice::NONE || device == SpiDevice::COUNT) return;
+
+    beginHooks[static_cast<uint8_t>(device)] = onBegin;
+    endHooks[static_cast<uint8_t>(device)] = onEnd;
+}
+
+void SpiBusArbiter::setDeviceSettings(SpiDevice device, const SPISettings& settings) {
+    if (device == SpiDevice::NONE || device == SpiDevice::COUNT) return;
+
+    uint8_t idx = static_cast<uint8_t>(device);
+    deviceSettings[idx] = settings;
+    managedSettings[idx] = true;
+    appliedDivider[idx] = 0;    // Beim nächsten acquire() sicher neu setzen
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TAKT
+// ═══════════════════════════════════════════════════════════════════════════
+
+void SpiBusArbiter::applyClock(SpiDevice device) {
+    uint8_t idx = static_cast<uint8_t>(device);
+
+    if (managedSettings[idx]) {
+        if (!spi) return;
+
+        // Register vergleichen statt nur den Besitzer: fängt auch Display-Zugriffe
+        // am Arbiter vorbei ab (sonst würde Touch mit 40 MHz gelesen)
+        if (appliedDivider[idx] == 0 || spi->getClockDivider() != appliedDivider[idx]) {
+            // Register bleiben nach endTransaction() stehen, nur der Param-Lock wird frei
+            spi->beginTransaction(deviceSettings[idx]);
+            spi->endTransaction();
+            appliedDivider[idx] = spi->getClockDivider();
+            if (clockDevice != SpiDevice::NONE) clockSwitches++;
+        }
+    } else if (clockDevice != device && clockDevice != SpiDevice::NONE) {
+        // Treiber mit eigener Transaktion (TFT_eSPI startWrite) stellt im Burst-Hook
+        // zurück - zählt nur, wenn vorher ein anderer Takt im Register stand
+        clockSwitches++;
+    }
+
+    clockDevice = device;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// METRIKEN
+// ═══════════════════════════════════════════════════════════════════════════
+
+const SpiDeviceStats& SpiBusArbiter::getStats(SpiDevice device) const {
+    uint8_t idx = static_cast<uint8_t>(device);
+    if (idx >= DEVICE_COUNT) idx = 0;
+    return stats[idx];
+}
+
+float SpiBusArbiter::getUtilization(SpiDevice device) const {
+    unsigned long elapsedMs = millis() - statsStart;
+    if (elapsedMs == 0) return 0.0f;
+
+    return (float)getStats(device).busyUs / (elapsedMs * 10.0f);  // µs / (ms * 1000) * 100
+}
+
+void SpiBusArbiter::resetStats() {
+    memset(stats, 0, sizeof(stats));
+    deviceSwitches = 0;
+    clockSwitches = 0;
+    conflicts = 0;
+    statsStart = millis();
+}
+
+const char* SpiBusArbiter::deviceName(SpiDevice device) {
+    switch (device) {
+        case SpiDevice::DISPLAY: return "Display";
+        case SpiDevice::TOUCH:   return "Touch";
+        default:                 return "-";
+    }
+}
+
+void SpiBusArbiter::printStats() {
+    unsigned long elapsedMs = millis() - statsStart;
+
+    Serial.println("\n=== HSPI Bus-Arbiter ===");
+    Serial.printf("Zeitraum:        %lu ms\n", elapsedMs);
+    Serial.printf("Besitzer:        %s\n", deviceName(owner));
+    Serial.printf("Geräte-Wechsel:  %lu (%.1f/s)\n", deviceSwitches,
+                  elapsedMs > 0 ? deviceSwitches * 1000.0f / elapsedMs : 0.0f);
+    Serial.printf("Takt-Wechsel:    %lu (%.1f/s)\n", clockSwitches,
+                  elapsedMs > 0 ? clockSwitches * 1000.0f / elapsedMs : 0.0f);
+    Serial.printf("Konflikte:       %lu\n", conflicts);
+
+    for (uint8_t i = 1; i < DEVICE_COUNT; i++) {
+        SpiDevice device = static_cast<SpiDevice>(i);
+        const SpiDeviceStats& s = stats[i];
+
+        Serial.printf("\n%s:\n", deviceName(device));
+        Serial.printf("  Belegungen:    %lu\n", s.acquisitions);
+        Serial.printf("  Auslastung:    %.2f %%\n", getUtilization(device));
+        Serial.printf("  Belegt:        %llu us (max %lu us)\n", s.busyUs, s.maxHoldUs);
+        Serial.printf("  Gewartet:      %llu us (max %lu us, Ø %lu us)\n", s.waitUs, s.maxWaitUs,
+                      s.acquisitions > 0 ? (unsigned long)(s.waitUs / s.acquisitions) : 0UL);
+        Serial.printf("  Timeouts:      %lu\n", s.timeouts);
+    }
+    Serial.println("========================\n");
+}
@@ -8,6 +8,40 @@
 #include "include/userConf.h"
 #include "include/TouchManager.h"
 #include "include/UserConfig.h"
+#include <TFT_eSPI.h>
+#include <algorithm>
+
+// XPT2046-Lib läuft immer in dieser Rotation (native Achsen),
+// die Display-Rotation steckt in den Mapping-Koeffizienten
+static const uint8_t TOUCH_NATIVE_ROTATION = 1;
+
+// Druck ab dem die XPT2046-Lib touched() meldet
+static const int32_t XPT_Z_THRESHOLD = 400;
+
+// XPT2046 Steuerbytes (Start + Kanal, 12 Bit, differentiell)
+static const uint8_t XPT_CMD_Z1 = 0xB1;
+static const uint8_t XPT_CMD_Z2 = 0xC1;
+static const uint8_t XPT_CMD_X = 0x91;
+static const uint8_t XPT_CMD_Y = 0xD1;
+static const uint8_t XPT_CMD_Y_POWERDOWN = 0xD0;
+
+// Grenzen für Q16-Koeffizienten (int32-Überlauf bei Rohwerten 0-4095)
+static const int32_t AFFINE_MAX_SCALE = 1L << 17;    // max. 2 px pro Roh-Einheit
+static const int32_t AFFINE_MAX_OFFSET = 1L << 29;
+static const int16_t RAW_MAX = 4095;                 // 12 Bit ADC
+
+// Mit Rohwerten bis RAW_MAX bleibt a·rx + b·ry + c sicher unter 2^31 (mapCoordinates)
+static bool coeffsInRange(const int32_t c[6]) {
+    for (uint8_t i = 0; i < 6; i++) {
+        int32_t limit = (i % 3 == 2) ? AFFINE_MAX_OFFSET : AFFINE_MAX_SCALE;
+        if (c[i] <= -limit || c[i] >= limit) return false;
+    }
+    return true;
+}
+
+static bool calibrationRangeValid(int16_t minValue, int16_t maxValue) {
+    return minValue >= 0 && maxValue <= RAW_MAX && maxValue - minValue >= TOUCH_CAL_MIN_SPAN;
+}
 
 
 TouchManager::TouchManager()
@@ -20,11 +54,19 @@ TouchManager::TouchManager()
     , calMinY(TOUCH_MIN_Y)
     , calMaxY(TOUCH_MAX_Y)
     , calibrated(false)
+    , affineValid(false)
     , pressureThreshold(TOUCH_THRESHOLD)
     , rotation(TOUCH_ROTATION)
     , displayWidth(DISPLAY_WIDTH)
     , displayHeight(DISPLAY_HEIGHT)
     , touchStartTime(0)
+    , busArbiter(nullptr)
+    , samplingTask(nullptr)
+    , eventQueue(nullptr)
+    , droppedEvents(0)
+    , busyBursts(0)
+    , samplingStopRequested(false)
+    , samplingExited(nullptr)
 {
     // Aktuellen Touch-Punkt initialisieren
     currentPoint.x = 0;
@@ -34,10 +76,30 @@ TouchManager::TouchManager()
     currentPoint.z = 0;
     currentPoint.valid = false;
     currentPoint.timestamp = 0;
+    
+    memset(affine, 0, sizeof(affine));
+    memset(&mapping, 0, sizeof(mapping));
+    rebuildMapping();
 }
 
 TouchManager::~TouchManager() {
     end();  // Speicher freigeben falls noch allokiert
+    
+    if (samplingExited) {
+        vSemaphoreDelete(samplingExited);
+        samplingExited = nullptr;
+    }
+}
+
+// Mittelwert der zwei nächstliegenden Messungen (wie XPT2046_Touchscreen)
+static int16_t bestTwoAverage(int16_t a, int16_t b, int16_t c) {
+    int16_t dab = abs(a - b);
+    int16_t dac = abs(a - c);
+    int16_t dbc = abs(b - c);
+    
+    if (dab <= dac && dab <= dbc) return (a + b) >> 1;
+    if (dac <= dab && dac <= dbc) return (a + c) >> 1;
+    return (b + c) >> 1;
 }
 
 bool TouchManager::begin(SPIClass* spi, UserConfig* config) {
@@ -49,7 +111,9 @@ bool TouchManager::begin(SPIClass* spi, UserConfig* config) {
     DEBUG_PRINTLN("TouchManager: Initialisiere Touch...");
     
     // XPT2046 Objekt erstellen (dynamisch allokieren)
-    ts = new XPT2046_Touchscreen(TOUCH_CS, TOUCH_IRQ);
+    // OHNE IRQ-Pin: Die Lib würde sonst ihren eigenen ISR auf TOUCH_IRQ legen,
+    // der IRQ wird hier selbst ausgewertet (isIRQActive() / Sampling-Task)
+    ts = new XPT2046_Touchscreen(TOUCH_CS);
     
     if (ts == nullptr) {
         DEBUG_PRINTLN("TouchManager: Konnte XPT2046 Objekt nicht erstellen!");
@@ -57,8 +121,9 @@ bool TouchManager::begin(SPIClass* spi, UserConfig* config) {
     }
     
     // Touch initialisieren
+    pinMode(TOUCH_IRQ, INPUT);
     ts->begin(*spi);
-    ts->setRotation(rotation);
+    ts->setRotation(TOUCH_NATIVE_ROTATION);
     
     // Kalibrierung aus Config laden (falls verfügbar)
     if (config != nullptr) {
@@ -69,13 +134,15 @@ bool TouchManager::begin(SPIClass* spi, UserConfig* config) {
     
     DEBUG_PRINTLN("TouchManager: ✅ Touch initialisiert");
     DEBUG_PRINTF("TouchManager: CS=%d, IRQ=%d, Rotation=%d\n", TOUCH_CS, TOUCH_IRQ, rotation);
-    DEBUG_PRINTF("TouchManager: Kalibrierung: X=%d-%d, Y=%d-%d, Threshold=%d\n",
-                 calMinX, calMaxX, calMinY, calMaxY, pressureThreshold);
+    DEBUG_PRINTF("TouchManager: Kalibrierung: X=%d-%d, Y=%d-%d, Threshold=%d, Affin=%s\n",
+                 calMinX, calMaxX, calMinY, calMaxY, pressureThreshold, affineValid ? "ja" : "nein");
     
     return true;
 }
 
 void TouchManager::end() {
+    stopSampling();
+    
     if (ts != nullptr) {
         DEBUG_PRINTLN("TouchManager: Gebe Touch-Speicher frei...");
         delete ts;  // Speicher freigeben
@@ -85,6 +152,16 @@ void TouchManager::end() {
     }
 }
 
+void TouchManager::setBusArbiter(SpiBusArbiter* arbiter) {
+    busArbiter = arbiter;
+    
+    // Takt stellt ab jetzt der Arbiter - nur wenn das Display ihn verstellt hat
+    if (busArbiter) {
+        busArbiter->setDeviceSettings(SpiDevice::TOUCH,
+                                      SPISettings(TOUCH_SPI_FREQUENCY, MSBFIRST, SPI_MODE0));
+    }
+}
+
 bool TouchManager::isAvailable() {
     return (ts != nullptr && initialized);
 }
@@ -101,13 +178,17 @@ bool TouchManager::update() {
     // Letzten Status speichern
     lastTouchState = currentTouchState;
     
+    // Bus für die gesamte Mittelung belegen (nicht mitten im Display-Burst)
+    SpiBusGuard busGuard(busArbiter, SpiDevice::TOUCH, TOUCH_BUS_TIMEOUT_MS);
+    if (busArbiter && busArbiter->isReady() && !busGuard.isLocked()) {
+        return currentTouchState;
+    }
+    
     // Aktuellen Touch-Status abrufen
-    currentTouchState = ts->touched();
+    TS_Point p = readPoint();
+    currentTouchState = p.z >= XPT_Z_THRESHOLD;
     
     if (currentTouchState) {
-        // Touch-Punkt abrufen
-        TS_Point p = ts->getPoint();
-        
         // Nur gültig wenn Druck über Schwellwert
         if (p.z >= pressureThreshold) {
             // Touch gerade gestartet? Startzeit merken
@@ -121,7 +202,7 @@ bool TouchManager::update() {
             for (int i = 0; i < SAMPLE_COUNT; i++) {
                 delayMicroseconds(SAMPLE_DELAY_US);
 
-                p = ts->getPoint();
+                p = readPoint();
              
                 bufferX[i] = p.x;
                 bufferY[i] = p.y;
@@ -173,6 +254,304 @@ bool TouchManager::updateIfIRQ() {
     return update();
 }
 
+// ═══════════════════════════════════════════════════════════════════════════
+// SAMPLING-TASK (IRQ → Task → Queue → Main-Thread)
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool TouchManager::startSampling() {
+    if (!isAvailable()) {
+        DEBUG_PRINTLN("TouchManager: ⚠️ Sampling ohne Touch nicht möglich");
+        return false;
+    }
+    
+    if (samplingTask != nullptr) {
+        return true;  // Läuft bereits
+    }
+    
+    // Lebt so lange wie das Objekt (stopSampling() wartet darauf)
+    if (!samplingExited) {
+        samplingExited = xSemaphoreCreateBinary();
+        if (!samplingExited) {
+            DEBUG_PRINTLN("TouchManager: ❌ Semaphore erstellen fehlgeschlagen!");
+            return false;
+        }
+    }
+    xSemaphoreTake(samplingExited, 0);   // Alte Meldung verwerfen
+    
+    eventQueue = xQueueCreate(TOUCH_EVENT_QUEUE_SIZE, sizeof(TouchPoint));
+    if (!eventQueue) {
+        DEBUG_PRINTLN("TouchManager: ❌ Event-Queue erstellen fehlgeschlagen!");
+        return false;
+    }
+    
+    samplingStopRequested = false;
+    droppedEvents = 0;
+    busyBursts = 0;
+    
+    // Gleicher Core wie loop(): SPI-Zugriffe von Display und Touch
+    // serialisiert der SpiBusArbiter (Mutex, readFilteredBurst() belegt pro Sample)
+    BaseType_t result = xTaskCreatePinnedToCore(
+        samplingTaskEntry,
+        "touchSampler",
+        TOUCH_TASK_STACK_SIZE,
+        this,
+        TOUCH_TASK_PRIORITY,
+        &samplingTask,
+        ARDUINO_RUNNING_CORE
+    );
+    
+    if (result != pdPASS) {
+        DEBUG_PRINTLN("TouchManager: ❌ Sampling-Task erstellen fehlgeschlagen!");
+        vQueueDelete(eventQueue);
+        eventQueue = nullptr;
+        samplingTask = nullptr;
+        return false;
+    }
+    
+    // Fallende Flanke = Touch begonnen → Task wecken
+    attachInterruptArg(digitalPinToInterrupt(TOUCH_IRQ), onTouchIRQ, this, FALLING);
+    
+    DEBUG_PRINTF("TouchManager: ✅ Sampling-Task gestartet (Burst=%d, Abstand=%dms, Queue=%d)\n",
+                 TOUCH_BURST_SAMPLES, TOUCH_SAMPLE_SPACING_MS, TOUCH_EVENT_QUEUE_SIZE);
+    
+    return true;
+}
+
+void TouchManager::stopSampling() {
+    if (samplingTask == nullptr) return;
+    
+    detachInterrupt(digitalPinToInterrupt(TOUCH_IRQ));
+    
+    // Task beendet sich selbst (nie mitten in einer SPI-Transaktion löschen!)
+    samplingStopRequested = true;
+    xTaskNotifyGive(samplingTask);
+    
+    // Warten bis der Task wirklich raus ist: er kann noch auf den Bus warten oder
+    // zwischen zwei Samples schlafen und danach in die Queue schreiben.
+    // Höchstens ein Burst (TOUCH_BURST_SAMPLES x Abstand/Bus-Timeout)
+    xSemaphoreTake(samplingExited, portMAX_DELAY);
+    samplingTask = nullptr;
+    
+    if (eventQueue) {
+        vQueueDelete(eventQueue);
+        eventQueue = nullptr;
+    }
+    
+    DEBUG_PRINTLN("TouchManager: ✅ Sampling-Task gestoppt");
+}
+
+bool TouchManager::pollEvent(TouchPoint* point) {
+    if (!eventQueue) return false;
+    
+    TouchPoint event;
+    if (xQueueReceive(eventQueue, &event, 0) != pdTRUE) {
+        return false;
+    }
+    
+    // Zustand wie in update() nachführen (für isTouched() etc.)
+    lastTouchState = currentTouchState;
+    currentTouchState = event.valid;
+    
+    if (event.valid && !lastTouchState) {
+        touchStartTime = event.timestamp;
+    }
+    
+    currentPoint = event;
+    
+    if (point != nullptr) *point = event;
+    
+    return true;
+}
+
+void IRAM_ATTR TouchManager::onTouchIRQ(void* arg) {
+    TouchManager* self = static_cast<TouchManager*>(arg);
+    
+    if (self->samplingTask == nullptr) return;
+    
+    BaseType_t higherPriorityWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(self->samplingTask, &higherPriorityWoken);
+    
+    if (higherPriorityWoken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+void TouchManager::samplingTaskEntry(void* arg) {
+    TouchManager* self = static_cast<TouchManager*>(arg);
+    
+    self->samplingLoop();
+    
+    // Abmelden und selbst beenden - nach dem Give kein Zugriff mehr auf self
+    self->samplingTask = nullptr;
+    xSemaphoreGive(self->samplingExited);
+    vTaskDelete(nullptr);
+}
+
+void TouchManager::samplingLoop() {
+    while (!samplingStopRequested) {
+        // Auf IRQ warten (Timeout als Sicherheitsnetz für verpasste Flanken)
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(500));
+        
+        if (samplingStopRequested) break;
+        if (!isIRQActive()) continue;
+        
+        TouchPoint point;
+        TouchPoint lastPoint;
+        bool pressed = false;
+        
+        // Solange gedrückt: Bursts lesen und als Events weiterreichen
+        while (!samplingStopRequested) {
+            BurstResult result = readFilteredBurst(&point);
+            
+            // Display hält den Bus (langer Burst/Tile-Transfer): kein Urteil über
+            // den Finger → Zustand beibehalten, nächster Versuch (Acquire hat schon gewartet)
+            if (result == BurstResult::BUS_BUSY) {
+                busyBursts++;
+                continue;
+            }
+            if (result == BurstResult::RELEASED) break;
+            
+            pushEvent(point);
+            lastPoint = point;
+            pressed = true;
+        }
+        
+        // Release-Event an letzter Position
+        if (pressed) {
+            lastPoint.valid = false;
+            lastPoint.z = 0;
+            lastPoint.timestamp = millis();
+            pushEvent(lastPoint);
+        }
+        
+        // Flanken die während der SPI-Konvertierung entstanden sind verwerfen
+        ulTaskNotifyTake(pdTRUE, 0);
+    }
+}
+
+TouchManager::BurstResult TouchManager::readFilteredBurst(TouchPoint* point) {
+    int16_t samplesX[TOUCH_BURST_SAMPLES];
+    int16_t samplesY[TOUCH_BURST_SAMPLES];
+    uint16_t maxZ = 0;
+    uint8_t count = 0;
+    
+    for (uint8_t i = 0; i < TOUCH_BURST_SAMPLES; i++) {
+        if (i > 0) {
+            // Blockiert nur diesen Task, nicht loop()
+            vTaskDelay(pdMS_TO_TICKS(TOUCH_SAMPLE_SPACING_MS));
+        }
+        
+        // Bus pro Sample belegen - zwischen den Samples darf das Display zeichnen
+        SpiBusGuard busGuard(busArbiter, SpiDevice::TOUCH, TOUCH_BUS_TIMEOUT_MS);
+        if (busArbiter && busArbiter->isReady() && !busGuard.isLocked()) {
+            return BurstResult::BUS_BUSY;  // Timeout ist kein ungültiges Sample
+        }
+        
+        TS_Point p = readPoint();
+        
+        // Samples unter Schwellwert sind Ausreißer (Abheben/Prellen)
+        if (p.z >= pressureThreshold) {
+            samplesX[count] = p.x;
+            samplesY[count] = p.y;
+            if (p.z > maxZ) maxZ = p.z;
+            count++;
+        }
+    }
+    
+    // Mehrheit der Samples muss gültig sein
+    if (count < (TOUCH_BURST_SAMPLES / 2) + 1) {
+        return BurstResult::RELEASED;
+    }
+    
+    point->rawX = trimmedMean(samplesX, count);
+    point->rawY = trimmedMean(samplesY, count);
+    point->z = maxZ;
+    point->valid = true;
+    point->timestamp = millis();
+    
+    mapCoordinates(point->rawX, point->rawY, &point->x, &point->y);
+    
+    return BurstResult::TOUCHED;
+}
+
+TS_Point TouchManager::readPoint() {
+    SPIClass* bus = (busArbiter && busArbiter->isReady()) ? busArbiter->getSPI() : nullptr;
+    if (bus == nullptr) {
+        return ts->getPoint();      // Lib öffnet pro Read eine eigene Transaktion
+    }
+    
+    // Gleiche Sequenz wie XPT2046_Touchscreen::update(), aber ohne beginTransaction():
+    // den Takt hat acquire() bereits gesetzt (nur nach einem Display-Burst neu).
+    // Jedes transfer16() liefert das Ergebnis des vorherigen Kommandos.
+    int16_t data[6];
+    
+    digitalWrite(TOUCH_CS, LOW);
+    bus->transfer(XPT_CMD_Z1);
+    int32_t z1 = bus->transfer16(XPT_CMD_Z2) >> 3;
+    int32_t z2 = bus->transfer16(XPT_CMD_X) >> 3;
+    bus->transfer16(XPT_CMD_X);                         // Erste X-Messung ist verrauscht
+    data[0] = bus->transfer16(XPT_CMD_Y) >> 3;          // X
+    data[1] = bus->transfer16(XPT_CMD_X) >> 3;          // Y
+    data[2] = bus->transfer16(XPT_CMD_Y) >> 3;
+    data[3] = bus->transfer16(XPT_CMD_X) >> 3;
+    data[4] = bus->transfer16(XPT_CMD_Y_POWERDOWN) >> 3;
+    data[5] = bus->transfer16(0) >> 3;
+    digitalWrite(TOUCH_CS, HIGH);
+    
+    // Unter der Lib-Schwelle wie getPoint(): kein Druck
+    int32_t z = z1 + RAW_MAX - z2;
+    if (z < XPT_Z_THRESHOLD) z = 0;
+    
+    // Native Rotation (TOUCH_NATIVE_ROTATION): Achsen unverändert
+    return TS_Point(bestTwoAverage(data[0], data[2], data[4]),
+                    bestTwoAverage(data[1], data[3], data[5]),
+                    (int16_t)z);
+}
+
+void TouchManager::pushEvent(const TouchPoint& point) {
+    if (xQueueSend(eventQueue, &point, 0) == pdTRUE) {
+        return;
+    }
+    
+    // Queue voll: Move-Events sind verzichtbar
+    droppedEvents++;
+    
+    if (point.valid) {
+        return;
+    }
+    
+    // Release darf nie verloren gehen → ältestes Event verdrängen
+    TouchPoint oldest;
+    xQueueReceive(eventQueue, &oldest, 0);
+    xQueueSend(eventQueue, &point, 0);
+}
+
+int16_t TouchManager::trimmedMean(int16_t* values, uint8_t count) {
+    if (count == 0) return 0;
+    
+    // Insertion-Sort (max. TOUCH_BURST_SAMPLES Werte)
+    for (uint8_t i = 1; i < count; i++) {
+        int16_t key = values[i];
+        int8_t j = i - 1;
+        while (j >= 0 && values[j] > key) {
+            values[j + 1] = values[j];
+            j--;
+        }
+        values[j + 1] = key;
+    }
+    
+    // Min/Max verwerfen (ab 3 Werten), Rest mitteln
+    uint8_t first = (count >= 3) ? 1 : 0;
+    uint8_t last = (count >= 3) ? count - 1 : count;
+    
+    int32_t sum = 0;
+    for (uint8_t i = first; i < last; i++) {
+        sum += values[i];
+    }
+    
+    return sum / (last - first);
+}
+
 bool TouchManager::isIRQActive() {
     // Schneller GPIO-Check (keine SPI-Kommunikation!)
     // Touch IRQ ist LOW wenn Touch aktiv
@@ -209,14 +588,15 @@ bool TouchManager::getRawTouch(int16_t* x, int16_t* y, uint16_t* z) {
     const uint8_t SAMPLE_COUNT = 10;
     const uint16_t SAMPLE_DELAY_US = 100;
 
-    if (ts->touched()) {
-        TS_Point p = ts->getPoint();
-        
+    SpiBusGuard busGuard(busArbiter, SpiDevice::TOUCH);
+
+    TS_Point p = readPoint();
+    if (p.z >= XPT_Z_THRESHOLD) {
         int16_t bufferX[SAMPLE_COUNT] = {p.x};
         int16_t bufferY[SAMPLE_COUNT] = {p.y};
 
         for (uint8_t i = 0; i < SAMPLE_COUNT; i++) {
-            TS_Point p = ts->getPoint();
+            TS_Point p = readPoint();
             bufferX[i] = p.x;
             bufferY[i] = p.y;
             delayMicroseconds(SAMPLE_DELAY_US);
@@ -244,7 +624,6 @@ void TouchManager::setRotation(uint8_t rot) {
     rotation = rot % 4;  // 0-3
     
     if (isAvailable()) {
-        ts->setRotation(rotation);
         DEBUG_PRINTF("TouchManager: Rotation gesetzt: %d\n", rotation);
     }
     
@@ -258,6 +637,8 @@ void TouchManager::setRotation(uint8_t rot) {
         displayWidth = DISPLAY_WIDTH;
         displayHeight = DISPLAY_HEIGHT;
     }
+    
+    rebuildMapping();
 }
 
 // ═══════════════════════════════════════════════════════════════════════════
@@ -278,10 +659,30 @@ void TouchManager::loadCalibrationFromConfig(UserConfig* config) {
     calMaxY = config->getTouchMaxY();
     pressureThreshold = config->getTouchThreshold();
     
+    // Kaputte Werte (Hand-Edit, alte Firmware) würden in mapCoordinates überlaufen
+    if (!calibrationRangeValid(calMinX, calMaxX) || !calibrationRangeValid(calMinY, calMaxY)) {
+        DEBUG_PRINTF("TouchManager: ⚠️ Ungültige Kalibrierung X=%d-%d, Y=%d-%d → Standardwerte\n",
+                     calMinX, calMaxX, calMinY, calMaxY);
+        calMinX = TOUCH_MIN_X;
+        calMaxX = TOUCH_MAX_X;
+        calMinY = TOUCH_MIN_Y;
+        calMaxY = TOUCH_MAX_Y;
+    }
+    
+    affineValid = config->hasTouchAffine();
+    if (affineValid) {
+        config->getTouchAffine(affine);
+        if (!coeffsInRange(affine)) {
+            DEBUG_PRINTLN("TouchManager: ⚠️ Affin-Kalibrierung außerhalb Bereich → Min/Max");
+            affineValid = false;
+        }
+    }
+    
     calibrated = true;
+    rebuildMapping();
     
-    DEBUG_PRINTF("TouchManager: ✅ Kalibrierung geladen: X=%d-%d, Y=%d-%d, Threshold=%d\n",
-                 calMinX, calMaxX, calMinY, calMaxY, pressureThreshold);
+    DEBUG_PRINTF("TouchManager: ✅ Kalibrierung geladen: X=%d-%d, Y=%d-%d, Threshold=%d, Affin=%s\n",
+                 calMinX, calMaxX, calMinY, calMaxY, pressureThreshold, affineValid ? "ja" : "nein");
 }
 
 void TouchManager::saveCalibrationToConfig(UserConfig* config) {
@@ -295,19 +696,60 @@ void TouchManager::saveCalibrationToConfig(UserConfig* config) {
     config->setTouchCalibration(calMinX, calMaxX, calMinY, calMaxY);
     config->setTouchThreshold(pressureThreshold);
     
+    if (affineValid) {
+        config->setTouchAffine(affine);
+    } else if (config->hasTouchAffine()) {
+        config->clearTouchAffine();
+    }
+    
     DEBUG_PRINTLN("TouchManager: ✅ Kalibrierung gespeichert");
 }
 
-void TouchManager::setCalibration(int16_t minX, int16_t maxX, int16_t minY, int16_t maxY) {
+bool TouchManager::setCalibration(int16_t minX, int16_t maxX, int16_t minY, int16_t maxY) {
+    if (!calibrationRangeValid(minX, maxX) || !calibrationRangeValid(minY, maxY)) {
+        DEBUG_PRINTF("TouchManager: ❌ Kalibrierung X=%d-%d, Y=%d-%d ungültig (0-%d, Spanne >= %d)\n",
+                     minX, maxX, minY, maxY, RAW_MAX, TOUCH_CAL_MIN_SPAN);
+        return false;
+    }
+    
     calMinX = minX;
     calMaxX = maxX;
     calMinY = minY;
     calMaxY = maxY;
     calibrated = true;
+    rebuildMapping();
     
     DEBUG_PRINTLN("TouchManager: Kalibrierung gesetzt:");
     DEBUG_PRINTF("  X: %d - %d\n", calMinX, calMaxX);
     DEBUG_PRINTF("  Y: %d - %d\n", calMinY, calMaxY);
+    if (affineValid) {
+        DEBUG_PRINTLN("  (Affin-Kalibrierung aktiv - Min/Max nur als Fallback)");
+    }
+    return true;
+}
+
+bool TouchManager::setAffineCalibration(const int32_t coeffs[6]) {
+    if (!coeffsInRange(coeffs)) {
+        DEBUG_PRINTLN("TouchManager: ❌ Affin-Koeffizienten außerhalb Bereich");
+        return false;
+    }
+    
+    memcpy(affine, coeffs, sizeof(affine));
+    affineValid = true;
+    calibrated = true;
+    rebuildMapping();
+    
+    DEBUG_PRINTF("TouchManager: Affin-Kalibrierung gesetzt: A=%ld B=%ld C=%ld D=%ld E=%ld F=%ld\n",
+                 (long)affine[0], (long)affine[1], (long)affine[2],
+                 (long)affine[3], (long)affine[4], (long)affine[5]);
+    return true;
+}
+
+void TouchManager::clearAffineCalibration() {
+    affineValid = false;
+    rebuildMapping();
+    
+    DEBUG_PRINTLN("TouchManager: Affin-Kalibrierung verworfen (Min/Max aktiv)");
 }
 
 void TouchManager::getCalibration(int16_t* minX, int16_t* maxX, int16_t* minY, int16_t* maxY) {
@@ -322,6 +764,273 @@ void TouchManager::setThreshold(uint16_t threshold) {
     DEBUG_PRINTF("TouchManager: Schwellwert gesetzt: %d\n", pressureThreshold);
 }
 
+// ═══════════════════════════════════════════════════════════════════════════
+// AFFIN-KALIBRIERUNG
+// ═══════════════════════════════════════════════════════════════════════════
+
+void TouchManager::rebuildMapping() {
+    const int32_t w = DISPLAY_WIDTH - 1;
+    const int32_t h = DISPLAY_HEIGHT - 1;
+    
+    // Basis: Rohwerte → Display in Rotation 1 (Landscape)
+    int32_t base[6];
+    
+    if (affineValid) {
+        memcpy(base, affine, sizeof(base));
+    } else {
+        // Min/Max als Affin ohne Scherung
+        int32_t spanX = std::max<int32_t>(calMaxX - calMinX, 1);
+        int32_t spanY = std::max<int32_t>(calMaxY - calMinY, 1);
+        
+        base[0] = ((int64_t)w << 16) / spanX;
+        base[1] = 0;
+        base[2] = -base[0] * calMinX;
+        base[3] = 0;
+        base[4] = ((int64_t)h << 16) / spanY;
+        base[5] = -base[4] * calMinY;
+    }
+    
+    // Neue Abbildung lokal aufbauen, dann als Ganzes veröffentlichen
+    TouchMapping next;
+    next.width = displayWidth;
+    next.height = displayHeight;
+    
+    // Rotation einrechnen (entspricht XPT2046_Touchscreen::getPoint())
+    int32_t* m = next.coeffs;
+    switch (rotation) {
+        case 0:     // x = h - by, y = bx
+            m[0] = -base[3]; m[1] = -base[4]; m[2] = (h << 16) - base[5];
+            m[3] =  base[0]; m[4] =  base[1]; m[5] = base[2];
+            break;
+        case 2:     // x = by, y = w - bx
+            m[0] =  base[3]; m[1] =  base[4]; m[2] = base[5];
+            m[3] = -base[0]; m[4] = -base[1]; m[5] = (w << 16) - base[2];
+            break;
+        case 3:     // x = w - bx, y = h - by
+            m[0] = -base[0]; m[1] = -base[1]; m[2] = (w << 16) - base[2];
+            m[3] = -base[3]; m[4] = -base[4]; m[5] = (h << 16) - base[5];
+            break;
+        default:    // 1 = native Ausrichtung
+            memcpy(m, base, sizeof(base));
+            break;
+    }
+    
+    // Rundung statt Abschneiden beim >> 16
+    m[2] += 1L << 15;
+    m[5] += 1L << 15;
+    
+    // Eingaben sind geprüft, das hier ist nur das Sicherheitsnetz
+    if (!coeffsInRange(m)) {
+        DEBUG_PRINTLN("TouchManager: ❌ Abbildung außerhalb Bereich, alte bleibt aktiv");
+        return;
+    }
+    
+    // Sampling-Task liest in mapCoordinates() - nie eine halb geschriebene Abbildung
+    portENTER_CRITICAL(&mappingLock);
+    mapping = next;
+    portEXIT_CRITICAL(&mappingLock);
+}
+
+// Determinante einer 3x3-Matrix (zeilenweise)
+static double det3(const double m[3][3]) {
+    return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
+         - m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0])
+         + m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+}
+
+bool TouchManager::solveAffine(const int16_t* rawX, const int16_t* rawY,
+                               const int16_t* dispX, const int16_t* dispY,
+                               uint8_t count, int32_t coeffs[6]) {
+    if (count < 3) return false;
+    
+    // Normalgleichungen: (Mᵀ M) p = Mᵀ t mit Zeilen [rx, ry, 1]
+    double mtm[3][3] = {{0}};
+    double mtx[3] = {0};
+    double mty[3] = {0};
+    
+    for (uint8_t i = 0; i < count; i++) {
+        double row[3] = {(double)rawX[i], (double)rawY[i], 1.0};
+        for (uint8_t r = 0; r < 3; r++) {
+            for (uint8_t c = 0; c < 3; c++) {
+                mtm[r][c] += row[r] * row[c];
+            }
+            mtx[r] += row[r] * dispX[i];
+            mty[r] += row[r] * dispY[i];
+        }
+    }
+    
+    double det = det3(mtm);
+    if (fabs(det) < 1e-6) {
+        return false;  // Punkte kollinear
+    }
+    
+    // Cramersche Regel, je eine Lösung pro Achse
+    const double* rhs[2] = {mtx, mty};
+    for (uint8_t axis = 0; axis < 2; axis++) {
+        for (uint8_t col = 0; col < 3; col++) {
+            double m[3][3];
+            memcpy(m, mtm, sizeof(m));
+            for (uint8_t r = 0; r < 3; r++) {
+                m[r][col] = rhs[axis][r];
+            }
+            
+            double value = det3(m) / det * 65536.0;
+            int32_t limit = (col == 2) ? AFFINE_MAX_OFFSET : AFFINE_MAX_SCALE;
+            if (fabs(value) >= limit) {
+                return false;
+            }
+            coeffs[axis * 3 + col] = (int32_t)lround(value);
+        }
+    }
+    
+    return true;
+}
+
+bool TouchManager::readCalibrationPoint(int16_t* rawX, int16_t* rawY) {
+    unsigned long start = millis();
+    
+    // Erst loslassen (vorheriger Punkt), dann neuen Touch abwarten
+    while (isIRQActive()) {
+        if (millis() - start > TOUCH_CAL_TIMEOUT_MS) return false;
+        delay(10);
+    }
+    
+    int32_t sumX = 0;
+    int32_t sumY = 0;
+    uint8_t count = 0;
+    bool settled = false;
+    
+    while (count < TOUCH_CAL_SAMPLES) {
+        if (millis() - start > TOUCH_CAL_TIMEOUT_MS) return false;
+        
+        int16_t x, y;
+        uint16_t z;
+        if (isIRQActive() && getRawTouch(&x, &y, &z) && z >= pressureThreshold) {
+            // Erstes Sample nach dem Aufsetzen verwerfen (Finger rutscht noch)
+            if (!settled) {
+                settled = true;
+                delay(50);
+                continue;
+            }
+            sumX += x;
+            sumY += y;
+            count++;
+        }
+        delay(10);
+    }
+    
+    *rawX = sumX / count;
+    *rawY = sumY / count;
+    return true;
+}
+
+bool TouchManager::runCalibration(TFT_eSPI* tft, uint8_t points) {
+    if (!isAvailable() || tft == nullptr) {
+        DEBUG_PRINTLN("TouchManager: ⚠️ Kalibrierung ohne Touch/Display nicht möglich");
+        return false;
+    }
+    
+    const uint8_t MAX_POINTS = 5;
+    points = (points == 3) ? 3 : MAX_POINTS;
+    
+    const int16_t m = TOUCH_CAL_MARGIN;
+    const int16_t w = displayWidth;
+    const int16_t h = displayHeight;
+    
+    // Ziel-Punkte in Display-Koordinaten (aktuelle Rotation)
+    int16_t targetX[MAX_POINTS];
+    int16_t targetY[MAX_POINTS];
+    if (points == 3) {
+        const int16_t tx[3] = {m, (int16_t)(w - 1 - m), (int16_t)(w / 2)};
+        const int16_t ty[3] = {m, (int16_t)(h / 2), (int16_t)(h - 1 - m)};
+        memcpy(targetX, tx, sizeof(tx));
+        memcpy(targetY, ty, sizeof(ty));
+    } else {
+        const int16_t tx[5] = {m, (int16_t)(w - 1 - m), (int16_t)(w - 1 - m), m, (int16_t)(w / 2)};
+        const int16_t ty[5] = {m, m, (int16_t)(h - 1 - m), (int16_t)(h - 1 - m), (int16_t)(h / 2)};
+        memcpy(targetX, tx, sizeof(tx));
+        memcpy(targetY, ty, sizeof(ty));
+    }
+    
+    DEBUG_PRINTF("TouchManager: Starte %d-Punkt-Kalibrierung...\n", points);
+    
+    bool wasSampling = isSampling();
+    if (wasSampling) stopSampling();
+    
+    int16_t rawX[MAX_POINTS];
+    int16_t rawY[MAX_POINTS];
+    bool ok = true;
+    
+    for (uint8_t i = 0; i < points && ok; i++) {
+        {
+            SpiBusGuard busGuard(busArbiter, SpiDevice::DISPLAY);
+            tft->fillScreen(TFT_BLACK);
+            tft->drawFastHLine(targetX[i] - 12, targetY[i], 25, TFT_WHITE);
+            tft->drawFastVLine(targetX[i], targetY[i] - 12, 25, TFT_WHITE);
+            tft->drawCircle(targetX[i], targetY[i], 6, TFT_RED);
+            
+            tft->setTextColor(TFT_WHITE, TFT_BLACK);
+            tft->setTextDatum(MC_DATUM);
+            char text[32];
+            snprintf(text, sizeof(text), "Kreuz beruehren (%d/%d)", i + 1, points);
+            tft->drawString(text, w / 2, h / 2 + 40);
+        }
+        
+        ok = readCalibrationPoint(&rawX[i], &rawY[i]);
+        if (ok) {
+            DEBUG_PRINTF("  Punkt %d: Display (%d, %d) ← Roh (%d, %d)\n",
+                         i + 1, targetX[i], targetY[i], rawX[i], rawY[i]);
+        }
+    }
+    
+    {
+        SpiBusGuard busGuard(busArbiter, SpiDevice::DISPLAY);
+        tft->fillScreen(TFT_BLACK);
+    }
+    
+    if (!ok) {
+        DEBUG_PRINTLN("TouchManager: ❌ Kalibrierung abgebrochen (Timeout)");
+    } else {
+        // Ziele in Rotation 1 zurückrechnen (Inverse zu rebuildMapping)
+        const int16_t bw = DISPLAY_WIDTH - 1;
+        const int16_t bh = DISPLAY_HEIGHT - 1;
+        int16_t baseX[MAX_POINTS];
+        int16_t baseY[MAX_POINTS];
+        for (uint8_t i = 0; i < points; i++) {
+            switch (rotation) {
+                case 0:  baseX[i] = targetY[i];      baseY[i] = bh - targetX[i]; break;
+                case 2:  baseX[i] = bw - targetY[i]; baseY[i] = targetX[i];      break;
+                case 3:  baseX[i] = bw - targetX[i]; baseY[i] = bh - targetY[i]; break;
+                default: baseX[i] = targetX[i];      baseY[i] = targetY[i];      break;
+            }
+        }
+        
+        int32_t coeffs[6];
+        ok = solveAffine(rawX, rawY, baseX, baseY, points, coeffs);
+        
+        if (!ok) {
+            DEBUG_PRINTLN("TouchManager: ❌ Kalibrierung fehlgeschlagen (Punkte degeneriert)");
+        } else if (!(ok = setAffineCalibration(coeffs))) {
+            DEBUG_PRINTLN("TouchManager: ❌ Kalibrierung verworfen, alte bleibt aktiv");
+        } else {
+            
+            // Restfehler über die fertige Abbildung (bei 3 Punkten ~0)
+            float sumSq = 0;
+            for (uint8_t i = 0; i < points; i++) {
+                int16_t x, y;
+                mapCoordinates(rawX[i], rawY[i], &x, &y);
+                sumSq += (x - targetX[i]) * (x - targetX[i]) + (y - targetY[i]) * (y - targetY[i]);
+            }
+            DEBUG_PRINTF("TouchManager: ✅ Kalibrierung übernommen (Restfehler %.2f px RMS)\n",
+                         sqrtf(sumSq / points));
+        }
+    }
+    
+    if (wasSampling) startSampling();
+    
+    return ok;
+}
+
 // ═══════════════════════════════════════════════════════════════════════════
 // HELPER
 // ═══════════════════════════════════════════════════════════════════════════
@@ -366,25 +1075,44 @@ void TouchManager::printTouchInfo() {
         DEBUG_PRINTF("Zeit:    %lu ms\n", currentPoint.timestamp);
     }
     
-    DEBUG_PRINTF("\nRotation: %d\n", rotation);
+    DEBUG_PRINTF("\nModus:    %s\n", isSampling() ? "IRQ-Sampling-Task" : "Polling");
+    if (isSampling()) {
+        DEBUG_PRINTF("Queue:    %d pending, %lu verworfen\n",
+                     uxQueueMessagesWaiting(eventQueue), droppedEvents);
+        DEBUG_PRINTF("Bus:      %lu Bursts wegen Timeout wiederholt\n", busyBursts);
+    }
+    DEBUG_PRINTF("Rotation: %d\n", rotation);
     DEBUG_PRINTF("Display:  %dx%d\n", displayWidth, displayHeight);
     DEBUG_PRINTF("Schwelle: %d\n", pressureThreshold);
-    DEBUG_PRINTF("Kalibrierung:\n");
+    DEBUG_PRINTF("Kalibrierung: %s\n", affineValid ? "Affin" : "Min/Max");
     DEBUG_PRINTF("  X: %d - %d\n", calMinX, calMaxX);
     DEBUG_PRINTF("  Y: %d - %d\n", calMinY, calMaxY);
+    DEBUG_PRINTF("Mapping (Q16):\n");
+    const int32_t* m = mapping.coeffs;     // Nur loop() schreibt → ohne Lock lesbar
+    DEBUG_PRINTF("  x = %ld*rx + %ld*ry + %ld\n", (long)m[0], (long)m[1], (long)m[2]);
+    DEBUG_PRINTF("  y = %ld*rx + %ld*ry + %ld\n", (long)m[3], (long)m[4], (long)m[5]);
     
     DEBUG_PRINTLN("═══════════════════════════════════════\n");
 }
 
 void TouchManager::mapCoordinates(int16_t rawX, int16_t rawY, int16_t* mappedX, int16_t* mappedY) {
-    // Auf Display-Koordinaten mappen
-    int16_t x = map(rawX, calMinX, calMaxX, 0, displayWidth - 1);
-    int16_t y = map(rawY, calMinY, calMaxY, 0, displayHeight - 1);
+    // Konsistente Kopie (loop() kann gerade neu kalibrieren)
+    portENTER_CRITICAL(&mappingLock);
+    TouchMapping m = mapping;
+    portEXIT_CRITICAL(&mappingLock);
     
-    // Auf gültigen Bereich begrenzen
-    x = constrain(x, 0, displayWidth - 1);
-    y = constrain(y, 0, displayHeight - 1);
+    // Rohwerte begrenzen - nur dafür sind die Koeffizienten-Grenzen überlauffrei
+    rawX = std::min<int16_t>(std::max<int16_t>(rawX, 0), RAW_MAX);
+    rawY = std::min<int16_t>(std::max<int16_t>(rawY, 0), RAW_MAX);
+    
+    // Vorberechnete Affin-Abbildung (Rotation + Rundung bereits enthalten)
+    int32_t x = (m.coeffs[0] * rawX + m.coeffs[1] * rawY + m.coeffs[2]) >> 16;
+    int32_t y = (m.coeffs[3] * rawX + m.coeffs[4] * rawY + m.coeffs[5]) >> 16;
+    
+    // Begrenzen ohne Sprünge (min/max → MIN/MAX-Befehle)
+    x = std::min<int32_t>(std::max<int32_t>(x, 0), m.width - 1);
+    y = std::min<int32_t>(std::max<int32_t>(y, 0), m.height - 1);
     
     if (mappedX != nullptr) *mappedX = x;
     if (mappedY != nullptr) *mappedY = y;
-}
\ No newline at end of file
+}
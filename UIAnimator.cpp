@@ -0,0 +1,222 @@
+/**
+ * UIAnimator.cpp
+ */
+
+#include "include/UIAnimator.h"
+#include "include/UIElement.h"
+#include "include/UIContainer.h"
+
+UIAnimator::UIAnimator()
+    : nextId(1), activeCount(0), completed(0) {
+    for (auto& tween : tweens) {
+        tween.id = 0;
+        tween.owner = nullptr;
+    }
+}
+
+UIAnimator::~UIAnimator() {
+    cancelAll();
+}
+
+// ═══════════════════════════════════════════════════════════════
+// TWEENS STARTEN
+// ═══════════════════════════════════════════════════════════════
+
+TweenId UIAnimator::animate(uint32_t durationMs, Easing easing, TweenStep step,
+                            UIElement* owner, TweenDone done) {
+    Tween* tween = start(durationMs, easing, step, owner, done);
+    return tween ? tween->id : 0;
+}
+
+TweenId UIAnimator::animateValue(int32_t from, int32_t to, uint32_t durationMs, Easing easing,
+                                 std::function<void(int32_t value)> setter,
+                                 UIElement* owner, TweenDone done) {
+    if (!setter) return 0;
+
+    return animate(durationMs, easing, [from, to, setter](float t) {
+        setter(from + (int32_t)lroundf((to - from) * t));
+    }, owner, done);
+}
+
+TweenId UIAnimator::animateColor(uint16_t from, uint16_t to, uint32_t durationMs, Easing easing,
+                                 std::function<void(uint16_t color)> setter,
+                                 UIElement* owner, TweenDone done) {
+    if (!setter) return 0;
+
+    return animate(durationMs, easing, [from, to, setter](float t) {
+        setter(lerpColor(from, to, t));
+    }, owner, done);
+}
+
+TweenId UIAnimator::moveTo(UIElement* element, int16_t x, int16_t y, uint32_t durationMs,
+                           Easing easing, TweenDone done) {
+    if (!element) return 0;
+
+    // Laufende Bewegung ersetzen (neue startet an der aktuellen Position)
+    for (auto& tween : tweens) {
+        if (tween.id != 0 && tween.move && tween.owner == element) release(tween);
+    }
+
+    int16_t fromX, fromY, w, h;
+    element->getBounds(&fromX, &fromY, &w, &h);
+
+    Tween* tween = start(durationMs, easing, [element, fromX, fromY, x, y](float t) {
+        element->setPosition(fromX + (int16_t)lroundf((x - fromX) * t),
+                             fromY + (int16_t)lroundf((y - fromY) * t));
+    }, element, done);
+    if (!tween) return 0;
+
+    tween->move = true;
+    return tween->id;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// ABBRECHEN
+// ═══════════════════════════════════════════════════════════════
+
+void UIAnimator::cancel(TweenId id) {
+    if (id == 0) return;
+
+    for (auto& tween : tweens) {
+        if (tween.id == id) {
+            release(tween);
+            return;
+        }
+    }
+}
+
+void UIAnimator::cancelSubtree(UIElement* subtree) {
+    if (!subtree) return;
+
+    for (auto& tween : tweens) {
+        if (tween.id == 0 || !tween.owner) continue;
+
+        // Owner selbst oder Nachfahre (entfernter Container)
+        for (UIElement* node = tween.owner; node; node = node->getParent()) {
+            if (node == subtree) {
+                release(tween);
+                break;
+            }
+        }
+    }
+}
+
+void UIAnimator::cancelAll() {
+    for (auto& tween : tweens) {
+        if (tween.id != 0) release(tween);
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════
+// FORTSCHRITT
+// ═══════════════════════════════════════════════════════════════
+
+void UIAnimator::update(uint32_t nowMs) {
+    if (activeCount == 0) return;
+
+    for (auto& tween : tweens) {
+        if (tween.id == 0) continue;
+
+        uint32_t elapsed = nowMs - tween.startMs;
+        bool finished = elapsed >= tween.durationMs;
+        float t = finished ? 1.0f : (float)elapsed / (float)tween.durationMs;
+
+        // Schritt darf andere Tweens abbrechen/starten, nicht den eigenen
+        TweenId id = tween.id;
+        tween.step(ease(tween.easing, t));
+
+        // Slot kann im Schritt abgebrochen/neu belegt worden sein
+        if (!finished || tween.id != id) continue;
+
+        // Slot vor dem Callback freigeben (done darf neue Tweens starten)
+        TweenDone done = std::move(tween.done);
+        release(tween);
+        completed++;
+        if (done) done();
+    }
+}
+
+bool UIAnimator::isRunning(TweenId id) const {
+    if (id == 0) return false;
+
+    for (const auto& tween : tweens) {
+        if (tween.id == id) return true;
+    }
+    return false;
+}
+
+float UIAnimator::ease(Easing easing, float t) {
+    if (t <= 0.0f) return 0.0f;
+    if (t >= 1.0f) return 1.0f;
+
+    switch (easing) {
+        case Easing::EASE_IN:
+            return t * t;
+        case Easing::EASE_OUT:
+            return t * (2.0f - t);
+        case Easing::EASE_IN_OUT:
+            if (t < 0.5f) return 4.0f * t * t * t;
+            t = 2.0f * t - 2.0f;
+            return 0.5f * t * t * t + 1.0f;
+        case Easing::LINEAR:
+        default:
+            return t;
+    }
+}
+
+uint16_t UIAnimator::lerpColor(uint16_t from, uint16_t to, float t) {
+    // RGB565: 5/6/5 Bit pro Kanal getrennt interpolieren
+    int32_t r0 = (from >> 11) & 0x1F, g0 = (from >> 5) & 0x3F, b0 = from & 0x1F;
+    int32_t r1 = (to >> 11) & 0x1F,   g1 = (to >> 5) & 0x3F,   b1 = to & 0x1F;
+
+    int32_t r = r0 + (int32_t)lroundf((r1 - r0) * t);
+    int32_t g = g0 + (int32_t)lroundf((g1 - g0) * t);
+    int32_t b = b0 + (int32_t)lroundf((b1 - b0) * t);
+
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+// ═══════════════════════════════════════════════════════════════
+// POOL
+// ═══════════════════════════════════════════════════════════════
+
+UIAnimator::Tween* UIAnimator::start(uint32_t durationMs, Easing easing, TweenStep step,
+                                     UIElement* owner, TweenDone done) {
+    if (!step) return nullptr;
+
+    Tween* tween = allocate();
+    if (!tween) {
+        Serial.println("UIAnimator: ⚠️ Kein freier Tween-Slot (UI_ANIM_MAX_TWEENS)");
+        return nullptr;
+    }
+
+    tween->owner = owner;
+    tween->move = false;
+    tween->startMs = millis();
+    tween->durationMs = durationMs;
+    tween->easing = easing;
+    tween->step = step;
+    tween->done = done;
+    return tween;
+}
+
+UIAnimator::Tween* UIAnimator::allocate() {
+    for (auto& tween : tweens) {
+        if (tween.id != 0) continue;
+
+        tween.id = nextId++;
+        if (nextId == 0) nextId = 1;
+        activeCount++;
+        return &tween;
+    }
+    return nullptr;
+}
+
+void UIAnimator::release(Tween& tween) {
+    tween.id = 0;
+    tween.owner = nullptr;
+    tween.move = false;
+    tween.step = nullptr;
+    tween.done = nullptr;
+    activeCount--;
+}
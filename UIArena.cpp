@@ -0,0 +1,141 @@
+/**
+ * UIArena.cpp
+ */
+
+#include "include/UIArena.h"
+#include <esp_heap_caps.h>
+
+UIArena* UIArena::firstArena = nullptr;
+
+UIArena::UIArena(const char* name, size_t chunkSize, bool usePsram)
+    : name(name), chunkSize(chunkSize), usePsram(usePsram),
+      chunks(nullptr), destructors(nullptr),
+      used(0), capacity(0), peak(0), chunkCount(0), psramChunks(0), objectCount(0),
+      nextArena(firstArena) {
+
+    firstArena = this;
+}
+
+UIArena::~UIArena() {
+    reset();
+
+    // Aus der Verkettung lösen
+    for (UIArena** link = &firstArena; *link; link = &(*link)->nextArena) {
+        if (*link == this) {
+            *link = nextArena;
+            break;
+        }
+    }
+}
+
+void* UIArena::allocate(size_t size, size_t align) {
+    if (size == 0) size = 1;
+
+    for (int attempt = 0; attempt < 2; attempt++) {
+        Chunk* chunk = chunks;
+
+        if (chunk) {
+            // Ausrichtung auf die absolute Adresse (Block-Anfang ist nur 4-Byte-ausgerichtet)
+            uintptr_t base = reinterpret_cast<uintptr_t>(chunk + 1);
+            uintptr_t start = (base + chunk->offset + align - 1) & ~(uintptr_t)(align - 1);
+            size_t end = (start - base) + size;
+
+            if (end <= chunk->size) {
+                used += end - chunk->offset;
+                if (used > peak) peak = used;
+                chunk->offset = end;
+                return reinterpret_cast<void*>(start);
+            }
+        }
+
+        // Passt nicht mehr → neuer Block (Rest des alten bleibt Verschnitt)
+        if (!addChunk(size + align)) return nullptr;
+    }
+    return nullptr;
+}
+
+char* UIArena::duplicate(const char* text) {
+    if (!text) return nullptr;
+
+    size_t length = strlen(text) + 1;
+    char* copy = static_cast<char*>(allocate(length, 1));
+    if (copy) memcpy(copy, text, length);
+    return copy;
+}
+
+void UIArena::reset() {
+    // Zuletzt angelegte Objekte zuerst (können auf frühere verweisen)
+    while (destructors) {
+        Destructor* record = destructors;
+        destructors = record->next;
+        record->destroy(record->object);
+    }
+
+    while (chunks) {
+        Chunk* chunk = chunks;
+        chunks = chunk->next;
+        free(chunk);
+    }
+
+    used = 0;
+    capacity = 0;
+    chunkCount = 0;
+    psramChunks = 0;
+    objectCount = 0;
+}
+
+UIArena::Chunk* UIArena::addChunk(size_t minSize) {
+    size_t size = max(chunkSize, minSize);
+    void* memory = nullptr;
+    bool psram = false;
+
+    if (usePsram && psramFound()) {
+        memory = heap_caps_malloc(sizeof(Chunk) + size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        psram = (memory != nullptr);
+    }
+    if (!memory) {
+        memory = malloc(sizeof(Chunk) + size);
+    }
+    if (!memory) {
+        Serial.printf("UIArena '%s': ❌ Kein Speicher für Block (%u Byte)\n", name, (unsigned)size);
+        return nullptr;
+    }
+
+    Chunk* chunk = static_cast<Chunk*>(memory);
+    chunk->next = chunks;
+    chunk->size = size;
+    chunk->offset = 0;
+    chunk->psram = psram;
+    chunks = chunk;
+
+    capacity += size;
+    chunkCount++;
+    if (psram) psramChunks++;
+    return chunk;
+}
+
+void UIArena::printStats() const {
+    Serial.printf("  %-16s %6u / %6u Byte (Peak %6u), %2d Objekte, %d Block%s, %s\n",
+                  name, (unsigned)used, (unsigned)capacity, (unsigned)peak, objectCount,
+                  chunkCount, chunkCount == 1 ? "" : "e",
+                  chunkCount == 0 ? "leer" : (psramChunks == chunkCount ? "PSRAM" :
+                                              (psramChunks == 0 ? "intern" : "gemischt")));
+}
+
+void UIArena::printAll() {
+    size_t totalUsed = 0;
+    size_t totalCapacity = 0;
+
+    Serial.println("\n=== UI-Arenen ===");
+    for (UIArena* arena = firstArena; arena; arena = arena->nextArena) {
+        arena->printStats();
+        totalUsed += arena->used;
+        totalCapacity += arena->capacity;
+    }
+    Serial.printf("Summe:           %u / %u Byte\n", (unsigned)totalUsed, (unsigned)totalCapacity);
+    Serial.printf("Interner Heap:   %u Byte frei (größter Block %u)\n",
+                  (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+                  (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL));
+    Serial.printf("PSRAM:           %u Byte frei\n", (unsigned)heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+    Serial.println("=================\n");
+}
@@ -10,9 +10,7 @@ UIButton::UIButton(int16_t x, int16_t y, int16_t w, int16_t h, const char* txt)
     strncpy(text, txt, sizeof(text) - 1);
     text[sizeof(text) - 1] = '\0';
     
-    normalColor = COLOR_BLUE;
-    pressedColor = COLOR_DARKGRAY;
-    style.bgColor = normalColor;
+    setStyleRole(StyleRole::BUTTON);
 }
 
 UIButton::~UIButton() {
@@ -71,6 +69,12 @@ void UIButton::handleTouch(int16_t tx, int16_t ty, bool isPressed) {
     wasInside = inside;
 }
 
+void UIButton::measure(int16_t* outW, int16_t* outH) {
+    // GLCD Font 1 (6x8, skaliert) + Innenabstand
+    if (outW) *outW = strlen(text) * 6 * fontSize + 24;
+    if (outH) *outH = 8 * fontSize + 16;
+}
+
 void UIButton::setText(const char* txt) {
     strncpy(text, txt, sizeof(text) - 1);
     text[sizeof(text) - 1] = '\0';
@@ -78,13 +82,16 @@ void UIButton::setText(const char* txt) {
 }
 
 void UIButton::setTextColor(uint16_t color) {
-    style.textColor = color;
-    needsRedraw = true;
+    setStyleField(STYLE_TEXT, color);
 }
 
 void UIButton::setPressedColor(uint16_t color) {
-    pressedColor = color;
-    needsRedraw = true;
+    setStyleField(STYLE_PRESSED_BG, color);
+}
+
+StyleState UIButton::getStyleState() const {
+    if (!enabled) return StyleState::DISABLED;
+    return pressed ? StyleState::PRESSED : StyleState::NORMAL;
 }
 
 void UIButton::setFontSize(uint8_t size) {
@@ -95,21 +102,19 @@ void UIButton::setFontSize(uint8_t size) {
 }
 
 void UIButton::drawButton(TFT_eSPI* tft, bool isPressed) {
+    // Vorberechnete Variante (gedrückt / deaktiviert)
+    StyleState state = !enabled ? StyleState::DISABLED : (isPressed ? StyleState::PRESSED : StyleState::NORMAL);
+    const ElementStyle& st = UITheme::get(styleId, state);
+    
     // Hintergrund
-    uint16_t bgColor = isPressed ? pressedColor : normalColor;
-
-    fillRoundRect(tft, x, y, width, height, style.cornerRadius, bgColor);
+    fillRoundRect(tft, x, y, width, height, st.cornerRadius, st.bgColor);
     
     // Rahmen
-    if (!enabled) {
-        drawRoundRect(tft, x, y, width, height, style.cornerRadius, COLOR_GRAY);
-    } else {
-        drawRoundRect(tft, x, y, width, height, style.cornerRadius, style.borderColor);
-    }
+    drawRoundRect(tft, x, y, width, height, st.cornerRadius, st.borderColor);
     
     // Text zentriert
     tft->setTextDatum(MC_DATUM);
     tft->setTextSize(fontSize);  // ← Font-Größe verwenden
-    tft->setTextColor(enabled ? style.textColor : COLOR_GRAY);
+    tft->setTextColor(st.textColor);
     tft->drawString(text, x + width / 2, y + height / 2);
 }
\ No newline at end of file
@@ -6,16 +6,12 @@
 
 UICheckBox::UICheckBox(int16_t x, int16_t y, int16_t size, const char* lbl)
     : UIElement(x, y, size + 5 + 150, size), checked(false), wasInside(false),
-      checkColor(COLOR_GREEN), boxSize(size) {
+      boxSize(size) {
     
     strncpy(label, lbl, sizeof(label) - 1);
     label[sizeof(label) - 1] = '\0';
     
-    style.bgColor = COLOR_BLACK;
-    style.borderColor = COLOR_WHITE;
-    style.textColor = COLOR_WHITE;
-    style.borderWidth = 2;
-    style.cornerRadius = 3;
+    setStyleRole(StyleRole::CHECKBOX);
 }
 
 UICheckBox::~UICheckBox() {
@@ -77,40 +73,36 @@ void UICheckBox::setLabel(const char* lbl) {
 }
 
 void UICheckBox::setCheckColor(uint16_t color) {
-    checkColor = color;
-    needsRedraw = true;
+    setStyleField(STYLE_ACCENT, color);
 }
 
 void UICheckBox::drawCheckBox(TFT_eSPI* tft) {
     // Box zeichnen
     int16_t boxX = x;
     int16_t boxY = y;
+    const ElementStyle& st = style();   // Deaktiviert: grauer Rahmen + Text
     
     // Hintergrund
-    fillRoundRect(tft, boxX, boxY, boxSize, boxSize, style.cornerRadius, style.bgColor);
+    fillRoundRect(tft, boxX, boxY, boxSize, boxSize, st.cornerRadius, st.bgColor);
     
-    // Rahmen (dicker wenn enabled)
-    if (enabled) {
-        drawRoundRect(tft, boxX, boxY, boxSize, boxSize, style.cornerRadius, style.borderColor);
-    } else {
-        drawRoundRect(tft, boxX, boxY, boxSize, boxSize, style.cornerRadius, COLOR_GRAY);
-    }
+    // Rahmen
+    drawRoundRect(tft, boxX, boxY, boxSize, boxSize, st.cornerRadius, st.borderColor);
     
     // Häkchen wenn checked
     if (checked) {
-        drawCheckMark(tft, boxX, boxY, boxSize);
+        drawCheckMark(tft, boxX, boxY, boxSize, st.accentColor);
     }
     
     // Label rechts neben der Box
     if (strlen(label) > 0) {
         tft->setTextDatum(ML_DATUM);
-        tft->setTextColor(enabled ? style.textColor : COLOR_GRAY);
+        tft->setTextColor(st.textColor);
         tft->setTextSize(2);
         tft->drawString(label, boxX + boxSize + 5, boxY + boxSize / 2);
     }
 }
 
-void UICheckBox::drawCheckMark(TFT_eSPI* tft, int16_t bx, int16_t by, int16_t size) {
+void UICheckBox::drawCheckMark(TFT_eSPI* tft, int16_t bx, int16_t by, int16_t size, uint16_t checkColor) {
     // Häkchen-Form zeichnen
     int16_t margin = size / 4;
     int16_t cx = bx + margin;
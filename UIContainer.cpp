@@ -0,0 +1,88 @@
+/**
+ * UIContainer.cpp
+ */
+
+#include "include/UIContainer.h"
+#include <algorithm>
+
+UIContainer::UIContainer(int16_t x, int16_t y, int16_t w, int16_t h)
+    : UIElement(x, y, w, h), clipChildren(false), hasBackground(false) {
+
+    setStyleRole(StyleRole::CONTAINER);
+}
+
+UIContainer::~UIContainer() {
+    clearChildren();
+}
+
+void UIContainer::draw(TFT_eSPI* tft) {
+    if (!visible) return;
+
+    // Transparent: Compositor hat den Hintergrund bereits gefüllt
+    if (hasBackground) {
+        tft->fillRect(x, y, width, height, style().bgColor);
+    }
+    needsRedraw = false;
+}
+
+void UIContainer::handleTouch(int16_t tx, int16_t ty, bool isPressed) {
+    // Nur Kinder sind berührbar
+}
+
+void UIContainer::addChild(UIElement* child) {
+    if (!child || child == this) return;
+
+    if (child->getParent()) {
+        child->getParent()->removeChild(child);
+    }
+
+    // Hinter dem letzten Kind mit gleicher oder kleinerer Z-Order einfügen
+    auto pos = children.end();
+    while (pos != children.begin() && (*(pos - 1))->getZOrder() > child->getZOrder()) {
+        --pos;
+    }
+    children.insert(pos, child);
+
+    child->setParent(this);
+    child->setNeedsRedraw(true);
+}
+
+bool UIContainer::removeChild(UIElement* child) {
+    for (auto it = children.begin(); it != children.end(); ++it) {
+        if (*it == child) {
+            children.erase(it);
+            child->setParent(nullptr);
+            return true;
+        }
+    }
+    return false;
+}
+
+void UIContainer::clearChildren() {
+    for (auto* child : children) {
+        child->setParent(nullptr);
+    }
+    children.clear();
+}
+
+void UIContainer::sortChildren() {
+    std::stable_sort(children.begin(), children.end(), [](UIElement* a, UIElement* b) {
+        return a->getZOrder() < b->getZOrder();
+    });
+}
+
+void UIContainer::setClipChildren(bool clip) {
+    if (clipChildren == clip) return;
+
+    clipChildren = clip;
+    needsRedraw = true;
+    geometryRevision++;
+}
+
+void UIContainer::setBackground(uint16_t color) {
+    if (hasBackground && style().bgColor == color) return;
+
+    setStyleField(STYLE_BG, color);
+    hasBackground = true;
+    needsRedraw = true;
+}
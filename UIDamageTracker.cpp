@@ -0,0 +1,130 @@
+/**
+ * UIDamageTracker.cpp
+ */
+
+#include "include/UIDamageTracker.h"
+
+UIDamageTracker::UIDamageTracker()
+    : count(0) {
+}
+
+UIDamageTracker::~UIDamageTracker() {
+}
+
+void UIDamageTracker::add(int16_t x, int16_t y, int16_t w, int16_t h, bool clearBackground, uint16_t firstElement) {
+    int16_t cx, cy, cw, ch;
+    if (!intersect(x, y, w, h, 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, &cx, &cy, &cw, &ch)) {
+        return;
+    }
+
+    // Gelöschter Hintergrund → auch alle Elemente darunter neu zeichnen
+    rects[count++] = {cx, cy, cw, ch, clearBackground, clearBackground ? (uint16_t)0 : firstElement};
+
+    if (count <= UI_DAMAGE_MAX_RECTS) return;
+
+    // Limit überschritten → Paar mit dem geringsten Flächenzuwachs vereinigen
+    uint8_t bestI = 0, bestJ = 1;
+    uint32_t bestGrowth = UINT32_MAX;
+
+    for (uint8_t i = 0; i < count; i++) {
+        for (uint8_t j = i + 1; j < count; j++) {
+            uint32_t united = unite(rects[i], rects[j]).area();
+            uint32_t sum = rects[i].area() + rects[j].area();
+            uint32_t growth = united > sum ? united - sum : 0;
+            if (growth < bestGrowth) {
+                bestGrowth = growth;
+                bestI = i;
+                bestJ = j;
+            }
+        }
+    }
+
+    rects[bestI] = unite(rects[bestI], rects[bestJ]);
+    removeAt(bestJ);
+}
+
+void UIDamageTracker::merge() {
+    bool changed = true;
+
+    while (changed) {
+        changed = false;
+
+        for (uint8_t i = 0; i < count && !changed; i++) {
+            for (uint8_t j = i + 1; j < count; j++) {
+                const DamageRect& a = rects[i];
+                const DamageRect& b = rects[j];
+
+                // Überlappung immer vereinigen (sonst doppelt gezeichnet),
+                // benachbarte nur wenn wenig Fläche verschwendet wird und
+                // kein zusätzlicher Hintergrund gelöscht werden muss
+                bool merge = overlaps(a, b);
+                if (!merge && a.clearBackground == b.clearBackground) {
+                    uint32_t sum = a.area() + b.area();
+                    merge = unite(a, b).area() * 100 <= sum * (100 + UI_DAMAGE_MERGE_WASTE);
+                }
+
+                if (merge) {
+                    rects[i] = unite(a, b);
+                    removeAt(j);
+                    changed = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void UIDamageTracker::defer(uint8_t processed) {
+    if (processed >= count) {
+        count = 0;
+        return;
+    }
+
+    uint8_t remaining = count - processed;
+    for (uint8_t i = 0; i < remaining; i++) {
+        rects[i] = rects[processed + i];
+        rects[i].clearBackground = true;
+        rects[i].firstElement = 0;
+    }
+    count = remaining;
+}
+
+bool UIDamageTracker::intersect(int16_t ax, int16_t ay, int16_t aw, int16_t ah,
+                                int16_t bx, int16_t by, int16_t bw, int16_t bh,
+                                int16_t* ox, int16_t* oy, int16_t* ow, int16_t* oh) {
+    int16_t x0 = max(ax, bx);
+    int16_t y0 = max(ay, by);
+    int16_t x1 = min((int16_t)(ax + aw), (int16_t)(bx + bw));
+    int16_t y1 = min((int16_t)(ay + ah), (int16_t)(by + bh));
+
+    if (x1 <= x0 || y1 <= y0) return false;
+
+    *ox = x0;
+    *oy = y0;
+    *ow = x1 - x0;
+    *oh = y1 - y0;
+    return true;
+}
+
+DamageRect UIDamageTracker::unite(const DamageRect& a, const DamageRect& b) {
+    int16_t x0 = min(a.x, b.x);
+    int16_t y0 = min(a.y, b.y);
+    int16_t x1 = max((int16_t)(a.x + a.w), (int16_t)(b.x + b.w));
+    int16_t y1 = max((int16_t)(a.y + a.h), (int16_t)(b.y + b.h));
+
+    return {x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0),
+            (bool)(a.clearBackground || b.clearBackground),
+            min(a.firstElement, b.firstElement)};
+}
+
+bool UIDamageTracker::overlaps(const DamageRect& a, const DamageRect& b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w &&
+           a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+void UIDamageTracker::removeAt(uint8_t index) {
+    for (uint8_t i = index; i + 1 < count; i++) {
+        rects[i] = rects[i + 1];
+    }
+    count--;
+}
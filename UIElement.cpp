@@ -3,34 +3,74 @@
  */
 
 #include "include/UIElement.h"
+#include "include/UIContainer.h"
+#include "include/UISurface.h"
+
+uint32_t UIElement::geometryRevision = 0;
 
 UIElement::UIElement(int16_t x, int16_t y, int16_t w, int16_t h)
     : x(x), y(y), width(w), height(h),
       visible(true), enabled(true), touched(false), needsRedraw(true),
-      ownerPage(nullptr),
+      painted(false), paintedX(0), paintedY(0), paintedW(0), paintedH(0),
+      styleId(UITheme::forRole(StyleRole::ELEMENT)),
+      parent(nullptr), zOrder(0),
+      clipped(false), clipX(0), clipY(0), clipW(0), clipH(0),
       lastTouchX(0), lastTouchY(0) {
     
-    // Standard-Style
-    style.bgColor = COLOR_DARKGRAY;
-    style.borderColor = COLOR_WHITE;
-    style.textColor = COLOR_WHITE;
-    style.borderWidth = 2;
-    style.cornerRadius = 5;
+    resetPerf();
 }
 
 UIElement::~UIElement() {
+    UITheme::release(styleId);
 }
 
 bool UIElement::isPointInside(int16_t px, int16_t py) {
+    if (clipped && (px < clipX || px >= clipX + clipW || py < clipY || py >= clipY + clipH)) {
+        return false;
+    }
     return (px >= x && px < (x + width) && 
             py >= y && py < (y + height));
 }
 
+bool UIElement::isShown() const {
+    if (!visible) return false;
+    
+    for (const UIContainer* node = parent; node; node = node->getParent()) {
+        if (!node->isVisible()) return false;
+    }
+    return true;
+}
+
+void UIElement::setZOrder(int16_t z) {
+    if (zOrder == z) return;
+    
+    zOrder = z;
+    if (parent) parent->sortChildren();
+    needsRedraw = true;
+    geometryRevision++;
+}
+
+void UIElement::setClipRect(int16_t cx, int16_t cy, int16_t cw, int16_t ch) {
+    clipped = true;
+    clipX = cx;
+    clipY = cy;
+    clipW = cw;
+    clipH = ch;
+}
+
+void UIElement::getClipRect(int16_t* outX, int16_t* outY, int16_t* outW, int16_t* outH) const {
+    if (outX) *outX = clipX;
+    if (outY) *outY = clipY;
+    if (outW) *outW = clipW;
+    if (outH) *outH = clipH;
+}
+
 void UIElement::setPosition(int16_t newX, int16_t newY) {
     if (x != newX || y != newY) {
         x = newX;
         y = newY;
         needsRedraw = true;
+        geometryRevision++;
     }
 }
 
@@ -39,6 +79,7 @@ void UIElement::setSize(int16_t w, int16_t h) {
         width = w;
         height = h;
         needsRedraw = true;
+        geometryRevision++;
     }
 }
 
@@ -49,6 +90,7 @@ void UIElement::setBounds(int16_t newX, int16_t newY, int16_t w, int16_t h) {
         width = w;
         height = h;
         needsRedraw = true;
+        geometryRevision++;
     }
 }
 
@@ -56,6 +98,7 @@ void UIElement::setVisible(bool vis) {
     if (visible != vis) {
         visible = vis;
         needsRedraw = true;
+        geometryRevision++;
     }
 }
 
@@ -67,18 +110,45 @@ void UIElement::setEnabled(bool en) {
 }
 
 void UIElement::setStyle(ElementStyle newStyle) {
-    style = newStyle;
+    styleId = UITheme::setAll(styleId, newStyle);
+    onStyleChanged();
+}
+
+void UIElement::setStyleRole(StyleRole role) {
+    if (styleId == UITheme::forRole(role)) return;
+    
+    styleId = UITheme::setRole(styleId, role);
+    onStyleChanged();
+}
+
+void UIElement::setStyleField(StyleField field, uint16_t value) {
+    StyleId next = UITheme::setField(styleId, field, value);
+    if (next == styleId) return;
+    
+    styleId = next;
+    onStyleChanged();
+}
+
+void UIElement::onStyleChanged() {
     needsRedraw = true;
+    onBackgroundPainted();
 }
 
-void UIElement::on(EventType type, EventCallback callback) {
-    eventHandler.on(type, callback);
+bool UIElement::on(EventType type, EventCallback callback) {
+    return eventHandler.on(type, callback);
 }
 
 void UIElement::off(EventType type) {
     eventHandler.off(type);
 }
 
+bool UIElement::handleGesture(EventType type, EventData* data) {
+    if (!eventHandler.hasHandler(type)) return false;
+    
+    eventHandler.trigger(type, data);
+    return true;
+}
+
 void UIElement::getBounds(int16_t* outX, int16_t* outY, int16_t* outW, int16_t* outH) {
     if (outX) *outX = x;
     if (outY) *outY = y;
@@ -86,6 +156,38 @@ void UIElement::getBounds(int16_t* outX, int16_t* outY, int16_t* outW, int16_t*
     if (outH) *outH = height;
 }
 
+void UIElement::getPaintBounds(int16_t* outX, int16_t* outY, int16_t* outW, int16_t* outH) {
+    getBounds(outX, outY, outW, outH);
+}
+
+void UIElement::setPainted(bool isPainted) {
+    painted = isPainted;
+    if (painted) {
+        getPaintBounds(&paintedX, &paintedY, &paintedW, &paintedH);
+    }
+}
+
+void UIElement::recordDraw(uint32_t us, uint32_t pixels) {
+    perf.draws++;
+    perf.totalUs += us;
+    if (us > perf.maxUs) perf.maxUs = us;
+    perf.pixels += pixels;
+}
+
+void UIElement::resetPerf() {
+    perf.draws = 0;
+    perf.totalUs = 0;
+    perf.maxUs = 0;
+    perf.pixels = 0;
+}
+
+void UIElement::getPaintedBounds(int16_t* outX, int16_t* outY, int16_t* outW, int16_t* outH) const {
+    if (outX) *outX = paintedX;
+    if (outY) *outY = paintedY;
+    if (outW) *outW = paintedW;
+    if (outH) *outH = paintedH;
+}
+
 void UIElement::drawRoundRect(TFT_eSPI* tft, int16_t x, int16_t y, int16_t w, int16_t h, 
                               uint8_t r, uint16_t color) {
     if (!tft) {
@@ -102,4 +204,8 @@ void UIElement::fillRoundRect(TFT_eSPI* tft, int16_t x, int16_t y, int16_t w, in
         return;
     }
     tft->fillRoundRect(x, y, w, h, r, color);
-}
\ No newline at end of file
+}
+
+void UIElement::pushPixels(TFT_eSPI* tft, int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+    UISurface::push(tft, x, y, w, h, data);
+}
@@ -3,47 +3,130 @@
  */
 
 #include "include/UIEventHandler.h"
+#include <functional>
 
-UIEventHandler::UIEventHandler() {
-    clear();
+UIEventHandler::Slot UIEventHandler::slots[UI_EVENT_MAX_HANDLERS];
+uint16_t UIEventHandler::freeHead = UIEventHandler::NO_SLOT;
+bool UIEventHandler::poolReady = false;
+uint16_t UIEventHandler::poolUsed = 0;
+uint16_t UIEventHandler::poolPeak = 0;
+uint32_t UIEventHandler::poolFailures = 0;
+
+UIEventHandler::UIEventHandler() : head(NO_SLOT) {
 }
 
 UIEventHandler::~UIEventHandler() {
     clear();
 }
 
-void UIEventHandler::on(EventType type, EventCallback callback) {
-    int idx = eventToIndex(type);
-    if (idx >= 0 && idx < 11) {
-        callbacks[idx] = callback;
+void UIEventHandler::initPool() {
+    for (uint16_t i = 0; i < UI_EVENT_MAX_HANDLERS; i++) {
+        slots[i].next = (i + 1 < UI_EVENT_MAX_HANDLERS) ? i + 1 : NO_SLOT;
     }
+    freeHead = 0;
+    poolReady = true;
+}
+
+bool UIEventHandler::on(EventType type, EventCallback callback) {
+    int idx = static_cast<int>(type);
+    if (idx <= 0 || idx >= EVENT_COUNT) return false;
+
+    if (!callback) {
+        off(type);
+        return true;
+    }
+
+    // Vorhandenen Handler ersetzen
+    uint16_t slot = findSlot(type);
+    if (slot != NO_SLOT) {
+        slots[slot].callback = callback;
+        return true;
+    }
+
+    if (!poolReady) initPool();
+    if (freeHead == NO_SLOT) {
+        poolFailures++;
+        Serial.printf("UIEventHandler: ❌ Pool voll (UI_EVENT_MAX_HANDLERS = %d)\n", UI_EVENT_MAX_HANDLERS);
+        return false;
+    }
+
+    slot = freeHead;
+    freeHead = slots[slot].next;
+
+    slots[slot].callback = callback;
+    slots[slot].type = idx;
+    slots[slot].next = head;
+    head = slot;
+
+    poolUsed++;
+    if (poolUsed > poolPeak) poolPeak = poolUsed;
+    return true;
 }
 
 void UIEventHandler::off(EventType type) {
-    int idx = eventToIndex(type);
-    if (idx >= 0 && idx < 11) {
-        callbacks[idx] = nullptr;
+    for (uint16_t* link = &head; *link != NO_SLOT; link = &slots[*link].next) {
+        uint16_t slot = *link;
+        if (slots[slot].type != static_cast<int>(type)) continue;
+
+        *link = slots[slot].next;
+        slots[slot].callback = nullptr;
+        slots[slot].next = freeHead;
+        freeHead = slot;
+        poolUsed--;
+        return;
     }
 }
 
 void UIEventHandler::clear() {
-    for (int i = 0; i < 11; i++) {
-        callbacks[i] = nullptr;
+    while (head != NO_SLOT) {
+        uint16_t slot = head;
+        head = slots[slot].next;
+
+        slots[slot].callback = nullptr;
+        slots[slot].next = freeHead;
+        freeHead = slot;
+        poolUsed--;
     }
 }
 
 void UIEventHandler::trigger(EventType type, EventData* data) {
-    int idx = eventToIndex(type);
-    if (idx >= 0 && idx < 11 && callbacks[idx]) {
-        callbacks[idx](data);
-    }
+    uint16_t slot = findSlot(type);
+    if (slot == NO_SLOT) return;
+
+    // Kopie (kein Heap): der Callback darf seinen Handler oder das Widget entfernen
+    EventCallback callback = slots[slot].callback;
+    callback(data);
 }
 
 bool UIEventHandler::hasHandler(EventType type) {
-    int idx = eventToIndex(type);
-    return (idx >= 0 && idx < 11 && callbacks[idx] != nullptr);
+    return findSlot(type) != NO_SLOT;
+}
+
+uint16_t UIEventHandler::findSlot(EventType type) const {
+    for (uint16_t slot = head; slot != NO_SLOT; slot = slots[slot].next) {
+        if (slots[slot].type == static_cast<int>(type)) return slot;
+    }
+    return NO_SLOT;
+}
+
+size_t UIEventHandler::getLegacyTableBytes() {
+    // Vorher: eine std::function pro Event-Type in jedem Widget
+    return EVENT_COUNT * sizeof(std::function<void(EventData*)>);
 }
 
-int UIEventHandler::eventToIndex(EventType type) {
-    return static_cast<int>(type);
-}
\ No newline at end of file
+void UIEventHandler::printStats() {
+    size_t tableBytes = getLegacyTableBytes();
+
+    Serial.println("\n=== Event-Handler ===");
+    Serial.printf("Pro Widget:  %u Byte (vorher Tabelle: %u Byte = %d × std::function à %u Byte)\n",
+                  (unsigned)sizeof(UIEventHandler), (unsigned)tableBytes, EVENT_COUNT,
+                  (unsigned)sizeof(std::function<void(EventData*)>));
+    Serial.printf("Pool:        %u/%d Handler belegt (max %u), %u Byte pro Handler, %u Byte gesamt\n",
+                  poolUsed, UI_EVENT_MAX_HANDLERS, poolPeak,
+                  (unsigned)sizeof(Slot), (unsigned)sizeof(slots));
+    Serial.printf("Callback:    %u Byte inline (UI_EVENT_CALLBACK_SIZE), kein Heap\n",
+                  (unsigned)EventCallback::CAPACITY);
+    if (poolFailures > 0) {
+        Serial.printf("⚠️ %lu Handler abgewiesen (Pool voll)\n", (unsigned long)poolFailures);
+    }
+}
@@ -0,0 +1,284 @@
+/**
+ * UIFlexLayout.cpp
+ */
+
+#include "include/UIFlexLayout.h"
+#include "include/UIElement.h"
+
+uint32_t UIFlexBox::measureCount = 0;
+uint32_t UIFlexBox::arrangeCount = 0;
+uint32_t UIFlexBox::cacheHits = 0;
+LayoutItem UIFlexBox::overflowItem;
+
+UIFlexBox::UIFlexBox(FlexDirection direction, int16_t gap, int16_t padding)
+    : direction(direction), justify(FlexJustify::START), align(FlexAlign::STRETCH),
+      gap(gap), padding(padding), columns(1), itemCount(0),
+      measured(false), measuredW(0), measuredH(0),
+      arranged(false), areaX(0), areaY(0), areaW(0), areaH(0) {
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Einträge
+// ═══════════════════════════════════════════════════════════════
+
+LayoutItem& UIFlexBox::append() {
+    LayoutItem* item = &overflowItem;
+    if (itemCount < UI_LAYOUT_MAX_ITEMS) {
+        item = &items[itemCount++];
+    } else {
+        Serial.printf("UIFlexBox: ❌ Box voll (UI_LAYOUT_MAX_ITEMS = %d), Eintrag ignoriert\n", UI_LAYOUT_MAX_ITEMS);
+    }
+
+    item->element = nullptr;
+    item->box = nullptr;
+    item->width = LAYOUT_AUTO;
+    item->height = LAYOUT_AUTO;
+    item->grow = 0;
+    item->align = FlexAlign::AUTO;
+    item->measuredW = item->measuredH = 0;
+    item->x = item->y = item->w = item->h = 0;
+
+    invalidate();
+    return *item;
+}
+
+LayoutItem& UIFlexBox::add(UIElement* element, int16_t width, int16_t height) {
+    LayoutItem& item = append();
+    item.element = element;
+    item.width = width;
+    item.height = height;
+    return item;
+}
+
+LayoutItem& UIFlexBox::add(UIFlexBox* box, int16_t width, int16_t height) {
+    LayoutItem& item = append();
+    item.box = box;
+    item.width = width;
+    item.height = height;
+    return item;
+}
+
+LayoutItem& UIFlexBox::addSpacer(uint8_t grow, int16_t size) {
+    LayoutItem& item = append();
+    item.grow = grow;
+
+    // Nur Hauptachse belegen
+    if (direction == FlexDirection::ROW) item.width = size;
+    else item.height = size;
+    return item;
+}
+
+void UIFlexBox::invalidate() {
+    measured = false;
+    arranged = false;
+
+    for (uint8_t i = 0; i < itemCount; i++) {
+        if (items[i].box) items[i].box->invalidate();
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════
+// measure: Wunschgrößen von unten nach oben
+// ═══════════════════════════════════════════════════════════════
+
+void UIFlexBox::measureItem(LayoutItem& item) {
+    int16_t w = 0, h = 0;
+
+    if (item.element) item.element->measure(&w, &h);
+    else if (item.box) item.box->measure(&w, &h);
+
+    item.measuredW = item.width != LAYOUT_AUTO ? item.width : w;
+    item.measuredH = item.height != LAYOUT_AUTO ? item.height : h;
+}
+
+void UIFlexBox::measure(int16_t* outW, int16_t* outH) {
+    if (!measured) {
+        measureCount++;
+        int16_t contentW = 0, contentH = 0;
+
+        for (uint8_t i = 0; i < itemCount; i++) {
+            measureItem(items[i]);
+        }
+
+        if (direction == FlexDirection::GRID) {
+            // Spaltenbreite = breitester Eintrag, Zeilenhöhe = höchster Eintrag der Zeile
+            int16_t cellW = 0;
+            for (uint8_t i = 0; i < itemCount; i++) cellW = max(cellW, items[i].measuredW);
+
+            for (uint8_t row = 0; row * columns < itemCount; row++) {
+                int16_t rowH = 0;
+                for (uint8_t i = row * columns; i < itemCount && i < (row + 1) * columns; i++) {
+                    rowH = max(rowH, items[i].measuredH);
+                }
+                contentH += (row > 0 ? gap : 0) + rowH;
+            }
+            contentW = cellW * columns + gap * (columns - 1);
+        } else {
+            bool isRow = direction == FlexDirection::ROW;
+            for (uint8_t i = 0; i < itemCount; i++) {
+                int16_t mainSize = isRow ? items[i].measuredW : items[i].measuredH;
+                int16_t crossSize = isRow ? items[i].measuredH : items[i].measuredW;
+
+                if (isRow) {
+                    contentW += (i > 0 ? gap : 0) + mainSize;
+                    contentH = max(contentH, crossSize);
+                } else {
+                    contentH += (i > 0 ? gap : 0) + mainSize;
+                    contentW = max(contentW, crossSize);
+                }
+            }
+        }
+
+        measuredW = contentW + 2 * padding;
+        measuredH = contentH + 2 * padding;
+        measured = true;
+    }
+
+    if (outW) *outW = measuredW;
+    if (outH) *outH = measuredH;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// arrange: Bereiche von oben nach unten
+// ═══════════════════════════════════════════════════════════════
+
+bool UIFlexBox::layout(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (arranged && measured && x == areaX && y == areaY && w == areaW && h == areaH) {
+        cacheHits++;
+        return false;
+    }
+
+    measure(nullptr, nullptr);
+    arrange(x, y, w, h);
+    return true;
+}
+
+void UIFlexBox::arrange(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (!measured) measure(nullptr, nullptr);
+    arrangeCount++;
+
+    int16_t innerX = x + padding;
+    int16_t innerY = y + padding;
+    int16_t innerW = max((int16_t)0, (int16_t)(w - 2 * padding));
+    int16_t innerH = max((int16_t)0, (int16_t)(h - 2 * padding));
+
+    if (direction == FlexDirection::GRID) {
+        arrangeGrid(innerX, innerY, innerW, innerH);
+    } else {
+        arrangeFlex(innerX, innerY, innerW, innerH);
+    }
+
+    areaX = x;
+    areaY = y;
+    areaW = w;
+    areaH = h;
+    arranged = true;
+}
+
+void UIFlexBox::arrangeFlex(int16_t innerX, int16_t innerY, int16_t innerW, int16_t innerH) {
+    if (itemCount == 0) return;
+
+    bool isRow = direction == FlexDirection::ROW;
+    int16_t mainSpace = isRow ? innerW : innerH;
+    int16_t crossSpace = isRow ? innerH : innerW;
+
+    // Belegter Platz und Summe der grow-Anteile
+    int16_t used = gap * (itemCount - 1);
+    uint16_t totalGrow = 0;
+    for (uint8_t i = 0; i < itemCount; i++) {
+        used += isRow ? items[i].measuredW : items[i].measuredH;
+        totalGrow += items[i].grow;
+    }
+    int16_t free = mainSpace - used;
+
+    // Restplatz: wachsende Einträge, sonst justify
+    int16_t offset = 0;
+    int16_t spacing = gap;
+    if (totalGrow == 0 && free > 0) {
+        switch (justify) {
+            case FlexJustify::CENTER: offset = free / 2; break;
+            case FlexJustify::END: offset = free; break;
+            case FlexJustify::SPACE_BETWEEN:
+                if (itemCount > 1) spacing += free / (itemCount - 1);
+                break;
+            default: break;
+        }
+    }
+
+    int16_t growLeft = max((int16_t)0, free);
+    uint16_t growRemaining = totalGrow;
+    int16_t pos = offset;
+
+    for (uint8_t i = 0; i < itemCount; i++) {
+        LayoutItem& item = items[i];
+        int16_t mainSize = isRow ? item.measuredW : item.measuredH;
+
+        if (item.grow > 0 && growRemaining > 0) {
+            // Letzter wachsender Eintrag bekommt den Rundungsrest
+            int16_t extra = (item.grow == growRemaining) ? growLeft : (int32_t)growLeft * item.grow / growRemaining;
+            mainSize += extra;
+            growLeft -= extra;
+            growRemaining -= item.grow;
+        }
+
+        FlexAlign itemAlign = item.align == FlexAlign::AUTO ? align : item.align;
+        int16_t crossOffset, crossSize;
+        alignCross(itemAlign, isRow ? item.height : item.width,
+                   isRow ? item.measuredH : item.measuredW, crossSpace, &crossOffset, &crossSize);
+
+        if (isRow) {
+            place(item, innerX + pos, innerY + crossOffset, mainSize, crossSize);
+        } else {
+            place(item, innerX + crossOffset, innerY + pos, crossSize, mainSize);
+        }
+        pos += mainSize + spacing;
+    }
+}
+
+void UIFlexBox::arrangeGrid(int16_t innerX, int16_t innerY, int16_t innerW, int16_t innerH) {
+    int16_t cellW = (innerW - gap * (columns - 1)) / columns;
+    int16_t rowY = innerY;
+
+    for (uint8_t row = 0; row * columns < itemCount; row++) {
+        uint8_t first = row * columns;
+        uint8_t last = min((uint8_t)itemCount, (uint8_t)(first + columns));
+
+        int16_t rowH = 0;
+        for (uint8_t i = first; i < last; i++) rowH = max(rowH, items[i].measuredH);
+
+        for (uint8_t i = first; i < last; i++) {
+            LayoutItem& item = items[i];
+            FlexAlign itemAlign = item.align == FlexAlign::AUTO ? align : item.align;
+            int16_t offX, sizeW, offY, sizeH;
+            alignCross(itemAlign, item.width, item.measuredW, cellW, &offX, &sizeW);
+            alignCross(itemAlign, item.height, item.measuredH, rowH, &offY, &sizeH);
+
+            place(item, innerX + (i - first) * (cellW + gap) + offX, rowY + offY, sizeW, sizeH);
+        }
+        rowY += rowH + gap;
+    }
+}
+
+void UIFlexBox::place(LayoutItem& item, int16_t x, int16_t y, int16_t w, int16_t h) {
+    item.x = x;
+    item.y = y;
+    item.w = w;
+    item.h = h;
+
+    // setBounds() markiert nur bei Änderung (Relayout ohne Änderung zeichnet nichts)
+    if (item.element) item.element->setBounds(x, y, w, h);
+    else if (item.box) item.box->layout(x, y, w, h);
+}
+
+void UIFlexBox::alignCross(FlexAlign align, int16_t fixed, int16_t measured, int16_t space,
+                           int16_t* outOffset, int16_t* outSize) {
+    int16_t size = fixed != LAYOUT_AUTO ? fixed : (align == FlexAlign::STRETCH ? space : measured);
+    if (size > space) size = space;
+
+    switch (align) {
+        case FlexAlign::CENTER: *outOffset = (space - size) / 2; break;
+        case FlexAlign::END:    *outOffset = space - size; break;
+        default:                *outOffset = 0; break;
+    }
+    *outSize = size;
+}
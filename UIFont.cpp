@@ -0,0 +1,482 @@
+/**
+ * UIFont.cpp
+ */
+
+#include "include/UIFont.h"
+#include "include/SDCardHandler.h"
+#include "include/UIFrameBuffer.h"
+#include "include/UISurface.h"
+#include <esp_heap_caps.h>
+
+UIFont* UIFont::firstFont = nullptr;
+
+// getCell() maskiert den Hash statt Modulo, cacheCount/mask sind 16 Bit
+static_assert((UI_FONT_CACHE_ENTRIES & (UI_FONT_CACHE_ENTRIES - 1)) == 0, "UI_FONT_CACHE_ENTRIES muss Zweierpotenz sein");
+static_assert(UI_FONT_CACHE_ENTRIES > 0 && UI_FONT_CACHE_ENTRIES <= 32768, "UI_FONT_CACHE_ENTRIES muss in uint16_t passen");
+
+UIFont::CacheEntry* UIFont::cacheEntries = nullptr;
+uint8_t* UIFont::cachePool = nullptr;
+size_t UIFont::cacheUsed = 0;
+uint16_t UIFont::cacheCount = 0;
+uint32_t UIFont::cacheHits = 0;
+uint32_t UIFont::cacheMisses = 0;
+uint32_t UIFont::cacheFlushes = 0;
+
+// .vlw: Kopf aus 6 Werten, pro Glyphe 7 Werte (je uint32, Big-Endian)
+static const size_t VLW_HEADER_SIZE = 24;
+static const size_t VLW_GLYPH_SIZE = 28;
+
+static uint32_t readBE32(const uint8_t* data) {
+    return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3];
+}
+
+// Wie TFT_eSPI::alphaBlend(): alpha 0 = bg, 255 = fg
+static uint16_t blend565(uint8_t alpha, uint16_t fg, uint16_t bg) {
+    uint32_t rb = bg & 0xF81F;
+    rb += ((fg & 0xF81F) - rb) * (alpha >> 2) >> 6;
+    uint32_t g = bg & 0x07E0;
+    g += ((fg & 0x07E0) - g) * alpha >> 8;
+    return (rb & 0xF81F) | (g & 0x07E0);
+}
+
+static void* allocPsram(size_t size) {
+    void* memory = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    return memory ? memory : malloc(size);
+}
+
+UIFont::UIFont(const char* name)
+    : name(name), atlas(nullptr), atlasSize(0), glyphs(nullptr), glyphCount(0),
+      fallbackGlyph(-1), ascent(0), descent(0), spaceAdvance(0),
+      nextFont(firstFont) {
+
+    firstFont = this;
+}
+
+UIFont::~UIFont() {
+    unload();
+
+    // Aus der Verkettung lösen
+    for (UIFont** link = &firstFont; *link; link = &(*link)->nextFont) {
+        if (*link == this) {
+            *link = nextFont;
+            break;
+        }
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════
+// LADEN
+// ═══════════════════════════════════════════════════════════════
+
+bool UIFont::loadFromMemory(const uint8_t* data, size_t size) {
+    unload();
+    if (!data || size < VLW_HEADER_SIZE) return false;
+
+    atlas = static_cast<uint8_t*>(allocPsram(size));
+    if (!atlas) {
+        Serial.printf("UIFont: ❌ Kein Speicher für '%s' (%u Byte)\n", name, (unsigned)size);
+        return false;
+    }
+
+    memcpy(atlas, data, size);
+    atlasSize = size;
+    return parse();
+}
+
+bool UIFont::loadFromSD(SDCardHandler* sd, const char* path) {
+    unload();
+    if (!sd || !sd->isAvailable() || !path) return false;
+
+    size_t size = sd->getFileSize(path);
+    if (size < VLW_HEADER_SIZE) {
+        Serial.printf("UIFont: ❌ '%s' fehlt oder ist leer\n", path);
+        return false;
+    }
+
+    atlas = static_cast<uint8_t*>(allocPsram(size));
+    if (!atlas) {
+        Serial.printf("UIFont: ❌ Kein Speicher für '%s' (%u Byte)\n", path, (unsigned)size);
+        return false;
+    }
+
+    int bytes = sd->readBinaryFile(path, atlas, size);
+    if (bytes != (int)size) {
+        Serial.printf("UIFont: ❌ '%s' nicht lesbar\n", path);
+        unload();
+        return false;
+    }
+
+    atlasSize = size;
+    return parse();
+}
+
+void UIFont::unload() {
+    // Gemischte Glyphen dieses Fonts sind ungültig
+    dropFont(this);
+
+    if (glyphs) {
+        free(glyphs);
+        glyphs = nullptr;
+    }
+    if (atlas) {
+        free(atlas);
+        atlas = nullptr;
+    }
+    atlasSize = 0;
+    glyphCount = 0;
+    fallbackGlyph = -1;
+    ascent = 0;
+    descent = 0;
+}
+
+bool UIFont::parse() {
+    uint32_t count = readBE32(atlas);
+    size_t bitmapStart = VLW_HEADER_SIZE + (size_t)count * VLW_GLYPH_SIZE;
+
+    if (count == 0 || count > 0xFFFF || bitmapStart > atlasSize) {
+        Serial.printf("UIFont: ❌ '%s' ist kein gültiger Atlas\n", name);
+        unload();
+        return false;
+    }
+
+    glyphs = static_cast<Glyph*>(allocPsram(count * sizeof(Glyph)));
+    if (!glyphs) {
+        unload();
+        return false;
+    }
+
+    for (int i = 0; i < 95; i++) asciiIndex[i] = -1;
+
+    // Zeilenhöhe aus sichtbaren Zeichen (wie TFT_eSPI::loadMetrics())
+    int16_t maxAscent = 0;
+    int16_t maxDescent = 0;
+    size_t offset = bitmapStart;
+
+    for (uint32_t i = 0; i < count; i++) {
+        const uint8_t* metrics = atlas + VLW_HEADER_SIZE + i * VLW_GLYPH_SIZE;
+        Glyph& glyph = glyphs[i];
+
+        glyph.code = readBE32(metrics);
+        glyph.height = readBE32(metrics + 4);
+        glyph.width = readBE32(metrics + 8);
+        glyph.advance = (int16_t)readBE32(metrics + 12);
+        glyph.dY = (int16_t)(int32_t)readBE32(metrics + 16);
+        glyph.dX = (int16_t)(int32_t)readBE32(metrics + 20);
+        glyph.offset = offset;
+
+        offset += (size_t)glyph.width * glyph.height;
+        if (offset > atlasSize) {
+            Serial.printf("UIFont: ❌ '%s' ist abgeschnitten\n", name);
+            unload();
+            return false;
+        }
+
+        if (glyph.code >= 0x20 && glyph.code <= 0x7E) asciiIndex[glyph.code - 0x20] = i;
+
+        if (glyph.code > 0x20 && glyph.code < 0xA0 && glyph.code != 0x7F) {
+            maxAscent = max(maxAscent, glyph.dY);
+            maxDescent = max(maxDescent, (int16_t)(glyph.height - glyph.dY));
+        }
+    }
+
+    glyphCount = count;
+    ascent = maxAscent;
+    descent = maxDescent;
+    fallbackGlyph = asciiIndex['?' - 0x20];
+
+    // Atlanten ohne Leerzeichen: Vorschub wie TFT_eSPI (Viertel der Schriftgröße)
+    spaceAdvance = max((int16_t)1, (int16_t)(readBE32(atlas + 8) / 4));
+
+    Serial.printf("UIFont: ✅ '%s' geladen (%u Glyphen, Zeilenhöhe %d, %u Byte)\n",
+                  name, glyphCount, getLineHeight(), (unsigned)atlasSize);
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// TEXT
+// ═══════════════════════════════════════════════════════════════
+
+uint32_t UIFont::nextCodepoint(const char** text) {
+    const uint8_t* s = reinterpret_cast<const uint8_t*>(*text);
+    uint32_t code = s[0];
+    int length = 1;
+
+    // UTF-8 (2/3 Byte) - ungültige Folgen als einzelnes Byte
+    if ((code & 0xE0) == 0xC0 && (s[1] & 0xC0) == 0x80) {
+        code = ((code & 0x1F) << 6) | (s[1] & 0x3F);
+        length = 2;
+    } else if ((code & 0xF0) == 0xE0 && (s[1] & 0xC0) == 0x80 && (s[2] & 0xC0) == 0x80) {
+        code = ((code & 0x0F) << 12) | ((s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+        length = 3;
+    }
+
+    *text += length;
+    return code;
+}
+
+int16_t UIFont::findGlyph(uint32_t code) const {
+    if (code >= 0x20 && code <= 0x7E) return asciiIndex[code - 0x20];
+
+    for (uint16_t i = 0; i < glyphCount; i++) {
+        if (glyphs[i].code == code) return i;
+    }
+    return -1;
+}
+
+int16_t UIFont::textWidth(const char* text) const {
+    if (!isLoaded() || !text) return 0;
+
+    int16_t width = 0;
+    while (*text) {
+        uint32_t code = nextCodepoint(&text);
+        int16_t glyph = findGlyph(code);
+        if (glyph < 0 && code != ' ') glyph = fallbackGlyph;
+        width += glyph >= 0 ? glyphs[glyph].advance : spaceAdvance;
+    }
+    return width;
+}
+
+int16_t UIFont::drawText(TFT_eSPI* tft, const char* text, int16_t x, int16_t y, uint16_t fg, uint16_t bg) {
+    if (!isLoaded() || !tft || !text) return 0;
+
+    int16_t cursor = x;
+    int16_t lineHeight = getLineHeight();
+
+    while (*text) {
+        uint32_t code = nextCodepoint(&text);
+        int16_t glyph = findGlyph(code);
+        if (glyph < 0 && code != ' ') glyph = fallbackGlyph;
+
+        if (glyph < 0) {
+            // Leerzeichen ohne Glyphe: nur Hintergrund
+            tft->fillRect(cursor, y, spaceAdvance, lineHeight, bg);
+            cursor += spaceAdvance;
+            continue;
+        }
+
+        uint16_t width = 0;
+        const uint16_t* cell = getCell(glyph, fg, bg, &width);
+        if (cell) {
+            UISurface::push(tft, cursor, y, width, lineHeight, cell);
+        } else if (width > 0) {
+            tft->fillRect(cursor, y, width, lineHeight, bg);
+        }
+        cursor += glyphs[glyph].advance;
+    }
+
+    return cursor - x;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// GLYPH-CACHE
+// ═══════════════════════════════════════════════════════════════
+
+bool UIFont::ensureCache() {
+    if (cacheEntries) return true;
+
+    cacheEntries = static_cast<CacheEntry*>(allocPsram(UI_FONT_CACHE_ENTRIES * sizeof(CacheEntry)));
+    cachePool = static_cast<uint8_t*>(allocPsram(UI_FONT_CACHE_BYTES));
+    if (!cacheEntries || !cachePool) {
+        Serial.println("UIFont: ⚠️ Kein Speicher für den Glyph-Cache");
+        free(cacheEntries);
+        free(cachePool);
+        cacheEntries = nullptr;
+        cachePool = nullptr;
+        return false;
+    }
+
+    memset(cacheEntries, 0, UI_FONT_CACHE_ENTRIES * sizeof(CacheEntry));
+    cacheUsed = 0;
+    cacheCount = 0;
+    return true;
+}
+
+void UIFont::clearCache() {
+    if (!cacheEntries) return;
+
+    memset(cacheEntries, 0, UI_FONT_CACHE_ENTRIES * sizeof(CacheEntry));
+    cacheUsed = 0;
+    cacheCount = 0;
+}
+
+void UIFont::dropFont(const UIFont* font) {
+    if (!cacheEntries) return;
+
+    // Offene Adressierung: einzelne Einträge lassen sich nicht löschen → alles
+    for (uint16_t i = 0; i < UI_FONT_CACHE_ENTRIES; i++) {
+        if (cacheEntries[i].font == font) {
+            clearCache();
+            return;
+        }
+    }
+}
+
+const uint16_t* UIFont::getCell(uint16_t glyph, uint16_t fg, uint16_t bg, uint16_t* outW) {
+    uint16_t width = max((int16_t)1, glyphs[glyph].advance);
+    *outW = width;
+
+    if (!ensureCache()) return nullptr;
+
+    uint32_t hash = (uint32_t)(reinterpret_cast<uintptr_t>(this) >> 2) * 31u + glyph;
+    hash = hash * 0x9E3779B1u ^ ((uint32_t)fg << 16 | bg);
+    hash ^= hash >> 15;
+
+    uint16_t mask = UI_FONT_CACHE_ENTRIES - 1;
+    uint16_t slot = hash & mask;
+
+    while (cacheEntries[slot].font) {
+        const CacheEntry& entry = cacheEntries[slot];
+        if (entry.font == this && entry.glyph == glyph && entry.fg == fg && entry.bg == bg) {
+            cacheHits++;
+            return entry.pixels;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    cacheMisses++;
+
+    // Voll (Tabelle zu 3/4 oder Pixel-Pool) → komplett leeren
+    size_t bytes = (size_t)width * getLineHeight() * sizeof(uint16_t);
+    if (bytes > UI_FONT_CACHE_BYTES) return nullptr;
+    if (cacheCount >= UI_FONT_CACHE_ENTRIES * 3 / 4 || cacheUsed + bytes > UI_FONT_CACHE_BYTES) {
+        clearCache();
+        cacheFlushes++;
+        slot = hash & mask;
+    }
+
+    CacheEntry& entry = cacheEntries[slot];
+    entry.pixels = reinterpret_cast<uint16_t*>(cachePool + cacheUsed);
+    cacheUsed += (bytes + 3) & ~(size_t)3;
+    cacheCount++;
+
+    entry.font = this;
+    entry.glyph = glyph;
+    entry.fg = fg;
+    entry.bg = bg;
+    entry.width = width;
+    entry.height = getLineHeight();
+
+    // Zelle mischen
+    const Glyph& g = glyphs[glyph];
+    uint16_t height = entry.height;
+    uint16_t bgSwapped = (bg >> 8) | (bg << 8);
+
+    for (uint32_t i = 0; i < (uint32_t)width * height; i++) entry.pixels[i] = bgSwapped;
+
+    const uint8_t* bitmap = atlas + g.offset;
+    int16_t top = ascent - g.dY;
+
+    for (uint16_t gy = 0; gy < g.height; gy++) {
+        int16_t cy = top + gy;
+        if (cy < 0 || cy >= height) continue;
+
+        uint16_t* row = entry.pixels + (uint32_t)cy * width;
+        const uint8_t* alphaRow = bitmap + (uint32_t)gy * g.width;
+
+        for (uint16_t gx = 0; gx < g.width; gx++) {
+            int16_t cx = g.dX + gx;
+            uint8_t alpha = alphaRow[gx];
+            if (alpha == 0 || cx < 0 || cx >= width) continue;
+
+            uint16_t color = alpha == 255 ? fg : blend565(alpha, fg, bg);
+            row[cx] = (color >> 8) | (color << 8);
+        }
+    }
+
+    return entry.pixels;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// STATISTIK / BENCHMARK
+// ═══════════════════════════════════════════════════════════════
+
+void UIFont::printStats() {
+    Serial.println("\n=== Fonts ===");
+
+    int count = 0;
+    for (UIFont* font = firstFont; font; font = font->nextFont) {
+        if (font->isLoaded()) {
+            Serial.printf("  %-12s %4u Glyphen, Zeilenhöhe %2d, Atlas %u Byte\n",
+                          font->name, font->glyphCount, font->getLineHeight(), (unsigned)font->atlasSize);
+        } else {
+            Serial.printf("  %-12s nicht geladen\n", font->name);
+        }
+        count++;
+    }
+    if (count == 0) Serial.println("  (keine)");
+
+    uint32_t lookups = cacheHits + cacheMisses;
+    Serial.printf("Glyph-Cache: %u/%d Zellen, %u/%d Byte, Treffer %lu/%lu (%.1f%%), %lu× geleert\n",
+                  cacheCount, UI_FONT_CACHE_ENTRIES, (unsigned)cacheUsed, UI_FONT_CACHE_BYTES,
+                  (unsigned long)cacheHits, (unsigned long)lookups,
+                  lookups > 0 ? cacheHits * 100.0f / lookups : 0.0f, (unsigned long)cacheFlushes);
+    Serial.println("=============\n");
+}
+
+void UIFont::benchmark(TFT_eSPI* tft, UIFont* font, uint16_t iterations) {
+    if (!font || !font->isLoaded()) {
+        Serial.printf("UIFont: ❌ Kein Font geladen (%s auf der SD-Karte)\n", UI_FONT_FILE);
+        return;
+    }
+    if (iterations == 0) iterations = 1;
+
+    UIFrameBuffer frameBuffer(tft);
+    if (!frameBuffer.begin()) {
+        Serial.println("UIFont: ❌ Framebuffer nicht verfügbar (PSRAM?)");
+        return;
+    }
+
+    const char* sample = "Battery: 3.92V (87%) ESP-NOW";
+    size_t chars = strlen(sample);
+    int16_t lineHeight = font->getLineHeight();
+    int16_t rows = max(1, DISPLAY_HEIGHT / lineHeight);
+
+    // Bitmap-Font (8 px pro Stufe) in vergleichbarer Höhe
+    uint8_t size = constrain((lineHeight + 4) / 8, 1, 7);
+
+    Serial.printf("\n=== Font-Benchmark: '%s' (%d px) gegen drawString() Größe %d, %u Zeilen à %u Zeichen ===\n",
+                  font->getName(), lineHeight, size, iterations, (unsigned)chars);
+
+    // drawString(): skalierter GLCD-Font, ein Rechteck pro gesetztem Glyph-Pixel
+    frameBuffer.setTextSize(size);
+    frameBuffer.setTextDatum(TL_DATUM);
+    frameBuffer.setTextColor(COLOR_WHITE, COLOR_BLACK);
+    frameBuffer.resetStats();
+
+    uint32_t startUs = micros();
+    for (uint16_t i = 0; i < iterations; i++) {
+        frameBuffer.drawString(sample, 0, (i % rows) * size * 8);
+    }
+    uint32_t stringUs = micros() - startUs;
+    UIDrawStats stringStats = frameBuffer.getStats();
+
+    // Glyph-Cache kalt: erste Zeile mischt alle Zellen
+    clearCache();
+    frameBuffer.resetStats();
+    startUs = micros();
+    font->drawText(&frameBuffer, sample, 0, 0, COLOR_WHITE, COLOR_BLACK);
+    uint32_t coldUs = micros() - startUs;
+
+    // Glyph-Cache warm: nur Block-Transfers
+    frameBuffer.resetStats();
+    startUs = micros();
+    for (uint16_t i = 0; i < iterations; i++) {
+        font->drawText(&frameBuffer, sample, 0, (i % rows) * lineHeight, COLOR_WHITE, COLOR_BLACK);
+    }
+    uint32_t cachedUs = micros() - startUs;
+    UIDrawStats cachedStats = frameBuffer.getStats();
+
+    float stringRate = stringUs > 0 ? chars * iterations * 1000000.0f / stringUs : 0.0f;
+    float cachedRate = cachedUs > 0 ? chars * iterations * 1000000.0f / cachedUs : 0.0f;
+
+    Serial.printf("drawString():  %6lu us/Zeile, %8.0f Zeichen/s\n",
+                  (unsigned long)(stringUs / iterations), stringRate);
+    UIFrameBuffer::printStats("drawString", stringStats, iterations);
+    Serial.printf("Glyph-Cache:   %6lu us/Zeile, %8.0f Zeichen/s (kalt: %lu us)\n",
+                  (unsigned long)(cachedUs / iterations), cachedRate, (unsigned long)coldUs);
+    UIFrameBuffer::printStats("Glyph-Cache", cachedStats, iterations);
+    if (cachedUs > 0) {
+        Serial.printf("Faktor: %.1fx\n", (float)stringUs / cachedUs);
+    }
+    Serial.println("=========================================================================\n");
+}
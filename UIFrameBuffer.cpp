@@ -0,0 +1,277 @@
+/**
+ * UIFrameBuffer.cpp
+ */
+
+#include "include/UIFrameBuffer.h"
+#include <esp_heap_caps.h>
+#include <esp_rom_crc.h>
+
+UIFrameBuffer::UIFrameBuffer(TFT_eSPI* tft)
+    : UISurface(tft), coverage(nullptr), depth(0), inLeaf(false) {
+
+    resetStats();
+}
+
+UIFrameBuffer::~UIFrameBuffer() {
+    end();
+}
+
+bool UIFrameBuffer::begin() {
+    if (coverage) return true;
+
+    setColorDepth(16);
+    setAttribute(PSRAM_ENABLE, true);
+    if (!createSprite(DISPLAY_WIDTH, DISPLAY_HEIGHT)) {
+        Serial.println("UIFrameBuffer: ❌ Kein Speicher für Framebuffer");
+        return false;
+    }
+
+    size_t coverageBytes = (size_t)COVERAGE_STRIDE * DISPLAY_HEIGHT * sizeof(uint32_t);
+    coverage = static_cast<uint32_t*>(heap_caps_malloc(coverageBytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+    if (!coverage) coverage = static_cast<uint32_t*>(malloc(coverageBytes));
+    if (!coverage) {
+        Serial.println("UIFrameBuffer: ❌ Kein Speicher für Abdeckungs-Bitmap");
+        deleteSprite();
+        return false;
+    }
+
+    fillSprite(TFT_BLACK);
+    resetStats();
+    return true;
+}
+
+void UIFrameBuffer::end() {
+    if (coverage) {
+        free(coverage);
+        coverage = nullptr;
+    }
+    deleteSprite();
+}
+
+void UIFrameBuffer::resetStats() {
+    memset(&stats, 0, sizeof(stats));
+    if (coverage) {
+        memset(coverage, 0, (size_t)COVERAGE_STRIDE * DISPLAY_HEIGHT * sizeof(uint32_t));
+    }
+}
+
+UIDrawStats UIFrameBuffer::getStats() const {
+    UIDrawStats result = stats;
+    result.uniquePixels = 0;
+
+    if (coverage) {
+        for (size_t i = 0; i < (size_t)COVERAGE_STRIDE * DISPLAY_HEIGHT; i++) {
+            result.uniquePixels += __builtin_popcount(coverage[i]);
+        }
+    }
+    return result;
+}
+
+const char* UIFrameBuffer::getPrimitiveName(DrawPrimitive primitive) {
+    switch (primitive) {
+        case DrawPrimitive::PIXEL: return "drawPixel";
+        case DrawPrimitive::HLINE: return "drawFastHLine";
+        case DrawPrimitive::VLINE: return "drawFastVLine";
+        case DrawPrimitive::LINE:  return "drawLine";
+        case DrawPrimitive::RECT:  return "fillRect";
+        case DrawPrimitive::CHAR:  return "drawChar";
+        case DrawPrimitive::IMAGE: return "pushImage";
+        default:                   return "?";
+    }
+}
+
+void UIFrameBuffer::printStats(const char* label, const UIDrawStats& stats, uint32_t frames) {
+    if (frames == 0) frames = 1;
+
+    Serial.printf("  %-14s %7lu Pixel, %6lu verschieden, Überzeichnung %.2fx, %5lu Aufrufe",
+                  label, stats.pixels / frames, stats.uniquePixels, stats.overdraw(),
+                  stats.totalCalls / frames);
+    if (frames > 1) Serial.print(" (pro Frame)");
+    Serial.println();
+
+    if (stats.totalCalls == 0) return;
+
+    Serial.print("                 ");
+    for (int i = 0; i < static_cast<int>(DrawPrimitive::COUNT); i++) {
+        if (stats.calls[i] == 0) continue;
+        Serial.printf(" %s %lu", getPrimitiveName(static_cast<DrawPrimitive>(i)), stats.calls[i] / frames);
+    }
+    Serial.println();
+}
+
+uint32_t UIFrameBuffer::checksum() {
+    const uint16_t* pixels = getPixels();
+    if (!pixels) return 0;
+    return esp_rom_crc32_le(0, reinterpret_cast<const uint8_t*>(pixels), getByteSize());
+}
+
+uint32_t UIFrameBuffer::compare(const uint16_t* reference, int16_t* outX, int16_t* outY, int16_t* outW, int16_t* outH) {
+    const uint16_t* pixels = getPixels();
+    uint32_t mismatches = 0;
+    int16_t x0 = DISPLAY_WIDTH, y0 = DISPLAY_HEIGHT, x1 = -1, y1 = -1;
+
+    if (pixels && reference) {
+        for (int16_t row = 0; row < DISPLAY_HEIGHT; row++) {
+            const uint16_t* line = pixels + row * DISPLAY_WIDTH;
+            const uint16_t* expected = reference + row * DISPLAY_WIDTH;
+
+            // Gleiche Zeilen schnell überspringen
+            if (memcmp(line, expected, DISPLAY_WIDTH * sizeof(uint16_t)) == 0) continue;
+
+            for (int16_t col = 0; col < DISPLAY_WIDTH; col++) {
+                if (line[col] == expected[col]) continue;
+                mismatches++;
+                if (col < x0) x0 = col;
+                if (col > x1) x1 = col;
+                if (row < y0) y0 = row;
+                y1 = row;
+            }
+        }
+    }
+
+    if (mismatches == 0) {
+        x0 = y0 = 0;
+        x1 = y1 = -1;
+    }
+    if (outX) *outX = x0;
+    if (outY) *outY = y0;
+    if (outW) *outW = x1 - x0 + 1;
+    if (outH) *outH = y1 - y0 + 1;
+    return mismatches;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Gezählte Primitive
+// ═══════════════════════════════════════════════════════════════
+
+void UIFrameBuffer::countCall(DrawPrimitive primitive) {
+    // Nur Aufrufe der Widgets, nicht die internen Teilschritte (z.B. drawChar → fillRect)
+    if (depth > 0) return;
+    stats.calls[static_cast<int>(primitive)]++;
+    stats.totalCalls++;
+}
+
+void UIFrameBuffer::countPixels(int32_t x, int32_t y, int32_t w, int32_t h) {
+    if (inLeaf || _vpOoB || w <= 0 || h <= 0) return;
+
+    // Wie TFT_eSprite: Koordinaten relativ zum Datum, Clip auf den Viewport
+    x += _xDatum;
+    y += _yDatum;
+    int32_t x0 = max(x, _vpX);
+    int32_t y0 = max(y, _vpY);
+    int32_t x1 = min(x + w, _vpW);
+    int32_t y1 = min(y + h, _vpH);
+    if (x1 <= x0 || y1 <= y0) return;
+
+    stats.pixels += (uint32_t)(x1 - x0) * (y1 - y0);
+    if (!coverage) return;
+
+    // Abdeckung: Bits x0..x1-1 in jeder Zeile setzen
+    int32_t firstWord = x0 >> 5;
+    int32_t lastWord = (x1 - 1) >> 5;
+    uint32_t firstMask = 0xFFFFFFFFu << (x0 & 31);
+    uint32_t lastMask = 0xFFFFFFFFu >> (31 - ((x1 - 1) & 31));
+
+    for (int32_t row = y0; row < y1; row++) {
+        uint32_t* line = coverage + row * COVERAGE_STRIDE;
+        if (firstWord == lastWord) {
+            line[firstWord] |= firstMask & lastMask;
+            continue;
+        }
+        line[firstWord] |= firstMask;
+        for (int32_t word = firstWord + 1; word < lastWord; word++) line[word] = 0xFFFFFFFFu;
+        line[lastWord] |= lastMask;
+    }
+}
+
+void UIFrameBuffer::drawPixel(int32_t x, int32_t y, uint32_t color) {
+    countCall(DrawPrimitive::PIXEL);
+    countPixels(x, y, 1, 1);
+
+    bool outer = !inLeaf;
+    depth++;
+    inLeaf = true;
+    TFT_eSprite::drawPixel(x, y, color);
+    inLeaf = !outer;
+    depth--;
+}
+
+void UIFrameBuffer::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+    countCall(DrawPrimitive::HLINE);
+    countPixels(x, y, w, 1);
+
+    bool outer = !inLeaf;
+    depth++;
+    inLeaf = true;
+    TFT_eSprite::drawFastHLine(x, y, w, color);
+    inLeaf = !outer;
+    depth--;
+}
+
+void UIFrameBuffer::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+    countCall(DrawPrimitive::VLINE);
+    countPixels(x, y, 1, h);
+
+    bool outer = !inLeaf;
+    depth++;
+    inLeaf = true;
+    TFT_eSprite::drawFastVLine(x, y, h, color);
+    inLeaf = !outer;
+    depth--;
+}
+
+void UIFrameBuffer::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    countCall(DrawPrimitive::RECT);
+    countPixels(x, y, w, h);
+
+    bool outer = !inLeaf;
+    depth++;
+    inLeaf = true;
+    TFT_eSprite::fillRect(x, y, w, h, color);
+    inLeaf = !outer;
+    depth--;
+}
+
+void UIFrameBuffer::blit(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+    countCall(DrawPrimitive::IMAGE);
+    countPixels(x, y, w, h);
+
+    bool outer = !inLeaf;
+    depth++;
+    inLeaf = true;
+    UISurface::blit(x, y, w, h, data);
+    inLeaf = !outer;
+    depth--;
+}
+
+// Zusammengesetzte Primitive: Pixel zählen die inneren Aufrufe
+
+void UIFrameBuffer::drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color) {
+    countCall(DrawPrimitive::LINE);
+    depth++;
+    TFT_eSprite::drawLine(xs, ys, xe, ye, color);
+    depth--;
+}
+
+void UIFrameBuffer::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size) {
+    countCall(DrawPrimitive::CHAR);
+    depth++;
+    TFT_eSprite::drawChar(x, y, c, color, bg, size);
+    depth--;
+}
+
+int16_t UIFrameBuffer::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font) {
+    countCall(DrawPrimitive::CHAR);
+    depth++;
+    int16_t advance = TFT_eSprite::drawChar(uniCode, x, y, font);
+    depth--;
+    return advance;
+}
+
+int16_t UIFrameBuffer::drawChar(uint16_t uniCode, int32_t x, int32_t y) {
+    countCall(DrawPrimitive::CHAR);
+    depth++;
+    int16_t advance = TFT_eSprite::drawChar(uniCode, x, y);
+    depth--;
+    return advance;
+}
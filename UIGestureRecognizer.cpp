@@ -0,0 +1,235 @@
+/**
+ * UIGestureRecognizer.cpp
+ */
+
+#include "include/UIGestureRecognizer.h"
+
+UIGestureRecognizer::UIGestureRecognizer()
+    : callback(nullptr), historyHead(0), historyCount(0),
+      active(false), panning(false), longPressFired(false),
+      startX(0), startY(0), lastX(0), lastY(0),
+      startTime(0), lastSampleTime(0),
+      kinetic(false), kineticVX(0), kineticVY(0),
+      kineticRestX(0), kineticRestY(0), kineticLastTime(0) {
+}
+
+UIGestureRecognizer::~UIGestureRecognizer() {
+}
+
+void UIGestureRecognizer::reset() {
+    active = false;
+    panning = false;
+    longPressFired = false;
+    kinetic = false;
+    historyCount = 0;
+    historyHead = 0;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// SAMPLES
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UIGestureRecognizer::addSample(int16_t x, int16_t y, bool pressed, unsigned long timestamp) {
+    if (!pressed) {
+        if (active) {
+            finishGesture(timestamp);
+            active = false;
+        }
+        return;
+    }
+
+    if (!active) {
+        // Neuer Touch - laufendes Kinetic-Scrolling anhalten
+        active = true;
+        panning = false;
+        longPressFired = false;
+        kinetic = false;
+        historyCount = 0;
+        startX = lastX = x;
+        startY = lastY = y;
+        startTime = lastSampleTime = timestamp;
+        pushHistory(x, y, timestamp);
+        return;
+    }
+
+    pushHistory(x, y, timestamp);
+
+    int16_t prevX = lastX;
+    int16_t prevY = lastY;
+    lastX = x;
+    lastY = y;
+    lastSampleTime = timestamp;
+
+    if (!panning) {
+        if (abs(x - startX) > GESTURE_TAP_SLOP || abs(y - startY) > GESTURE_TAP_SLOP) {
+            // Pan beginnt - Strecke seit Touch-Start nachliefern
+            panning = true;
+            float vx, vy;
+            estimateVelocity(&vx, &vy);
+            emit(EventType::PAN, x, y, x - startX, y - startY, vx, vy);
+        } else if (!longPressFired && timestamp - startTime >= GESTURE_LONG_PRESS_MS) {
+            longPressFired = true;
+            emit(EventType::LONG_PRESS, startX, startY, 0, 0, 0, 0);
+        }
+        return;
+    }
+
+    if (x != prevX || y != prevY) {
+        float vx, vy;
+        estimateVelocity(&vx, &vy);
+        emit(EventType::PAN, x, y, x - prevX, y - prevY, vx, vy);
+    }
+}
+
+void UIGestureRecognizer::update(unsigned long now) {
+    // Long-Press auch ohne neue Samples (Finger ruht)
+    if (active && !panning && !longPressFired && now - startTime >= GESTURE_LONG_PRESS_MS) {
+        longPressFired = true;
+        emit(EventType::LONG_PRESS, startX, startY, 0, 0, 0, 0);
+    }
+
+    if (kinetic) {
+        updateKinetic(now);
+    }
+}
+
+void UIGestureRecognizer::pushHistory(int16_t x, int16_t y, unsigned long t) {
+    history[historyHead] = {x, y, t};
+    historyHead = (historyHead + 1) % HISTORY_SIZE;
+    if (historyCount < HISTORY_SIZE) historyCount++;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// KLASSIFIZIERUNG
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UIGestureRecognizer::finishGesture(unsigned long releaseTime) {
+    if (!panning) {
+        if (!longPressFired) {
+            emit(EventType::TAP, lastX, lastY, 0, 0, 0, 0);
+        }
+        return;
+    }
+
+    float vx, vy;
+    estimateVelocity(&vx, &vy);
+
+    // Finger vor dem Loslassen angehalten → keine Restgeschwindigkeit
+    if (releaseTime - lastSampleTime > GESTURE_VELOCITY_WINDOW_MS) {
+        vx = 0;
+        vy = 0;
+    }
+
+    int16_t dx = lastX - startX;
+    int16_t dy = lastY - startY;
+    int16_t adx = abs(dx);
+    int16_t ady = abs(dy);
+
+    // Swipe: lang genug, eindeutige Achse, schnell genug
+    SwipeDirection dir = SwipeDirection::NONE;
+    if (max(adx, ady) >= GESTURE_SWIPE_MIN_DISTANCE) {
+        if (adx >= 2 * ady && fabsf(vx) >= GESTURE_SWIPE_MIN_VELOCITY) {
+            dir = (dx < 0) ? SwipeDirection::LEFT : SwipeDirection::RIGHT;
+        } else if (ady >= 2 * adx && fabsf(vy) >= GESTURE_SWIPE_MIN_VELOCITY) {
+            dir = (dy < 0) ? SwipeDirection::UP : SwipeDirection::DOWN;
+        }
+    }
+
+    if (dir != SwipeDirection::NONE) {
+        emit(EventType::SWIPE, lastX, lastY, dx, dy, vx, vy, static_cast<int>(dir));
+    }
+
+    if (sqrtf(vx * vx + vy * vy) >= GESTURE_FLING_MIN_VELOCITY) {
+        emit(EventType::FLING, lastX, lastY, dx, dy, vx, vy);
+    }
+}
+
+void UIGestureRecognizer::estimateVelocity(float* vx, float* vy) const {
+    *vx = 0;
+    *vy = 0;
+    if (historyCount < 2) return;
+
+    const Sample& newest = history[(historyHead + HISTORY_SIZE - 1) % HISTORY_SIZE];
+
+    // Samples im Zeitfenster sammeln (Zeit relativ zum neuesten Sample)
+    float sumT = 0, sumX = 0, sumY = 0;
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < historyCount; i++) {
+        const Sample& s = history[(historyHead + HISTORY_SIZE - 1 - i) % HISTORY_SIZE];
+        if (newest.t - s.t > GESTURE_VELOCITY_WINDOW_MS && n >= 2) break;
+        sumT += (float)(long)(s.t - newest.t);
+        sumX += s.x;
+        sumY += s.y;
+        n++;
+    }
+
+    float meanT = sumT / n;
+    float meanX = sumX / n;
+    float meanY = sumY / n;
+
+    // Lineare Regression: Steigung = Cov(t, pos) / Var(t)
+    float varT = 0, covX = 0, covY = 0;
+    for (uint8_t i = 0; i < n; i++) {
+        const Sample& s = history[(historyHead + HISTORY_SIZE - 1 - i) % HISTORY_SIZE];
+        float dt = (float)(long)(s.t - newest.t) - meanT;
+        varT += dt * dt;
+        covX += dt * (s.x - meanX);
+        covY += dt * (s.y - meanY);
+    }
+
+    if (varT <= 0) return;
+
+    // px/ms → px/s
+    *vx = covX / varT * 1000.0f;
+    *vy = covY / varT * 1000.0f;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// KINETIC-SCROLLING
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UIGestureRecognizer::startKinetic(float vx, float vy) {
+    kinetic = true;
+    kineticVX = vx;
+    kineticVY = vy;
+    kineticRestX = 0;
+    kineticRestY = 0;
+    kineticLastTime = millis();
+}
+
+void UIGestureRecognizer::updateKinetic(unsigned long now) {
+    unsigned long elapsed = now - kineticLastTime;
+    if (elapsed < 16) return;  // Max. ~60 Schritte pro Sekunde
+    kineticLastTime = now;
+
+    float dt = elapsed / 1000.0f;
+
+    kineticRestX += kineticVX * dt;
+    kineticRestY += kineticVY * dt;
+    int16_t dx = (int16_t)kineticRestX;
+    int16_t dy = (int16_t)kineticRestY;
+    kineticRestX -= dx;
+    kineticRestY -= dy;
+
+    // Exponentielles Abbremsen
+    float decay = 1.0f - GESTURE_KINETIC_FRICTION * dt;
+    if (decay < 0) decay = 0;
+    kineticVX *= decay;
+    kineticVY *= decay;
+
+    if (sqrtf(kineticVX * kineticVX + kineticVY * kineticVY) < GESTURE_KINETIC_MIN_VELOCITY) {
+        kinetic = false;
+    }
+
+    if (dx != 0 || dy != 0) {
+        emit(EventType::PAN, lastX, lastY, dx, dy, kineticVX, kineticVY, 1);
+    }
+}
+
+void UIGestureRecognizer::emit(EventType type, int16_t x, int16_t y, int16_t dx, int16_t dy,
+                               float vx, float vy, int value) {
+    if (!callback) return;
+
+    EventData data = {x, y, value, 0, nullptr, dx, dy, vx, vy};
+    callback(type, &data);
+}
@@ -0,0 +1,42 @@
+/**
+ * UIHitGrid.cpp
+ */
+
+#include "include/UIHitGrid.h"
+
+UIHitGrid::UIHitGrid() {
+    clear();
+}
+
+UIHitGrid::~UIHitGrid() {
+}
+
+void UIHitGrid::clear() {
+    cellStart.assign(CELL_COUNT + 1, 0);
+    cellItems.clear();
+}
+
+UIElement* UIHitGrid::hitTest(int16_t x, int16_t y) const {
+    return hitTest(x, y, [](UIElement*) { return true; });
+}
+
+bool UIHitGrid::cellRange(UIElement* element, int16_t* c0, int16_t* r0, int16_t* c1, int16_t* r1) {
+    int16_t ex, ey, ew, eh;
+    element->getBounds(&ex, &ey, &ew, &eh);
+
+    if (ew <= 0 || eh <= 0) return false;
+
+    int16_t right = ex + ew - 1;
+    int16_t bottom = ey + eh - 1;
+
+    if (right < 0 || bottom < 0 || ex >= DISPLAY_WIDTH || ey >= DISPLAY_HEIGHT) {
+        return false;
+    }
+
+    *c0 = constrain(ex, 0, DISPLAY_WIDTH - 1) / CELL_SIZE;
+    *r0 = constrain(ey, 0, DISPLAY_HEIGHT - 1) / CELL_SIZE;
+    *c1 = constrain(right, 0, DISPLAY_WIDTH - 1) / CELL_SIZE;
+    *r1 = constrain(bottom, 0, DISPLAY_HEIGHT - 1) / CELL_SIZE;
+
+    return true;
+}
@@ -0,0 +1,189 @@
+/**
+ * UIJoystickView.cpp
+ */
+
+#include "include/UIJoystickView.h"
+
+UIJoystickView::UIJoystickView(int16_t x, int16_t y, int16_t size)
+    : UIElement(x, y, size, size), valueX(0), valueY(0),
+      drawnKnobX(0), drawnKnobY(0), fullRedraw(true),
+      background(nullptr), backgroundW(0), backgroundH(0), backgroundFailed(false) {
+
+    setStyleRole(StyleRole::JOYSTICK);
+}
+
+UIJoystickView::~UIJoystickView() {
+    releaseBackground();
+}
+
+void UIJoystickView::draw(TFT_eSPI* tft) {
+    if (!visible) return;
+
+    ensureBackground(tft);
+
+    int16_t kx, ky;
+    knobPosition(&kx, &ky);
+
+    if (fullRedraw || !painted || !background) {
+        // Erstes Zeichnen / Hintergrund überschrieben → alles
+        if (background) {
+            restoreBackground(tft, x, y, width, height);
+        } else {
+            drawStatic(tft, x, y);
+        }
+    } else if (kx != drawnKnobX || ky != drawnKnobY) {
+        // Nur alten Knopf entfernen
+        restoreBackground(tft, drawnKnobX - KNOB_RADIUS, drawnKnobY - KNOB_RADIUS, KNOB_SIZE, KNOB_SIZE);
+    }
+
+    drawKnob(tft, kx, ky);
+
+    drawnKnobX = kx;
+    drawnKnobY = ky;
+    fullRedraw = false;
+    needsRedraw = false;
+}
+
+void UIJoystickView::handleTouch(int16_t tx, int16_t ty, bool isPressed) {
+    // Reine Anzeige (Position kommt vom Hardware-Joystick)
+}
+
+void UIJoystickView::getDirtyBounds(int16_t* outX, int16_t* outY, int16_t* outW, int16_t* outH) {
+    if (fullRedraw || !background || backgroundStale()) {
+        getPaintBounds(outX, outY, outW, outH);
+        return;
+    }
+
+    // Alter + neuer Knopf
+    int16_t kx, ky;
+    knobPosition(&kx, &ky);
+
+    int16_t x0 = max((int16_t)(min(kx, drawnKnobX) - KNOB_RADIUS), x);
+    int16_t y0 = max((int16_t)(min(ky, drawnKnobY) - KNOB_RADIUS), y);
+    int16_t x1 = min((int16_t)(max(kx, drawnKnobX) + KNOB_RADIUS + 1), (int16_t)(x + width));
+    int16_t y1 = min((int16_t)(max(ky, drawnKnobY) + KNOB_RADIUS + 1), (int16_t)(y + height));
+
+    if (outX) *outX = x0;
+    if (outY) *outY = y0;
+    if (outW) *outW = x1 - x0;
+    if (outH) *outH = y1 - y0;
+}
+
+void UIJoystickView::setValue(int16_t newX, int16_t newY) {
+    newX = constrain(newX, -100, 100);
+    newY = constrain(newY, -100, 100);
+
+    if (newX == valueX && newY == valueY) return;
+
+    valueX = newX;
+    valueY = newY;
+    needsRedraw = true;
+}
+
+void UIJoystickView::setKnobColor(uint16_t color) {
+    setStyleField(STYLE_ACCENT, color);
+}
+
+void UIJoystickView::onStyleChanged() {
+    // Gecachten Hintergrund mit den neuen Farben neu aufbauen
+    if (background) drawStatic(background, 0, 0);
+    fullRedraw = true;
+    needsRedraw = true;
+}
+
+void UIJoystickView::knobPosition(int16_t* outX, int16_t* outY) const {
+    int16_t radius = ringRadius();
+    *outX = x + width / 2 + (valueX * radius) / 100;
+    *outY = y + height / 2 - (valueY * radius) / 100;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Hintergrund-Cache
+// ═══════════════════════════════════════════════════════════════
+
+void UIJoystickView::ensureBackground(TFT_eSPI* tft) {
+    if (backgroundStale()) {
+        // Größe geändert (Flex-Layout): alter Sprite würde mit falscher Breite indiziert
+        releaseBackground();
+        backgroundFailed = false;
+        fullRedraw = true;
+    }
+    if (background || backgroundFailed) return;
+
+    background = new TFT_eSprite(tft);
+    background->setColorDepth(16);
+    background->setAttribute(PSRAM_ENABLE, true);
+
+    if (!background->createSprite(width, height)) {
+        Serial.println("UIJoystickView: ⚠️ Hintergrund-Sprite nicht verfügbar, zeichne komplett");
+        delete background;
+        background = nullptr;
+        backgroundFailed = true;
+        return;
+    }
+
+    backgroundW = width;
+    backgroundH = height;
+    drawStatic(background, 0, 0);
+}
+
+void UIJoystickView::releaseBackground() {
+    if (!background) return;
+
+    background->deleteSprite();
+    delete background;
+    background = nullptr;
+    backgroundW = backgroundH = 0;
+}
+
+void UIJoystickView::drawStatic(TFT_eSPI* tft, int16_t originX, int16_t originY) {
+    int16_t cx = originX + width / 2;
+    int16_t cy = originY + height / 2;
+    int16_t radius = ringRadius();
+    const ElementStyle& st = style();
+
+    tft->fillRect(originX, originY, width, height, st.bgColor);
+
+    tft->drawCircle(cx, cy, radius, st.borderColor);
+    tft->drawCircle(cx, cy, radius + 1, st.borderColor);
+    tft->drawLine(cx - 20, cy, cx + 20, cy, COLOR_GRAY);
+    tft->drawLine(cx, cy - 20, cx, cy + 20, COLOR_GRAY);
+}
+
+void UIJoystickView::restoreBackground(TFT_eSPI* tft, int16_t rx, int16_t ry, int16_t rw, int16_t rh) {
+    // Auf das Element begrenzen
+    int16_t x0 = max(rx, x);
+    int16_t y0 = max(ry, y);
+    int16_t x1 = min((int16_t)(rx + rw), (int16_t)(x + width));
+    int16_t y1 = min((int16_t)(ry + rh), (int16_t)(y + height));
+    if (x1 <= x0 || y1 <= y0) return;
+
+    rw = x1 - x0;
+    rh = y1 - y0;
+
+    const uint16_t* pixels = (const uint16_t*)background->getPointer();
+
+    if (rw == width) {
+        // Volle Zeilen liegen zusammenhängend im Sprite
+        pushPixels(tft, x0, y0, rw, rh, pixels + (y0 - y) * width);
+    } else {
+        // Knopf-Ausschnitt zusammenkopieren → ein Transfer statt einer pro Zeile
+        uint16_t patch[KNOB_SIZE * KNOB_SIZE];
+
+        if ((int32_t)rw * rh <= KNOB_SIZE * KNOB_SIZE) {
+            for (int16_t row = 0; row < rh; row++) {
+                memcpy(&patch[row * rw], pixels + (y0 - y + row) * width + (x0 - x), rw * sizeof(uint16_t));
+            }
+            pushPixels(tft, x0, y0, rw, rh, patch);
+        } else {
+            for (int16_t row = 0; row < rh; row++) {
+                pushPixels(tft, x0, y0 + row, rw, 1, pixels + (y0 - y + row) * width + (x0 - x));
+            }
+        }
+    }
+}
+
+void UIJoystickView::drawKnob(TFT_eSPI* tft, int16_t kx, int16_t ky) {
+    tft->fillCircle(kx, ky, KNOB_RADIUS, style().accentColor);
+    tft->fillCircle(kx, ky, 3, COLOR_CYAN);
+}
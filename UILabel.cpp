@@ -6,13 +6,14 @@
 
 UILabel::UILabel(int16_t x, int16_t y, int16_t w, int16_t h, const char* txt)
     : UIElement(x, y, w, h), alignment(TextAlignment::CENTER), 
-      fontSize(2), transparent(false) {
+      fontSize(2), transparent(false), font(nullptr),
+      drawnLeft(0), glyphAdvance(0), glyphsValid(false) {
     
     strncpy(text, txt, sizeof(text) - 1);
     text[sizeof(text) - 1] = '\0';
+    drawnText[0] = '\0';
     
-    style.bgColor = COLOR_BLACK;
-    style.borderWidth = 0;
+    setStyleRole(StyleRole::LABEL);
 }
 
 UILabel::~UILabel() {
@@ -21,7 +22,16 @@ UILabel::~UILabel() {
 void UILabel::draw(TFT_eSPI* tft) {
     if (!visible) return;
     
-    drawLabel(tft);
+    int16_t firstChar, endChar;
+    if (getChangedRun(&firstChar, &endChar)) {
+        // Nur geänderte Zeichen (leerer Run → Pixel sind bereits aktuell)
+        if (endChar > firstChar) {
+            drawRun(tft, firstChar, endChar);
+        }
+    } else {
+        drawLabel(tft);
+    }
+    
     needsRedraw = false;
 }
 
@@ -39,6 +49,11 @@ void UILabel::handleTouch(int16_t tx, int16_t ty, bool isPressed) {
 }
 
 void UILabel::setText(const char* txt) {
+    if (!txt) txt = "";
+    
+    // Gleicher Text → nichts zu tun (Pages setzen Werte zyklisch)
+    if (strncmp(text, txt, sizeof(text) - 1) == 0) return;
+    
     strncpy(text, txt, sizeof(text) - 1);
     text[sizeof(text) - 1] = '\0';
 
@@ -46,67 +61,237 @@ void UILabel::setText(const char* txt) {
 }
 
 void UILabel::setTextColor(uint16_t color) {
-    style.textColor = color;
-    needsRedraw = true;
+    if (style().textColor == color) return;
+    
+    setStyleField(STYLE_TEXT, color);
+}
+
+void UILabel::setBgColor(uint16_t color) {
+    if (style().bgColor == color) return;
+    
+    setStyleField(STYLE_BG, color);
 }
 
 void UILabel::setAlignment(TextAlignment align) {
+    if (alignment == align) return;
+    
     alignment = align;
+    glyphsValid = false;
     needsRedraw = true;
 }
 
 void UILabel::setFontSize(uint8_t size) {
-    if (size >= 1 && size <= 7) {
+    if (size >= 1 && size <= 7 && size != fontSize) {
         fontSize = size;
+        glyphsValid = false;
         needsRedraw = true;
     }
 }
 
 void UILabel::setTransparent(bool trans) {
+    if (transparent == trans) return;
+    
     transparent = trans;
+    glyphsValid = false;
+    needsRedraw = true;
+}
+
+void UILabel::setFont(UIFont* newFont) {
+    if (font == newFont) return;
+    
+    font = newFont;
+    glyphsValid = false;
     needsRedraw = true;
 }
 
+void UILabel::measure(int16_t* outW, int16_t* outH) {
+    int16_t textW, textH;
+    if (font && font->isLoaded()) {
+        textW = font->textWidth(text);
+        textH = font->getLineHeight();
+    } else {
+        // GLCD Font 1: 6x8 Pixel pro Zeichen, skaliert
+        textW = strlen(text) * 6 * fontSize;
+        textH = 8 * fontSize;
+    }
+    
+    // Abstand wie getTextX() + Rahmen
+    int16_t inset = style().borderWidth;
+    if (outW) *outW = textW + 10 + 2 * inset;
+    if (outH) *outH = textH + 8 + 2 * inset;
+}
+
+void UILabel::getDirtyBounds(int16_t* outX, int16_t* outY, int16_t* outW, int16_t* outH) {
+    int16_t firstChar, endChar;
+    if (!getChangedRun(&firstChar, &endChar) || endChar <= firstChar) {
+        getPaintBounds(outX, outY, outW, outH);
+        return;
+    }
+    
+    // Spalten der geänderten Zeichen, volle Label-Höhe
+    int16_t runX = drawnLeft + firstChar * glyphAdvance;
+    int16_t runEnd = drawnLeft + endChar * glyphAdvance;
+    runX = max(runX, x);
+    runEnd = min(runEnd, (int16_t)(x + width));
+    
+    if (outX) *outX = runX;
+    if (outY) *outY = y;
+    if (outW) *outW = max((int16_t)0, (int16_t)(runEnd - runX));
+    if (outH) *outH = height;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Glyph-Run Cache
+// ═══════════════════════════════════════════════════════════════
+
+bool UILabel::getChangedRun(int16_t* firstChar, int16_t* endChar) {
+    // Nur deckend, Festbreiten-Font, gleiche Geometrie wie beim letzten Zeichnen
+    if (!glyphsValid || transparent || glyphAdvance == 0 || !painted) return false;
+    if (paintedX != x || paintedY != y || paintedW != width || paintedH != height) return false;
+    
+    size_t oldLen = strlen(drawnText);
+    size_t newLen = strlen(text);
+    
+    // Zentriert/rechtsbündig verschiebt sich der Text bei Längenänderung
+    if (textLeft(newLen) != drawnLeft) return false;
+    
+    size_t maxLen = max(oldLen, newLen);
+    int16_t first = -1;
+    int16_t last = -1;
+    
+    for (size_t i = 0; i < maxLen; i++) {
+        char oldChar = i < oldLen ? drawnText[i] : '\0';
+        char newChar = i < newLen ? text[i] : '\0';
+        if (oldChar != newChar) {
+            if (first < 0) first = i;
+            last = i;
+        }
+    }
+    
+    if (first < 0) {
+        *firstChar = 0;
+        *endChar = 0;
+        return true;
+    }
+    
+    int16_t runX = drawnLeft + first * glyphAdvance;
+    int16_t runEnd = drawnLeft + (last + 1) * glyphAdvance;
+    
+    // Run muss innerhalb der Innenfläche liegen (Rahmen, runde Ecken)
+    const ElementStyle& st = style();
+    int16_t inset = max((int16_t)st.borderWidth, (int16_t)st.cornerRadius);
+    if (runX < x + inset || runEnd > x + width - inset) return false;
+    
+    *firstChar = first;
+    *endChar = last + 1;
+    return true;
+}
+
+int16_t UILabel::textLeft(size_t length) {
+    int16_t textWidth = length * glyphAdvance;
+    int16_t textX = getTextX();
+    
+    switch (alignment) {
+        case TextAlignment::CENTER:
+            return textX - textWidth / 2;
+        case TextAlignment::RIGHT:
+            return textX - textWidth;
+        default:
+            return textX;
+    }
+}
+
+void UILabel::drawRun(TFT_eSPI* tft, int16_t firstChar, int16_t endChar) {
+    int16_t runX = drawnLeft + firstChar * glyphAdvance;
+    int16_t runW = (endChar - firstChar) * glyphAdvance;
+    const ElementStyle& st = style();
+    int16_t inset = st.borderWidth;
+    
+    // Alte Glyphen löschen (Innenhöhe, Rahmen bleibt)
+    tft->fillRect(runX, y + inset, runW, height - 2 * inset, st.bgColor);
+    
+    // Neue Zeichen des Runs (kürzerer Text → evtl. keine)
+    size_t newLen = strlen(text);
+    if ((size_t)firstChar < newLen) {
+        char run[sizeof(text)];
+        size_t count = min((size_t)(endChar - firstChar), newLen - firstChar);
+        memcpy(run, text + firstChar, count);
+        run[count] = '\0';
+        
+        tft->setTextSize(fontSize);
+        tft->setTextDatum(ML_DATUM);
+        tft->setTextColor(st.textColor, st.bgColor);
+        tft->drawString(run, runX, y + height / 2);
+    }
+    
+    memcpy(drawnText, text, sizeof(drawnText));
+}
+
 void UILabel::drawLabel(TFT_eSPI* tft) {
+    const ElementStyle& st = style();
     // Hintergrund (falls nicht transparent)
     if (!transparent) {
-        if (style.cornerRadius > 0) {
-            fillRoundRect(tft, x, y, width, height, style.cornerRadius, style.bgColor);
+        if (st.cornerRadius > 0) {
+            fillRoundRect(tft, x, y, width, height, st.cornerRadius, st.bgColor);
         } else {
-            tft->fillRect(x, y, width, height, style.bgColor);
+            tft->fillRect(x, y, width, height, st.bgColor);
         }
     }
     
     // Rahmen (falls borderWidth > 0)
-    if (style.borderWidth > 0) {
-        if (style.cornerRadius > 0) {
-            drawRoundRect(tft, x, y, width, height, style.cornerRadius, style.borderColor);
+    if (st.borderWidth > 0) {
+        if (st.cornerRadius > 0) {
+            drawRoundRect(tft, x, y, width, height, st.cornerRadius, st.borderColor);
         } else {
-            tft->drawRect(x, y, width, height, style.borderColor);
+            tft->drawRect(x, y, width, height, st.borderColor);
         }
     }
     
+    // Atlas-Font: eine gemischte Glyph-Zelle pro Zeichen
+    if (font && font->isLoaded()) {
+        int16_t textWidth = font->textWidth(text);
+        int16_t textX = getTextX();
+        if (alignment == TextAlignment::CENTER) textX -= textWidth / 2;
+        else if (alignment == TextAlignment::RIGHT) textX -= textWidth;
+        
+        font->drawText(tft, text, textX, y + (height - font->getLineHeight()) / 2,
+                       st.textColor, st.bgColor);
+        
+        // Proportional → kein Glyph-Run, Änderungen zeichnen das Label komplett
+        glyphAdvance = 0;
+        glyphsValid = false;
+        return;
+    }
+    
     // Text
     tft->setTextSize(fontSize);
     tft->setTextDatum(getDatum());
-    tft->setTextColor(style.textColor, transparent ? style.bgColor : style.bgColor);
+    tft->setTextColor(st.textColor, transparent ? st.bgColor : st.bgColor);
     
-    int16_t textX = x;
+    int16_t textX = getTextX();
     int16_t textY = y + height / 2;
     
+    tft->drawString(text, textX, textY);
+    
+    // Glyph-Run merken (nur Festbreiten-Fonts, z.B. GLCD Font 1)
+    int16_t narrow = tft->textWidth("i");
+    int16_t wide = tft->textWidth("W");
+    glyphAdvance = (narrow > 0 && narrow == wide && narrow < 256) ? narrow : 0;
+    
+    memcpy(drawnText, text, sizeof(drawnText));
+    drawnLeft = textLeft(strlen(text));
+    glyphsValid = true;
+}
+
+int16_t UILabel::getTextX() {
     switch (alignment) {
         case TextAlignment::LEFT:
-            textX = x + 5;
-            break;
-        case TextAlignment::CENTER:
-            textX = x + width / 2;
-            break;
+            return x + 5;
         case TextAlignment::RIGHT:
-            textX = x + width - 5;
-            break;
+            return x + width - 5;
+        default:
+            return x + width / 2;
     }
-    
-    tft->drawString(text, textX, textY);
 }
 
 uint8_t UILabel::getDatum() {
@@ -18,8 +18,13 @@ UILayout::UILayout()
     , btnSleep(nullptr)
     , lblBattery(nullptr)
     , lblFooter(nullptr)
+    , contentColor(COLOR_BLACK)
+    , backTarget(-1)
+    , batteryPercent(-1)
+    , batteryColor(0)
     , initialized(false)
 {
+    memset(&stats, 0, sizeof(stats));
 }
 
 UILayout::~UILayout() {
@@ -45,23 +50,22 @@ bool UILayout::init(UIManager* uiMgr, TFT_eSPI* display, BatteryMonitor* bat, Po
     calculateBounds();
     
     // ═══════════════════════════════════════════════════════════════
-    // Header & Footer Hintergrund zeichnen
+    // Header & Footer Hintergrund zeichnen (einmalig, danach nur Damage)
     // ═══════════════════════════════════════════════════════════════
-    drawHeaderBackground();
-    drawFooterBackground();
+    drawHeaderBackground(tft);
+    drawFooterBackground(tft);
+    
+    // Freigelegte Bereiche (versteckte/verschobene Widgets) neu hinterlegen
+    ui->setBackgroundPainter([this](TFT_eSPI* display, int16_t x, int16_t y, int16_t w, int16_t h) {
+        paintBackground(display, x, y, w, h);
+    });
     
     // ═══════════════════════════════════════════════════════════════
     // Zurück-Button erstellen (links im Header)
     // ═══════════════════════════════════════════════════════════════
     btnBack = new UIButton(5, 3, 60, 34, "<");
     btnBack->setVisible(false);  // Initial versteckt
-    ElementStyle backStyle;
-    backStyle.bgColor = COLOR_BLUE;
-    backStyle.borderColor = COLOR_WHITE;
-    backStyle.textColor = COLOR_WHITE;
-    backStyle.borderWidth = 2;
-    backStyle.cornerRadius = 5;
-    btnBack->setStyle(backStyle);
+    btnBack->setStyleRole(StyleRole::HEADER_BUTTON);
     ui->add(btnBack);
     
     Serial.println("  ✅ Zurück-Button erstellt");
@@ -73,12 +77,7 @@ bool UILayout::init(UIManager* uiMgr, TFT_eSPI* display, BatteryMonitor* bat, Po
     lblTitle->setFontSize(2);
     lblTitle->setAlignment(TextAlignment::CENTER);
     lblTitle->setTransparent(true);
-    ElementStyle titleStyle;
-    titleStyle.bgColor = COLOR_DARKGRAY;
-    titleStyle.textColor = COLOR_WHITE;
-    titleStyle.borderWidth = 0;
-    titleStyle.cornerRadius = 0;
-    lblTitle->setStyle(titleStyle);
+    lblTitle->setStyleRole(StyleRole::HEADER_TITLE);
     lblTitle->setVisible(true);
     lblTitle->setNeedsRedraw(true);
     ui->add(lblTitle);
@@ -89,13 +88,7 @@ bool UILayout::init(UIManager* uiMgr, TFT_eSPI* display, BatteryMonitor* bat, Po
     // Sleep-Button (rechts vor Battery-Icon)
     // ═══════════════════════════════════════════════════════════════
     btnSleep = new UIButton(360, 3, 50, 34, "Z");
-    ElementStyle sleepStyle;
-    sleepStyle.bgColor = COLOR_PURPLE;
-    sleepStyle.borderColor = COLOR_WHITE;
-    sleepStyle.textColor = COLOR_WHITE;
-    sleepStyle.borderWidth = 2;
-    sleepStyle.cornerRadius = 5;
-    btnSleep->setStyle(sleepStyle);
+    btnSleep->setStyleRole(StyleRole::SLEEP_BUTTON);
     btnSleep->setVisible(true);
     btnSleep->setNeedsRedraw(true);
     
@@ -115,13 +108,7 @@ bool UILayout::init(UIManager* uiMgr, TFT_eSPI* display, BatteryMonitor* bat, Po
     lblBattery->setFontSize(1);
     lblBattery->setAlignment(TextAlignment::CENTER);
     lblBattery->setTransparent(false);
-    ElementStyle batteryStyle;
-    batteryStyle.bgColor = COLOR_GREEN;
-    batteryStyle.borderColor = COLOR_WHITE;
-    batteryStyle.textColor = COLOR_WHITE;
-    batteryStyle.borderWidth = 2;
-    batteryStyle.cornerRadius = 3;
-    lblBattery->setStyle(batteryStyle);
+    lblBattery->setStyleRole(StyleRole::BATTERY);
     
     // Initial-Text setzen (wird in loop() aktualisiert)
     lblBattery->setText("---%");
@@ -139,12 +126,7 @@ bool UILayout::init(UIManager* uiMgr, TFT_eSPI* display, BatteryMonitor* bat, Po
     lblFooter->setFontSize(1);
     lblFooter->setAlignment(TextAlignment::CENTER);
     lblFooter->setTransparent(true);
-    ElementStyle footerStyle;
-    footerStyle.bgColor = COLOR_DARKGRAY;
-    footerStyle.textColor = COLOR_WHITE;
-    footerStyle.borderWidth = 0;
-    footerStyle.cornerRadius = 0;
-    lblFooter->setStyle(footerStyle);
+    lblFooter->setStyleRole(StyleRole::FOOTER);
     lblFooter->setVisible(true);
     lblFooter->setNeedsRedraw(true);
     ui->add(lblFooter);
@@ -186,36 +168,23 @@ void UILayout::calculateBounds() {
 void UILayout::drawHeader() {
     if (!initialized) return;
     
-    drawHeaderBackground();
-    
-    // Widgets neu zeichnen
-    if (btnBack && btnBack->isVisible()) {
-        btnBack->setNeedsRedraw(true);
-    }
-    if (lblTitle) {
-        lblTitle->setNeedsRedraw(true);
-    }
-    if (btnSleep) {
-        btnSleep->setNeedsRedraw(true);
-    }
-    if (lblBattery) {
-        lblBattery->setNeedsRedraw(true);
-    }
+    // Compositor zeichnet Hintergrund (paintBackground) + alle Header-Widgets im Bereich
+    ui->invalidate(headerBounds.x, headerBounds.y, headerBounds.width, headerBounds.height);
+    stats.repaints++;
 }
 
 void UILayout::drawFooter() {
     if (!initialized) return;
     
-    drawFooterBackground();
-    
-    if (lblFooter) {
-        lblFooter->setNeedsRedraw(true);
-    }
+    ui->invalidate(footerBounds.x, footerBounds.y, footerBounds.width, footerBounds.height);
+    stats.repaints++;
 }
 
 void UILayout::clearContent(uint16_t color) {
     if (!initialized || !tft) return;
     
+    contentColor = color;
+    
     tft->fillRect(
         contentBounds.x,
         contentBounds.y,
@@ -227,6 +196,10 @@ void UILayout::clearContent(uint16_t color) {
 
 void UILayout::setPageTitle(const char* title) {
     if (!initialized || !lblTitle) return;
+    if (!title) title = "";
+    
+    // Das Label hält den dargestellten Titel
+    if (!countField(LayoutField::TITLE, strcmp(lblTitle->getText(), title) != 0)) return;
     
     lblTitle->setText(title);
     Serial.printf("UILayout: Titel: '%s'\n", title);
@@ -235,25 +208,24 @@ void UILayout::setPageTitle(const char* title) {
 void UILayout::setBackButton(bool show, int targetPageId) {
     if (!initialized || !btnBack) return;
     
+    int target = (show && pageManager && targetPageId >= 0) ? targetPageId : backTarget;
+    if (!countField(LayoutField::BACK_BUTTON, show != btnBack->isVisible() || target != backTarget)) return;
+    
     btnBack->setVisible(show);
     
-    if (show && pageManager && targetPageId >= 0) {
-        static int lastTargetPageId = -1;
+    if (target != backTarget) {
+        btnBack->off(EventType::CLICK);
         
-        if (lastTargetPageId != targetPageId) {
-            btnBack->off(EventType::CLICK);
-            
-            PageManager* pm = pageManager;
-            
-            btnBack->on(EventType::CLICK, [pm, targetPageId](EventData* data) {
-                Serial.printf("UILayout: Zurück → Page %d\n", targetPageId);
-                if (pm) {
-                    pm->showPageDeferred(targetPageId);
-                }
-            });
-            
-            lastTargetPageId = targetPageId;
-        }
+        PageManager* pm = pageManager;
+        
+        btnBack->on(EventType::CLICK, [pm, target](EventData* data) {
+            Serial.printf("UILayout: Zurück → Page %d\n", target);
+            if (pm) {
+                pm->showPageDeferred(target);
+            }
+        });
+        
+        backTarget = target;
     }
     
     Serial.printf("UILayout: Zurück-Button: %s\n", show ? "sichtbar" : "versteckt");
@@ -263,30 +235,55 @@ void UILayout::updateBattery() {
     if (!initialized || !lblBattery || !battery) return;
     
     uint8_t percent = battery->getPercent();
+    uint16_t color = getBatteryColor(percent);
+    
+    // Gleiche Anzeige → weder Text formatieren noch Damage
+    if (!countField(LayoutField::BATTERY, percent != batteryPercent || color != batteryColor)) return;
     
     // Text: Prozent-Anzeige
     char buffer[8];
-    sprintf(buffer, "%d%%", percent);
+    snprintf(buffer, sizeof(buffer), "%d%%", percent);
     lblBattery->setText(buffer);
     
-    // Farbe aktualisieren
-    updateBatteryColor(percent);
+    // Rahmen/Text aus dem Theme, nur der Hintergrund zeigt den Ladezustand
+    lblBattery->setBgColor(color);
+    
+    batteryPercent = percent;
+    batteryColor = color;
 }
 
 void UILayout::setFooterText(const char* text) {
     if (!initialized || !lblFooter) return;
+    if (!text) text = "";
+    
+    if (!countField(LayoutField::FOOTER, strcmp(lblFooter->getText(), text) != 0)) return;
     
     lblFooter->setText(text);
 }
 
+void UILayout::printStats() {
+    static const char* const FIELD_NAMES[] = {"Titel", "Zurück-Button", "Battery", "Footer"};
+    
+    Serial.println("\n=== Layout (Header/Footer) ===");
+    Serial.println("Feld            Geändert  Unverändert");
+    for (uint8_t i = 0; i < (uint8_t)LayoutField::COUNT; i++) {
+        Serial.printf("%-15s %8lu  %11lu\n", FIELD_NAMES[i],
+                      (unsigned long)stats.changed[i], (unsigned long)stats.unchanged[i]);
+    }
+    Serial.printf("Neu gezeichnet:  %lu x Header/Footer komplett (Seitenwechsel: nie)\n",
+                  (unsigned long)stats.repaints);
+    Serial.printf("Battery:         %d%% angezeigt\n", batteryPercent);
+    Serial.println("==============================\n");
+}
+
 // ═══════════════════════════════════════════════════════════════
 // Private Methoden
 // ═══════════════════════════════════════════════════════════════
 
-void UILayout::drawHeaderBackground() {
-    if (!tft) return;
+void UILayout::drawHeaderBackground(TFT_eSPI* target) {
+    if (!target) return;
     
-    tft->fillRect(
+    target->fillRect(
         headerBounds.x,
         headerBounds.y,
         headerBounds.width,
@@ -295,7 +292,7 @@ void UILayout::drawHeaderBackground() {
     );
     
     // Trennlinie unten
-    tft->drawLine(
+    target->drawLine(
         0,
         headerBounds.height - 1,
         DISPLAY_WIDTH,
@@ -304,11 +301,11 @@ void UILayout::drawHeaderBackground() {
     );
 }
 
-void UILayout::drawFooterBackground() {
-    if (!tft) return;
+void UILayout::drawFooterBackground(TFT_eSPI* target) {
+    if (!target) return;
     
     // Trennlinie oben
-    tft->drawLine(
+    target->drawLine(
         0,
         footerBounds.y,
         DISPLAY_WIDTH,
@@ -317,7 +314,7 @@ void UILayout::drawFooterBackground() {
     );
     
     // Footer Hintergrund
-    tft->fillRect(
+    target->fillRect(
         footerBounds.x,
         footerBounds.y + 1,
         footerBounds.width,
@@ -326,28 +323,35 @@ void UILayout::drawFooterBackground() {
     );
 }
 
-void UILayout::updateBatteryColor(uint8_t percent) {
-    if (!lblBattery || !battery) return;
-    
-    uint16_t color;
-    
-    if (battery->isCritical()) {
-        color = TFT_RED;
-    } else if (battery->isLow()) {
-        color = TFT_ORANGE;
-    } else if (percent > 60) {
-        color = TFT_DARKGREEN;
-    } else {
-        color = TFT_DARKCYAN;
+void UILayout::paintBackground(TFT_eSPI* target, int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (!target) return;
+    
+    int16_t bottom = y + h;
+    
+    if (y < headerBounds.y + headerBounds.height) {
+        drawHeaderBackground(target);
     }
     
-    ElementStyle iconStyle;
-    iconStyle.bgColor = color;
-    iconStyle.borderColor = TFT_WHITE;
-    iconStyle.textColor = TFT_WHITE;
-    iconStyle.borderWidth = 2;
-    iconStyle.cornerRadius = 3;
-    lblBattery->setStyle(iconStyle);
+    if (bottom > contentBounds.y && y < contentBounds.y + contentBounds.height) {
+        target->fillRect(contentBounds.x, contentBounds.y, contentBounds.width, contentBounds.height, contentColor);
+    }
+    
+    if (bottom > footerBounds.y) {
+        drawFooterBackground(target);
+    }
+}
+
+uint16_t UILayout::getBatteryColor(uint8_t percent) const {
+    if (battery->isCritical()) return TFT_RED;
+    if (battery->isLow()) return TFT_ORANGE;
+    if (percent > 60) return TFT_DARKGREEN;
+    return TFT_DARKCYAN;
+}
+
+bool UILayout::countField(LayoutField field, bool changed) {
+    if (changed) stats.changed[(uint8_t)field]++;
+    else stats.unchanged[(uint8_t)field]++;
+    return changed;
 }
 
 void UILayout::onSleepClicked() {
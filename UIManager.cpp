@@ -3,63 +3,138 @@
  */
 
 #include "include/UIManager.h"
+#include "include/UIButton.h"
+#include "include/UILabel.h"
+#include "include/UISlider.h"
+#include "include/UIProgressBar.h"
+#include "include/UICheckBox.h"
+#include "include/UIRadioButton.h"
+#include "include/UITextBox.h"
+#include "include/UIJoystickView.h"
+#include "include/UIArena.h"
+#include <algorithm>
+
+// Hit-Test (dispatchTouch() und benchmarkHitTest() nutzen dieselben Filter)
+static bool isHitCandidate(UIElement* element) {
+    // Zeichenliste enthält nur angezeigte Teilbäume, Container selbst sind nicht berührbar
+    return element->isVisible() && !element->asContainer();
+}
+
+static bool isTouchTarget(UIElement* element) {
+    return element->acceptsTouch();
+}
 
 UIManager::UIManager(TFT_eSPI* tft, TouchManager* touch)
-    : tft(tft), touch(touch), lastTouchState(false), lastTouchX(0), lastTouchY(0), currentPage(nullptr) {
+    : tft(tft), display(nullptr), touch(touch), lastTouchState(false), lastTouchX(0), lastTouchY(0), currentPage(nullptr),
+      root(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT), treeRevision(0), treeDirty(true),
+      hitGridDirty(true), hitGridRevision(0), gestureHandler(nullptr),
+      backgroundPainter(nullptr), backgroundColor(COLOR_BLACK),
+      activeTile(0), tileDMA(false), asyncFlush(UI_ASYNC_FLUSH),
+      drawWindowActive(false), windowX(0), windowY(0), windowW(0), windowH(0),
+      perfOverlay(UI_PERF_OVERLAY), overlayCount(0) {
+    
+    tileSprites[0] = nullptr;
+    tileSprites[1] = nullptr;
+    
+    resetRenderStats();
+    
+    gestures.setCallback([this](EventType type, EventData* data) {
+        dispatchGesture(type, data);
+    });
 }
 
 UIManager::~UIManager() {
     // Elemente werden nicht gelöscht (Ownership beim Aufrufer)
+    root.clearChildren();
     elements.clear();
+    setSpriteRendering(false);
 }
 
 bool UIManager::add(UIElement* element) {
     if (!element) return false;
     
-    elements.push_back(element);
-    element->setNeedsRedraw(true);
+    root.addChild(element);
+    treeDirty = true;
+    hitGridDirty = true;
     return true;
 }
 
 bool UIManager::remove(UIElement* element) {
-    if (!element) return false;
+    if (!element || !element->getParent()) return false;
     
-    for (auto it = elements.begin(); it != elements.end(); ++it) {
-        if (*it == element) {
-            elements.erase(it);
-            return true;
-        }
+    // Gezeichneten Bereich freigeben (Container: deckt den Teilbaum ab)
+    if (element->isPainted()) {
+        int16_t px, py, pw, ph;
+        element->getPaintedBounds(&px, &py, &pw, &ph);
+        damage.add(px, py, pw, ph, true, 0);
+        element->setPainted(false);
     }
-    return false;
+    
+    element->getParent()->removeChild(element);
+    treeDirty = true;
+    hitGridDirty = true;
+    
+    // Nicht mehr an entfernte Elemente dispatchen, nicht mehr animieren
+    forgetTargets(element);
+    animator.cancelSubtree(element);
+    return true;
 }
 
 void UIManager::clear() {
+    root.clearChildren();
     elements.clear();
+    subtreeEnd.clear();
+    treeDirty = true;
+    touchTargets.clear();
+    kineticTargets.clear();
+    gestures.reset();
+    animator.cancelAll();
+    hitGridDirty = true;
 }
 
-void UIManager::setCurrentPage(void* page) {
-    currentPage = page;
-    Serial.printf("UIManager: CurrentPage gesetzt auf %p\n", page);
+void UIManager::setCurrentPage(UIContainer* pageRoot) {
+    currentPage = pageRoot;
+    hitGridDirty = true;
+    
+    // Versteckte Top-Level-Knoten (vorherige Page) liegen unter dem neuen
+    // Content (UIPage::show() löscht den Content-Bereich) → kein Damage
+    for (auto* node : root.getChildren()) {
+        if (!node->isVisible()) {
+            node->setPainted(false);
+        }
+    }
+    
+    // Laufenden Touch / Kinetic nicht auf neue Page übertragen
+    touchTargets.clear();
+    kineticTargets.clear();
+    gestures.reset();
+    
+    Serial.printf("UIManager: CurrentPage gesetzt auf %p\n", pageRoot);
 }
 
 void UIManager::update() {
     if (!touch) return;
+    
+    // Zeitbasierte Gesten (Long-Press, Kinetic-Scrolling)
+    gestures.update(millis());
+
+    // ═══════════════════════════════════════════════════════════════
+    // Sampling-Task aktiv: gefilterte Events aus der Queue verarbeiten
+    // (kein SPI-Zugriff im Main-Thread, keine Latenz durch Polling)
+    // ═══════════════════════════════════════════════════════════════
+    if (touch->isSampling()) {
+        TouchPoint event;
+        while (touch->pollEvent(&event)) {
+            dispatchTouch(event.x, event.y, event.valid, event.timestamp);
+        }
+        return;
+    }
 
     // KRITISCH: Erst IRQ prüfen (schneller GPIO-Check)
     // Nur wenn IRQ aktiv ist, Touch-Daten per SPI holen
     if (!touch->isIRQActive()) {
         // Kein Touch-IRQ → trotzdem Release-Events verarbeiten falls nötig
-        if (lastTouchState) {
-            // Touch war aktiv, ist jetzt aber beendet
-            for (auto* element : elements) {
-                if (element && element->isEnabled() && element->isVisible()) {
-                    if (shouldProcessElement(element)) {
-                        handleElementTouch(element, lastTouchX, lastTouchY, false);
-                    }
-                }
-            }
-            lastTouchState = false;
-        }
+        dispatchTouch(lastTouchX, lastTouchY, false, millis());
         return;  // Kein Touch-IRQ → früh beenden
     }
 
@@ -67,102 +142,871 @@ void UIManager::update() {
     bool touchActive = touch->isTouchActive();
     TouchPoint point = touch->getTouchPoint();
     
-    if (touchActive && point.valid) {
-        // Touch aktiv - an alle Elemente weiterleiten
-        for (auto* element : elements) {
-            if (element && element->isVisible() && element->isEnabled()) {
-                // NUR verarbeiten wenn Element zur aktuellen Page gehört!
-                if (shouldProcessElement(element)) {
-                    handleElementTouch(element, point.x, point.y, true);
-                }
+    dispatchTouch(point.x, point.y, touchActive && point.valid, millis());
+}
+
+void UIManager::dispatchTouch(int16_t x, int16_t y, bool pressed, unsigned long timestamp) {
+    if (pressed) {
+        ensureHitGrid();
+        
+        // Nur das oberste Element unter dem Finger (Raster-Zelle statt aller Elemente).
+        // Anzeigen ohne Handler lassen durch, ein deaktiviertes Element blockiert
+        UIElement* target = hitGrid.hitTest(x, y, isTouchTarget);
+        if (target && target->isEnabled()) {
+            handleElementTouch(target, x, y, true);
+            captureTarget(target);
+        }
+        
+        // Bereits berührte Elemente, die nicht mehr das Ziel sind (für LEAVE/Drag)
+        for (size_t i = 0; i < touchTargets.size(); i++) {
+            UIElement* element = touchTargets[i];
+            if (element != target && element->isEnabled() && element->isShown()) {
+                handleElementTouch(element, x, y, true);
             }
         }
         
-        lastTouchX = point.x;
-        lastTouchY = point.y;
+        lastTouchX = x;
+        lastTouchY = y;
+        
+        // Gesten nach Touch-Dispatch (Empfänger stehen fest)
+        gestures.addSample(x, y, true, timestamp);
     } else if (lastTouchState) {
-        // Touch gerade beendet - Release-Event
-        for (auto* element : elements) {
-            if (element && element->isEnabled() && element->isVisible()) {
-                // NUR verarbeiten wenn Element zur aktuellen Page gehört!
-                if (shouldProcessElement(element)) {
-                    handleElementTouch(element, lastTouchX, lastTouchY, false);
-                }
+        // Abschließende Geste (TAP/SWIPE/FLING) solange Empfänger noch bekannt
+        gestures.addSample(lastTouchX, lastTouchY, false, timestamp);
+        
+        // Touch gerade beendet - Release-Event an letzter Position
+        // Nur Elemente die während des Touches getroffen wurden
+        // (lokale Kopie: Callbacks dürfen Elemente entfernen)
+        std::vector<UIElement*> targets;
+        targets.swap(touchTargets);
+        for (auto* element : targets) {
+            // NUR verarbeiten wenn Element noch angezeigt wird (Page nicht gewechselt)!
+            if (element->isEnabled() && element->isShown()) {
+                handleElementTouch(element, lastTouchX, lastTouchY, false);
             }
         }
     }
     
-    lastTouchState = touchActive;
+    lastTouchState = pressed;
 }
 
-bool UIManager::shouldProcessElement(UIElement* element) {
-    if (!element) return false;
+void UIManager::ensureHitGrid() {
+    ensureTree();
     
-    void* elementOwner = element->getOwnerPage();
+    uint32_t revision = UIElement::getGeometryRevision();
+    if (!hitGridDirty && revision == hitGridRevision) return;
     
-    // Elemente ohne Owner (z.B. Header/Footer) immer verarbeiten
-    if (!elementOwner) return true;
+    hitGrid.rebuild(elements, isHitCandidate);
     
-    // Element nur verarbeiten wenn es zur aktuellen Page gehört
-    bool matches = (elementOwner == currentPage);
+    hitGridRevision = revision;
+    hitGridDirty = false;
+}
+
+void UIManager::dispatchGesture(EventType type, EventData* data) {
+    // Kinetic-PAN geht an die Elemente die den FLING konsumiert haben
+    bool kineticPan = (type == EventType::PAN && data->value == 1);
+    std::vector<UIElement*> targets = kineticPan ? kineticTargets : touchTargets;
+    std::vector<UIElement*> consumers;
     
-    return matches;
+    for (auto* element : targets) {
+        if (element->isEnabled() && element->isShown()) {
+            if (element->handleGesture(type, data)) {
+                consumers.push_back(element);
+            }
+        }
+    }
+    
+    if (type == EventType::FLING && !consumers.empty()) {
+        // Element scrollt selbst → Kinetic-Scrolling mit Fling-Geschwindigkeit
+        kineticTargets = consumers;
+        gestures.startKinetic(data->vx, data->vy);
+    } else if (kineticPan && consumers.empty()) {
+        // Anschlag erreicht oder Empfänger weg → Kinetic beenden
+        gestures.stopKinetic();
+        kineticTargets.clear();
+    }
+    
+    // Nicht konsumierte Gesten an Page-Ebene (nur echte Touch-Gesten)
+    if (consumers.empty() && !kineticPan && gestureHandler) {
+        gestureHandler(type, data);
+    }
+}
+
+void UIManager::captureTarget(UIElement* element) {
+    for (auto* target : touchTargets) {
+        if (target == element) return;
+    }
+    touchTargets.push_back(element);
+}
+
+void UIManager::forgetTargets(UIElement* subtree) {
+    // Element selbst oder Nachfahre (entfernter Container)
+    auto inSubtree = [subtree](UIElement* element) {
+        for (UIElement* node = element; node; node = node->getParent()) {
+            if (node == subtree) return true;
+        }
+        return false;
+    };
+    
+    for (auto tt = touchTargets.begin(); tt != touchTargets.end(); ) {
+        tt = inSubtree(*tt) ? touchTargets.erase(tt) : tt + 1;
+    }
+    for (auto kt = kineticTargets.begin(); kt != kineticTargets.end(); ) {
+        kt = inSubtree(*kt) ? kineticTargets.erase(kt) : kt + 1;
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════
+// WIDGET-BAUM
+// ═══════════════════════════════════════════════════════════════
+
+void UIManager::ensureTree() {
+    uint32_t revision = UIElement::getGeometryRevision();
+    if (!treeDirty && revision == treeRevision) return;
+    
+    elements.clear();
+    subtreeEnd.clear();
+    flattenTree(&root, false, 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    
+    treeRevision = revision;
+    treeDirty = false;
+    hitGridDirty = true;
+}
+
+void UIManager::flattenTree(UIContainer* container, bool clip, int16_t cx, int16_t cy, int16_t cw, int16_t ch) {
+    for (auto* child : container->getChildren()) {
+        size_t index = elements.size();
+        elements.push_back(child);
+        subtreeEnd.push_back(0);
+        
+        if (clip) {
+            child->setClipRect(cx, cy, cw, ch);
+        } else {
+            child->clearClipRect();
+        }
+        
+        // Versteckter Container: Teilbaum gar nicht erst aufnehmen
+        UIContainer* sub = child->asContainer();
+        if (sub && sub->isVisible()) {
+            if (sub->getClipChildren()) {
+                int16_t bx, by, bw, bh;
+                sub->getBounds(&bx, &by, &bw, &bh);
+                if (!clip) {
+                    flattenTree(sub, true, bx, by, bw, bh);
+                } else if (UIDamageTracker::intersect(cx, cy, cw, ch, bx, by, bw, bh, &bx, &by, &bw, &bh)) {
+                    flattenTree(sub, true, bx, by, bw, bh);
+                } else {
+                    // Komplett weggeclippt
+                    flattenTree(sub, true, bx, by, 0, 0);
+                }
+            } else {
+                flattenTree(sub, clip, cx, cy, cw, ch);
+            }
+        }
+        
+        subtreeEnd[index] = elements.size();
+    }
 }
 
 void UIManager::drawAll() {
     if (!tft) return;
     
+    ensureTree();
+    
     for (auto* element : elements) {
         if (element && element->isVisible()) {
+            int16_t cx, cy, cw, ch;
+            if (element->hasClipRect()) {
+                element->getClipRect(&cx, &cy, &cw, &ch);
+                tft->setViewport(cx, cy, cw, ch, false);
+            }
+            
+            int16_t ex, ey, ew, eh;
+            element->getBounds(&ex, &ey, &ew, &eh);
+            
+            element->onBackgroundPainted();
+            uint32_t drawStartUs = micros();
             element->draw(tft);
+            element->recordDraw(micros() - drawStartUs, (uint32_t)ew * eh);
+            element->setPainted(true);
+            
+            if (element->hasClipRect()) tft->resetViewport();
         }
     }
 }
 
-void UIManager::drawUpdates() {
+void UIManager::drawUpdates(uint32_t budgetUs) {
     if (!tft) return;
     
-    for (int i = 0; i < elements.size(); i++) {
-        auto* element = elements[i];
+    collectDamage();
+    
+    if (damage.isEmpty()) return;
+    
+    // Overlay nur auf dem Display (Offscreen-Ziele bleiben vergleichbar),
+    // Rahmen würden das Zeichenfenster verlassen
+    bool overlay = perfOverlay && !display && !drawWindowActive;
+    if (overlay) {
+        // Neue Rechtecke merken bevor die alten Rahmen als Damage hinzukommen
+        damage.merge();
+        uint8_t count = min((int)damage.getCount(), UI_DAMAGE_MAX_RECTS);
+        eraseOverlay();
+        for (uint8_t i = 0; i < count; i++) overlayRects[i] = damage.get(i);
+        overlayCount = count;
+    }
+    
+    compose(budgetUs);
+    
+    if (overlay) drawOverlay();
+}
 
-        if (element && element->isVisible() && element->getNeedsRedraw()) {
+void UIManager::clearScreen(uint16_t color) {
+    backgroundColor = color;
+    
+    // Ein Damage über den ganzen Screen: Hintergrund + alle Elemente
+    damage.add(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, true, 0);
+}
+
+void UIManager::invalidate(int16_t x, int16_t y, int16_t w, int16_t h) {
+    damage.add(x, y, w, h, true, 0);
+}
+
+void UIManager::setDrawWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+    drawWindowActive = true;
+    windowX = x;
+    windowY = y;
+    windowW = w;
+    windowH = h;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// DAMAGE-COMPOSITOR
+// ═══════════════════════════════════════════════════════════════
+
+void UIManager::collectDamage() {
+    retainedDamage.clear();
+    ensureTree();
+    
+    // Zeichenliste enthält nur Teilbäume angezeigter Container
+    for (size_t i = 0; i < elements.size(); i++) {
+        UIElement* element = elements[i];
+        if (!element || !element->getNeedsRedraw()) continue;
+        
+        int16_t px, py, pw, ph;
+        element->getPaintBounds(&px, &py, &pw, &ph);
+        
+        // Komplett weggeclippt zählt wie versteckt
+        bool shown = element->isVisible();
+        if (shown && element->hasClipRect()) {
+            int16_t cx, cy, cw, ch;
+            element->getClipRect(&cx, &cy, &cw, &ch);
+            shown = UIDamageTracker::intersect(px, py, pw, ph, cx, cy, cw, ch, &cx, &cy, &cw, &ch);
+        }
+        
+        // Alter Bereich wird freigelegt (verschoben, Größe geändert, versteckt)
+        if (element->isPainted()) {
+            int16_t ox, oy, ow, oh;
+            element->getPaintedBounds(&ox, &oy, &ow, &oh);
+            if (!shown || ox != px || oy != py || ow != pw || oh != ph) {
+                damage.add(ox, oy, ow, oh, true, 0);
+            }
+        }
+        
+        if (shown) {
+            // Retained-Widgets an gleicher Stelle melden nur den geänderten Teilbereich
+            if (element->isPainted() && element->isOpaque()) {
+                int16_t ox, oy, ow, oh;
+                element->getPaintedBounds(&ox, &oy, &ow, &oh);
+                if (ox == px && oy == py && ow == pw && oh == ph) {
+                    element->getDirtyBounds(&px, &py, &pw, &ph);
+                    if (px != ox || py != oy || pw != ow || ph != oh) {
+                        retainedDamage.push_back({element, px, py, pw, ph, false});
+                    }
+                }
+            }
             
-            // KRITISCH: Bounds ausgeben um Element zu identifizieren
-            int16_t x, y, w, h;
-            element->getBounds(&x, &y, &w, &h);
+            // Nur sichtbarer Teil (Container-Clip)
+            if (element->hasClipRect()) {
+                int16_t cx, cy, cw, ch;
+                element->getClipRect(&cx, &cy, &cw, &ch);
+                UIDamageTracker::intersect(px, py, pw, ph, cx, cy, cw, ch, &px, &py, &pw, &ph);
+            }
+            
+            // Nicht-deckende Elemente brauchen frischen Hintergrund
+            damage.add(px, py, pw, ph, !element->isOpaque(), i);
+        } else {
+            element->setPainted(false);
+            element->setNeedsRedraw(false);
+        }
+    }
+}
+
+void UIManager::compose(uint32_t budgetUs) {
+    uint32_t startUs = micros();
+    
+    damage.merge();
+    
+    uint32_t pixels = 0;
+    uint16_t drawn = 0;
+    uint8_t tiles = 0;
+    uint8_t processed = 0;
+    
+    while (processed < damage.getCount()) {
+        DamageRect rect = damage.get(processed);
+        processed++;
         
-            element->draw(tft);
+        // Außerhalb des Zeichenfensters verwerfen (Aufrufer invalidiert später)
+        if (drawWindowActive &&
+            !UIDamageTracker::intersect(rect.x, rect.y, rect.w, rect.h, windowX, windowY, windowW, windowH,
+                                        &rect.x, &rect.y, &rect.w, &rect.h)) {
+            continue;
         }
+        
+        if (tileSprites[0] && !display) {
+            pixels += composeTiles(rect, &drawn, &tiles);
+        } else {
+            pixels += composeDirect(rect, &drawn);
+        }
+        
+        // Budget erschöpft → Rest im nächsten Frame (mindestens ein Rechteck pro Frame)
+        if (budgetUs > 0 && micros() - startUs >= budgetUs) break;
     }
+    
+    uint8_t deferred = damage.getCount() - processed;
+    
+    // Synchron: letzter Tile-Transfer muss fertig sein bevor der Bus freigegeben wird
+    // Asynchron: Aufrufer wartet über isFlushBusy()/waitFlush() (PageManager::draw())
+    if (!asyncFlush && tiles > 0) {
+        waitFlush();
+    }
+    
+    renderStats.frames++;
+    renderStats.lastPixels = pixels;
+    renderStats.totalPixels += pixels;
+    if (pixels > renderStats.maxPixels) renderStats.maxPixels = pixels;
+    renderStats.lastRects = processed;
+    renderStats.lastDeferred = deferred;
+    if (deferred > 0) renderStats.deferredFrames++;
+    renderStats.lastElements = drawn;
+    renderStats.lastTiles = tiles;
+    renderStats.lastDrawUs = micros() - startUs;
+    
+    damage.defer(processed);
 }
 
-void UIManager::clearScreen(uint16_t color) {
-    if (!tft) return;
+uint32_t UIManager::composeDirect(const DamageRect& rect, uint16_t* drawn) {
+    uint32_t pixels = 0;
     
-    tft->fillScreen(color);
+    // Direktes Zeichnen darf keinen laufenden Tile-Transfer unterbrechen
+    waitFlush();
     
-    // Alle Elemente als "needs redraw" markieren
-    for (auto* element : elements) {
-        if (element) {
-            element->setNeedsRedraw(true);
+    // Absolutes Clipping (Koordinaten der Widgets bleiben unverändert)
+    tft->setViewport(rect.x, rect.y, rect.w, rect.h, false);
+    
+    if (rect.clearBackground) {
+        if (backgroundPainter) {
+            backgroundPainter(tft, rect.x, rect.y, rect.w, rect.h);
+        } else {
+            tft->fillRect(rect.x, rect.y, rect.w, rect.h, backgroundColor);
+        }
+        pixels += rect.area();
+    }
+    
+    *drawn += drawElements(tft, rect.firstElement, rect.x, rect.y, rect.w, rect.h, rect.clearBackground, &pixels);
+    
+    tft->resetViewport();
+    return pixels;
+}
+
+uint32_t UIManager::composeTiles(const DamageRect& rect, uint16_t* drawn, uint8_t* tiles) {
+    uint32_t pixels = 0;
+    int16_t bottom = rect.y + rect.h;
+    int16_t ty = rect.y;
+    
+    while (ty < bottom) {
+        // Ping-Pong: in dieses Tile rendern während das andere noch überträgt
+        UITileSprite* tile = tileSprites[activeTile];
+        if (!ensureTile(tile, rect.w)) {
+            // Kein Speicher für diese Breite → Rest direkt zeichnen
+            DamageRect rest = rect;
+            rest.y = ty;
+            rest.h = bottom - ty;
+            rest.clearBackground = true;
+            rest.firstElement = 0;
+            return pixels + composeDirect(rest, drawn);
+        }
+        
+        int16_t th = min(tile->height(), (int16_t)(bottom - ty));
+        
+        // Widgets zeichnen in Screen-Koordinaten,
+        // landen im Tile relativ zu (rect.x, ty), geclippt auf w x th
+        tile->setScreenClip(rect.x, ty, rect.x, ty, rect.w, th);
+        
+        // Tile wird komplett gepusht → Hintergrund und ALLE Elemente darunter
+        if (backgroundPainter) {
+            backgroundPainter(tile, rect.x, ty, rect.w, th);
+        } else {
+            tile->fillRect(rect.x, ty, rect.w, th, backgroundColor);
+        }
+        
+        uint32_t unused = 0;
+        *drawn += drawElements(tile, 0, rect.x, ty, rect.w, th, true, &unused);
+        
+        tile->resetViewport();
+        pushTile(tile, rect.x, ty, rect.w, th);
+        
+        // Mit DMA wechseln, sonst ist der Push bereits abgeschlossen
+        if (tileDMA) activeTile ^= 1;
+        
+        pixels += (uint32_t)rect.w * th;
+        (*tiles)++;
+        ty += th;
+    }
+    
+    return pixels;
+}
+
+uint16_t UIManager::drawElements(TFT_eSPI* target, uint16_t first, int16_t x, int16_t y, int16_t w, int16_t h,
+                                 bool backgroundPainted, uint32_t* pixels) {
+    uint16_t drawn = 0;
+    
+    // Teilbaum eines gerade gezeichneten deckenden Containers liegt auf frischem Hintergrund
+    size_t coveredUntil = 0;
+    
+    // Betroffene Elemente in Z-Order (hinten → vorne)
+    for (size_t i = first; i < elements.size(); i++) {
+        UIElement* element = elements[i];
+        if (!element || !element->isVisible()) continue;
+        
+        int16_t ex, ey, ew, eh;
+        int16_t ix, iy, iw, ih;
+        element->getPaintBounds(&ex, &ey, &ew, &eh);
+        if (!UIDamageTracker::intersect(ex, ey, ew, eh, x, y, w, h, &ix, &iy, &iw, &ih)) {
+            // Geclippter Container außerhalb → Kinder auch
+            UIContainer* container = element->asContainer();
+            if (container && container->getClipChildren()) i = subtreeEnd[i] - 1;
+            continue;
+        }
+        
+        // Container-Clip enger als das Rechteck → Viewport einengen
+        bool narrowed = false;
+        if (element->hasClipRect()) {
+            int16_t cx, cy, cw, ch;
+            element->getClipRect(&cx, &cy, &cw, &ch);
+            if (!UIDamageTracker::intersect(ix, iy, iw, ih, cx, cy, cw, ch, &ix, &iy, &iw, &ih)) continue;
+            
+            if (ex < cx || ey < cy || ex + ew > cx + cw || ey + eh > cy + ch) {
+                setDrawClip(target, x, y, ix, iy, iw, ih);
+                narrowed = true;
+            }
+        }
+        
+        // Hintergrund wurde überschrieben → Retained-Widgets komplett zeichnen
+        // Inkrementell nur einmal pro Frame und nur im Rechteck das den
+        // gemeldeten Teilbereich enthält - sonst fehlt er in anderen Rechtecken
+        bool full = backgroundPainted || i < coveredUntil;
+        if (!full) {
+            for (auto& retained : retainedDamage) {
+                if (retained.element != element) continue;
+                bool inside = retained.x >= x && retained.y >= y &&
+                              retained.x + retained.w <= x + w && retained.y + retained.h <= y + h;
+                full = retained.drawn || !inside;
+                retained.drawn = true;
+                break;
+            }
+        }
+        if (full) element->onBackgroundPainted();
+        
+        uint32_t drawStartUs = micros();
+        element->draw(target);
+        element->recordDraw(micros() - drawStartUs, (uint32_t)iw * ih);
+        element->setPainted(true);
+        
+        if (element->asContainer() && element->isOpaque() && subtreeEnd[i] > coveredUntil) {
+            coveredUntil = subtreeEnd[i];
+        }
+        if (narrowed) setDrawClip(target, x, y, x, y, w, h);
+        
+        *pixels += (uint32_t)iw * ih;
+        drawn++;
+    }
+    
+    return drawn;
+}
+
+void UIManager::setDrawClip(TFT_eSPI* target, int16_t originX, int16_t originY,
+                            int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (target == tft) {
+        // Display: absolutes Clipping
+        tft->setViewport(x, y, w, h, false);
+    } else {
+        // Tile (origin = Screen-Position der Tile-Ecke)
+        static_cast<UITileSprite*>(target)->setScreenClip(originX, originY, x, y, w, h);
+    }
+}
+
+void UITileSprite::setScreenClip(int16_t originX, int16_t originY, int16_t cx, int16_t cy, int16_t cw, int16_t ch) {
+    // Negativer Datum: Screen-Koordinaten landen relativ zu (originX, originY) im Tile
+    setViewport(-originX, -originY, originX + width(), originY + height(), true);
+    
+    // Clip-Fenster (setViewport kann links/oben nicht enger als die Tile-Kante)
+    int32_t x0 = max((int32_t)0, (int32_t)(cx - originX));
+    int32_t y0 = max((int32_t)0, (int32_t)(cy - originY));
+    int32_t x1 = min((int32_t)width(), (int32_t)(cx + cw - originX));
+    int32_t y1 = min((int32_t)height(), (int32_t)(cy + ch - originY));
+    
+    _vpX = x0;
+    _vpY = y0;
+    _vpW = x1;
+    _vpH = y1;
+    _vpOoB = (x0 >= x1 || y0 >= y1);
+}
+
+// ═══════════════════════════════════════════════════════════════
+// SPRITE-RENDERING
+// ═══════════════════════════════════════════════════════════════
+
+bool UIManager::setSpriteRendering(bool enable) {
+    if (!enable) {
+        if (tileSprites[0]) {
+            waitFlush();
+            if (tileDMA) {
+                tft->deInitDMA();
+                tileDMA = false;
+            }
+            for (uint8_t i = 0; i < 2; i++) {
+                if (tileSprites[i]) {
+                    tileSprites[i]->deleteSprite();
+                    delete tileSprites[i];
+                    tileSprites[i] = nullptr;
+                }
+            }
+            Serial.println("UIManager: Sprite-Rendering aus");
+        }
+        return true;
+    }
+    
+    if (tileSprites[0]) return true;
+    if (!tft) return false;
+    
+    // Volle Breite vorab anlegen → Speicher ist beim Start sicher vorhanden
+    // (zweites Tile nur für DMA: Rendern während der Übertragung)
+    uint8_t count = UI_SPRITE_DMA ? 2 : 1;
+    for (uint8_t i = 0; i < count; i++) {
+        tileSprites[i] = new UITileSprite(tft);
+        tileSprites[i]->setColorDepth(16);
+        tileSprites[i]->setAttribute(PSRAM_ENABLE, true);
+        
+        if (!ensureTile(tileSprites[i], DISPLAY_WIDTH)) {
+            Serial.printf("UIManager: ❌ Sprite-Tile %d konnte nicht angelegt werden\n", i);
+            if (i == 0) {
+                delete tileSprites[0];
+                tileSprites[0] = nullptr;
+                return false;
+            }
+            // Ohne zweites Tile kein Ping-Pong → blockierend pushen
+            delete tileSprites[1];
+            tileSprites[1] = nullptr;
+        }
+    }
+    activeTile = 0;
+    
+#if UI_SPRITE_DMA
+    tileDMA = tileSprites[1] && tft->initDMA();
+    if (!tileDMA) {
+        Serial.println("UIManager: ⚠️ DMA nicht verfügbar, Tiles werden blockierend gepusht");
+    }
+#endif
+    
+    Serial.printf("UIManager: ✅ Sprite-Rendering aktiv (%dx Tile %dx%d, %s)\n",
+                  tileSprites[1] ? 2 : 1, tileSprites[0]->width(), tileSprites[0]->height(),
+                  tileDMA ? (asyncFlush ? "DMA asynchron" : "DMA") : "blockierend");
+    return true;
+}
+
+bool UIManager::isFlushBusy() {
+    TFT_eSPI* screen = display ? display : tft;
+    return tileDMA && screen->dmaBusy();
+}
+
+void UIManager::waitFlush() {
+    TFT_eSPI* screen = display ? display : tft;
+    if (tileDMA) screen->dmaWait();
+}
+
+void UIManager::redirect(TFT_eSPI* target) {
+    waitFlush();
+    
+    if (target) {
+        if (!display) display = tft;
+        tft = target;
+    } else if (display) {
+        tft = display;
+        display = nullptr;
+        
+        // Was ins Offscreen-Ziel gezeichnet wurde, fehlt auf dem Display
+        invalidate(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    }
+}
+
+bool UIManager::ensureTile(TFT_eSprite* tile, int16_t width) {
+    // Gleiche Breite → zeilenweise zusammenhängender Puffer, keine Neuanlage
+    if (tile->created() && tile->width() == width) return true;
+    
+    // Puffer könnte noch übertragen werden
+    waitFlush();
+    tile->deleteSprite();
+    
+    int16_t rows = min((int32_t)DISPLAY_HEIGHT, (int32_t)(UI_SPRITE_TILE_PIXELS / width));
+    if (rows < 1) rows = 1;
+    
+    return tile->createSprite(width, rows) != nullptr;
+}
+
+void UIManager::pushTile(TFT_eSprite* tile, int16_t x, int16_t y, int16_t w, int16_t h) {
+    // Die ersten h Zeilen des Tiles liegen zusammenhängend im Puffer
+    uint16_t* buffer = (uint16_t*)tile->getPointer();
+    
+    // Sprite-Pixel liegen bereits in Display-Byte-Reihenfolge
+    bool swap = tft->getSwapBytes();
+    tft->setSwapBytes(false);
+    
+    if (tileDMA) {
+        // Wartet nur auf den vorherigen Transfer (anderes Tile), nicht auf diesen
+        tft->pushImageDMA(x, y, w, h, buffer);
+    } else {
+        tft->pushImage(x, y, w, h, buffer);
+    }
+    
+    tft->setSwapBytes(swap);
+}
+
+void UIManager::resetRenderStats() {
+    memset(&renderStats, 0, sizeof(renderStats));
+}
+
+// ═══════════════════════════════════════════════════════════════
+// THEME
+// ═══════════════════════════════════════════════════════════════
+
+// Elemente mit geändertem Style-Eintrag markieren (auch in versteckten Pages)
+static int restyleSubtree(UIContainer* container) {
+    int count = 0;
+    for (auto* child : container->getChildren()) {
+        if (!child) continue;
+        
+        if (UITheme::wasChanged(child->getStyleId())) {
+            child->onStyleChanged();
+            count++;
+        }
+        
+        UIContainer* sub = child->asContainer();
+        if (sub) count += restyleSubtree(sub);
+    }
+    return count;
+}
+
+int UIManager::setTheme(ThemeId theme) {
+    uint32_t startUs = micros();
+    uint8_t styles = UITheme::setTheme(theme);
+    if (styles == 0) return 0;
+    
+    int count = restyleSubtree(&root);
+    
+    Serial.printf("UIManager: ✅ Theme '%s': %u Style-Einträge, %d Elemente neu (%lu us)\n",
+                  UITheme::getThemeName(theme), styles, count, (unsigned long)(micros() - startUs));
+    return count;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// RENDER-PROFIL
+// ═══════════════════════════════════════════════════════════════
+
+// Alle Elemente des Teilbaums sammeln (hidden: ein Vorfahre ist versteckt)
+static void collectPerfNodes(UIContainer* container, bool hidden,
+                             std::vector<std::pair<UIElement*, bool>>& nodes) {
+    for (auto* child : container->getChildren()) {
+        if (!child) continue;
+        bool childHidden = hidden || !child->isVisible();
+        nodes.push_back({child, childHidden});
+        
+        UIContainer* sub = child->asContainer();
+        if (sub) collectPerfNodes(sub, childHidden, nodes);
+    }
+}
+
+void UIManager::printPerfStats() {
+    std::vector<std::pair<UIElement*, bool>> nodes;
+    collectPerfNodes(&root, false, nodes);
+    
+    std::sort(nodes.begin(), nodes.end(), [](const std::pair<UIElement*, bool>& a,
+                                             const std::pair<UIElement*, bool>& b) {
+        return a.first->getPerf().totalUs > b.first->getPerf().totalUs;
+    });
+    
+    Serial.println("\n=== Render-Profil (pro Element) ===");
+    Serial.println("  Typ           Bounds               Draws    Σ ms   Ø us  max us    Ø px");
+    
+    uint64_t widgetPixels = 0;
+    uint32_t widgetUs = 0;
+    int idle = 0;
+    
+    for (auto& node : nodes) {
+        UIElement* element = node.first;
+        const UIElementPerf& perf = element->getPerf();
+        if (perf.draws == 0) {
+            idle++;
+            continue;
         }
+        
+        int16_t x, y, w, h;
+        element->getBounds(&x, &y, &w, &h);
+        
+        char bounds[24];
+        snprintf(bounds, sizeof(bounds), "%d,%d %dx%d", x, y, w, h);
+        
+        Serial.printf("  %-13s %-19s %6lu %7.1f %6lu %7lu %7lu%s\n",
+                      element->getTypeName(), bounds,
+                      (unsigned long)perf.draws,
+                      perf.totalUs / 1000.0f,
+                      (unsigned long)(perf.totalUs / perf.draws),
+                      (unsigned long)perf.maxUs,
+                      (unsigned long)(perf.pixels / perf.draws),
+                      node.second ? "  (versteckt)" : "");
+        
+        widgetPixels += perf.pixels;
+        widgetUs += perf.totalUs;
+    }
+    
+    Serial.printf("  %d Elemente, %d ohne draw()\n", (int)nodes.size(), idle);
+    Serial.printf("  Summe: %.1f ms, %llu Widget-px, %llu gepushte px (%lu Frames)\n",
+                  widgetUs / 1000.0f, (unsigned long long)widgetPixels,
+                  (unsigned long long)renderStats.totalPixels, (unsigned long)renderStats.frames);
+    Serial.println("===================================\n");
+}
+
+void UIManager::printWidgetSizes() {
+    UIEventHandler::printStats();
+    
+    // Vorher: Tabelle statt Pool-Index im Widget
+    size_t saved = UIEventHandler::getLegacyTableBytes() - sizeof(UIEventHandler);
+    
+    struct WidgetSize {
+        const char* name;
+        size_t bytes;
+    };
+    const WidgetSize sizes[] = {
+        {"Element",      sizeof(UIElement)},
+        {"Button",       sizeof(UIButton)},
+        {"Label",        sizeof(UILabel)},
+        {"Slider",       sizeof(UISlider)},
+        {"ProgressBar",  sizeof(UIProgressBar)},
+        {"CheckBox",     sizeof(UICheckBox)},
+        {"RadioButton",  sizeof(UIRadioButton)},
+        {"TextBox",      sizeof(UITextBox)},
+        {"JoystickView", sizeof(UIJoystickView)},
+        {"Container",    sizeof(UIContainer)},
+    };
+    
+    Serial.println("  Typ           Byte  (vorher)");
+    for (const auto& size : sizes) {
+        Serial.printf("  %-13s %5u  (%5u)\n", size.name, (unsigned)size.bytes, (unsigned)(size.bytes + saved));
+    }
+    
+    std::vector<std::pair<UIElement*, bool>> nodes;
+    collectPerfNodes(&root, false, nodes);
+    Serial.printf("Baum: %u Elemente → %u Byte weniger als mit Handler-Tabelle\n",
+                  (unsigned)nodes.size(), (unsigned)(nodes.size() * saved));
+    Serial.println("=====================\n");
+}
+
+void UIManager::resetPerfStats() {
+    std::vector<std::pair<UIElement*, bool>> nodes;
+    collectPerfNodes(&root, false, nodes);
+    
+    for (auto& node : nodes) node.first->resetPerf();
+    resetRenderStats();
+}
+
+void UIManager::setPerfOverlay(bool enable) {
+    if (perfOverlay == enable) return;
+    perfOverlay = enable;
+    
+    // Rahmen verschwinden beim nächsten drawUpdates()
+    if (!enable) {
+        eraseOverlay();
+        overlayCount = 0;
+    }
+}
+
+void UIManager::eraseOverlay() {
+    // Rahmenkanten als Damage → Hintergrund + Elemente darunter neu zeichnen
+    for (uint8_t i = 0; i < overlayCount; i++) {
+        const DamageRect& rect = overlayRects[i];
+        damage.add(rect.x, rect.y, rect.w, 1, true, 0);
+        damage.add(rect.x, rect.y + rect.h - 1, rect.w, 1, true, 0);
+        damage.add(rect.x, rect.y, 1, rect.h, true, 0);
+        damage.add(rect.x + rect.w - 1, rect.y, 1, rect.h, true, 0);
+    }
+}
+
+void UIManager::drawOverlay() {
+    // Rahmen liegen über den gepushten Tiles
+    waitFlush();
+    tft->resetViewport();
+    
+    for (uint8_t i = 0; i < overlayCount; i++) {
+        const DamageRect& rect = overlayRects[i];
+        tft->drawRect(rect.x, rect.y, rect.w, rect.h, UI_PERF_OVERLAY_COLOR);
     }
 }
 
 UIElement* UIManager::getElement(int index) {
+    ensureTree();
+    
     if (index >= 0 && index < elements.size()) {
         return elements[index];
     }
     return nullptr;
 }
 
+int UIManager::getElementCount() {
+    ensureTree();
+    return elements.size();
+}
+
 void UIManager::printDebugInfo() {
+    ensureTree();
+    
     Serial.println("\n=== UI Manager Debug Info ===");
-    Serial.printf("Elements: %d\n", elements.size());
+    Serial.printf("Elements: %d (Zeichenliste, %d Top-Level-Knoten)\n", elements.size(), root.getChildren().size());
     Serial.printf("Current Page: %p\n", currentPage);
     Serial.printf("Last Touch: %s at (%d, %d)\n", 
                   lastTouchState ? "ACTIVE" : "INACTIVE", 
                   lastTouchX, lastTouchY);
+    Serial.printf("Hit-Grid: %dx%d Zellen, %d Einträge, %s\n",
+                  UIHitGrid::COLS, UIHitGrid::ROWS, hitGrid.getEntryCount(),
+                  hitGridDirty ? "DIRTY" : "aktuell");
+    Serial.printf("Theme: %s\n", UITheme::getThemeName(UITheme::getTheme()));
+    Serial.printf("Animation: %d/%d Tweens aktiv, %lu abgeschlossen\n",
+                  animator.getActiveCount(), UI_ANIM_MAX_TWEENS, (unsigned long)animator.getCompletedCount());
+    Serial.printf("Compositor: %lu Frames, letzter: %lu px (%d Rects, %d Elemente, %lu us)\n",
+                  renderStats.frames, renderStats.lastPixels, renderStats.lastRects,
+                  renderStats.lastElements, renderStats.lastDrawUs);
+    Serial.printf("            Budget überschritten: %lu Frames (zuletzt %d Rects verschoben)\n",
+                  renderStats.deferredFrames, renderStats.lastDeferred);
+    if (tileSprites[0]) {
+        Serial.printf("Rendering:  %dx Sprite-Tile %dx%d (%lu Byte), %s, %d Tiles im letzten Frame\n",
+                      tileSprites[1] ? 2 : 1, tileSprites[0]->width(), tileSprites[0]->height(),
+                      (unsigned long)tileSprites[0]->width() * tileSprites[0]->height() * 2,
+                      tileDMA ? (asyncFlush ? "DMA asynchron" : "DMA") : "blockierend",
+                      renderStats.lastTiles);
+    } else {
+        Serial.println("Rendering:  Direkt (Display)");
+    }
+    Serial.printf("            max %lu px/Frame, Ø %lu px/Frame (Screen: %d px)\n",
+                  renderStats.maxPixels,
+                  renderStats.frames > 0 ? (unsigned long)(renderStats.totalPixels / renderStats.frames) : 0UL,
+                  DISPLAY_WIDTH * DISPLAY_HEIGHT);
     
     for (int i = 0; i < elements.size(); i++) {
         auto* el = elements[i];
@@ -174,11 +1018,12 @@ void UIManager::printDebugInfo() {
         int16_t x, y, w, h;
         el->getBounds(&x, &y, &w, &h);
         
-        Serial.printf("  [%d] Pos(%d,%d) Size(%dx%d) Visible:%s Enabled:%s Owner:%p\n",
-                      i, x, y, w, h,
+        Serial.printf("  [%d] %sPos(%d,%d) Size(%dx%d) Z:%d Visible:%s Enabled:%s Parent:%p%s\n",
+                      i, el->asContainer() ? "Container " : "", x, y, w, h, el->getZOrder(),
                       el->isVisible() ? "YES" : "NO",
                       el->isEnabled() ? "YES" : "NO",
-                      el->getOwnerPage());
+                      el->getParent(),
+                      el->hasClipRect() ? " (geclippt)" : "");
     }
     Serial.println("============================\n");
 }
@@ -187,4 +1032,119 @@ void UIManager::handleElementTouch(UIElement* element, int16_t x, int16_t y, boo
     if (!element) return;
     
     element->handleTouch(x, y, pressed);
-}
\ No newline at end of file
+}
+
+// ═══════════════════════════════════════════════════════════════
+// BENCHMARK
+// ═══════════════════════════════════════════════════════════════
+
+bool UIManager::benchmarkHitTest(int widgetCount, int queries) {
+    if (widgetCount < 1) widgetCount = 1;
+    if (queries < 1) queries = 1;
+    
+    // Test-Widgets in einer eigenen Arena (leicht überlappendes Raster, typische Button-Größe).
+    // Gemischt wie auf echten Pages: Anzeigen ohne Handler lassen durch,
+    // deaktivierte Buttons blockieren, versteckte fehlen im Index
+    UIArena arena("HitBench");
+    std::vector<UIElement*> widgets;
+    widgets.reserve(widgetCount);
+    
+    int cols = 1;
+    while (cols * cols < widgetCount) cols++;
+    int16_t stepX = max(1, DISPLAY_WIDTH / cols);
+    int16_t stepY = max(1, DISPLAY_HEIGHT / cols);
+    int16_t widgetW = max((int16_t)20, (int16_t)(stepX + 4));
+    int16_t widgetH = max((int16_t)12, (int16_t)(stepY + 4));
+    
+    for (int i = 0; i < widgetCount; i++) {
+        int16_t wx = (i % cols) * stepX;
+        int16_t wy = (i / cols) * stepY;
+        
+        UIElement* element;
+        if (i % 5 == 4) {
+            element = arena.create<UILabel>(wx, wy, widgetW, widgetH, "");
+        } else {
+            element = arena.create<UIButton>(wx, wy, widgetW, widgetH, "");
+            if (element && i % 7 == 3) element->setEnabled(false);
+        }
+        if (!element) {
+            Serial.println("UIManager: ❌ Kein Speicher für Test-Widgets");
+            return false;
+        }
+        if (i % 11 == 5) element->setVisible(false);
+        widgets.push_back(element);
+    }
+    
+    // Pseudo-zufällige Touch-Punkte (deterministisch, für beide Verfahren gleich)
+    std::vector<int16_t> qx(queries), qy(queries);
+    uint32_t seed = 12345;
+    for (int i = 0; i < queries; i++) {
+        seed = seed * 1103515245 + 12345;
+        qx[i] = (seed >> 8) % DISPLAY_WIDTH;
+        seed = seed * 1103515245 + 12345;
+        qy[i] = (seed >> 8) % DISPLAY_HEIGHT;
+    }
+    
+    // Lineare Suche (bisheriges Verfahren): von oben nach unten, erstes Element das Touch annimmt
+    std::vector<UIElement*> linearTargets(queries);
+    uint32_t t0 = micros();
+    for (int q = 0; q < queries; q++) {
+        UIElement* target = nullptr;
+        for (int i = (int)widgets.size() - 1; i >= 0; i--) {
+            UIElement* element = widgets[i];
+            if (isHitCandidate(element) && element->isPointInside(qx[q], qy[q]) && isTouchTarget(element)) {
+                target = element;
+                break;
+            }
+        }
+        linearTargets[q] = target;
+    }
+    uint32_t linearUs = micros() - t0;
+    
+    // Raster-Index aufbauen (wie ensureHitGrid())
+    UIHitGrid grid;
+    t0 = micros();
+    grid.rebuild(widgets, isHitCandidate);
+    uint32_t rebuildUs = micros() - t0;
+    
+    // Raster-Suche (wie dispatchTouch())
+    std::vector<UIElement*> gridTargets(queries);
+    t0 = micros();
+    for (int q = 0; q < queries; q++) {
+        gridTargets[q] = grid.hitTest(qx[q], qy[q], isTouchTarget);
+    }
+    uint32_t gridUs = micros() - t0;
+    
+    // Ziel pro Query vergleichen
+    uint32_t hits = 0;
+    uint32_t mismatches = 0;
+    int firstMismatch = -1;
+    for (int q = 0; q < queries; q++) {
+        if (linearTargets[q]) hits++;
+        if (linearTargets[q] != gridTargets[q]) {
+            if (firstMismatch < 0) firstMismatch = q;
+            mismatches++;
+        }
+    }
+    
+    Serial.println("\n=== UI Hit-Test Benchmark ===");
+    Serial.printf("Widgets:      %d\n", widgetCount);
+    Serial.printf("Queries:      %d (%lu mit Ziel)\n", queries, hits);
+    Serial.printf("Grid:         %dx%d Zellen à %dpx, %d Einträge\n",
+                  UIHitGrid::COLS, UIHitGrid::ROWS, UIHitGrid::CELL_SIZE, grid.getEntryCount());
+    Serial.printf("Rebuild:      %lu us\n", rebuildUs);
+    Serial.printf("Linear:       %lu us (%.2f us/Query)\n", linearUs, (float)linearUs / queries);
+    Serial.printf("Grid:         %lu us (%.2f us/Query)\n", gridUs, (float)gridUs / queries);
+    if (gridUs > 0) {
+        Serial.printf("Speedup:      %.1fx\n", (float)linearUs / gridUs);
+    }
+    if (mismatches == 0) {
+        Serial.println("Ergebnis:     ✅ identische Ziele");
+    } else {
+        Serial.printf("Ergebnis:     ❌ %lu Ziele abweichend (erste bei x=%d y=%d)\n",
+                      mismatches, qx[firstMismatch], qy[firstMismatch]);
+    }
+    Serial.println("============================\n");
+    
+    return mismatches == 0;
+}
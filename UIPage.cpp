@@ -13,8 +13,15 @@ UIPage::UIPage(const char* name, UIManager* uiMgr, TFT_eSPI* display)
     , tft(display)
     , uiLayout(nullptr)
     , pageManager(nullptr)
+    , content(0, 0, 0, 0)
+    , arena(pageName)
     , visible(false)
     , built(false)
+    , buildCount(0)
+    , lastBuildUs(0)
+    , lastUnloadUs(0)
+    , lastLayoutUs(0)
+    , contentLayout(nullptr)
     , hasBackButton(false)
     , backButtonTarget(-1)
 {
@@ -23,26 +30,57 @@ UIPage::UIPage(const char* name, UIManager* uiMgr, TFT_eSPI* display)
     
     // Standard-Layout initialisieren (Content-Bereich)
     initDefaultLayout();
+    
+    // Content-Container: Teilbaum der Page, auf den Content-Bereich geclippt
+    content.setBounds(layout.contentX, layout.contentY, layout.contentWidth, layout.contentHeight);
+    content.setClipChildren(true);
+    content.setVisible(false);
 }
 
 UIPage::~UIPage() {
-    // Elemente aufräumen
+    // Elemente aufräumen (Widgets liegen in der Arena)
+    if (ui && content.getParent()) {
+        ui->remove(&content);
+    }
+    content.clearChildren();
     contentElements.clear();
+    arena.reset();
 }
 
 void UIPage::show() {
     if (!built) {
         // Seite erstmalig bauen
         Serial.printf("UIPage: Building '%s'...\n", pageName);
+        uint32_t startUs = micros();
+        uint32_t handlerFailures = UIEventHandler::getPoolFailures();
         build();
+        applyLayout();
         built = true;
+        buildCount++;
+        lastBuildUs = micros() - startUs;
+        
+        Serial.printf("UIPage: '%s' - %d Widgets, %u Byte Arena, %lu us\n",
+                      pageName, contentElements.size(), (unsigned)arena.getUsed(), lastBuildUs);
+        
+        // Abgewiesene Handler = Widgets ohne Reaktion: Seite benennen statt nur den Pool
+        handlerFailures = UIEventHandler::getPoolFailures() - handlerFailures;
+        if (handlerFailures > 0) {
+            Serial.printf("UIPage: ❌ '%s' - %lu Handler abgewiesen, UI_EVENT_MAX_HANDLERS (%d) erhöhen!\n",
+                          pageName, (unsigned long)handlerFailures, UI_EVENT_MAX_HANDLERS);
+        }
+        
+        // Teilbaum als Top-Level-Knoten einhängen
+        if (ui) ui->add(&content);
     }
     
     visible = true;
     
+    // Ganzer Teilbaum wird sichtbar (ein Knoten, nicht jedes Element)
+    content.setVisible(true);
+    
     // UIManager informieren über aktuelle Page
     if (ui) {
-        ui->setCurrentPage(this);
+        ui->setCurrentPage(&content);
     }
     
     // ═══════════════════════════════════════════════════════════════
@@ -54,10 +92,7 @@ void UIPage::show() {
         // Content-Bereich löschen
         uiLayout->clearContent(layout.contentBgColor);
         
-        // Header und Footer neu zeichnen (für saubere Darstellung)
-        uiLayout->drawHeader();
-        uiLayout->drawFooter();
-        
+        // Header/Footer bleiben stehen - nur geänderte Felder werden gezeichnet
         // Seiten-Titel setzen
         uiLayout->setPageTitle(pageName);
         
@@ -76,23 +111,15 @@ void UIPage::show() {
         Serial.printf("UIPage::show() - '%s' - WARNUNG: UILayout ist nullptr!\n", pageName);
     }
     
-    // ═══════════════════════════════════════════════════════════════
-    // Content-Elemente sichtbar machen und zeichnen
-    // ═══════════════════════════════════════════════════════════════
-    Serial.printf("  Mache %d Content-Elemente sichtbar...\n", contentElements.size());
-    for (auto* element : contentElements) {
-        element->setVisible(true);
-        element->setNeedsRedraw(true);
-    }
+    // Content-Elemente zeichnet der Compositor (Container-Damage deckt alle ab)
+    Serial.printf("  %d Content-Elemente im Container\n", contentElements.size());
     
     Serial.printf("UIPage: '%s' angezeigt\n", pageName);
 }
 
 void UIPage::hide() {
-    // Content-Elemente verstecken
-    for (auto* element : contentElements) {
-        element->setVisible(false);
-    }
+    // Content-Teilbaum verstecken (Zeichnen und Hit-Test überspringen ihn komplett)
+    content.setVisible(false);
     
     // Button-States zurücksetzen (verhindert Ghost-Clicks)
     resetButtonStates();
@@ -105,6 +132,60 @@ void UIPage::hide() {
     Serial.printf("UIPage: '%s' versteckt (Button-States zurückgesetzt)\n", pageName);
 }
 
+bool UIPage::unload() {
+    if (visible) return false;
+    if (!built) return true;
+    
+    uint32_t startUs = micros();
+    
+    // Teilbaum zuerst aus dem UIManager lösen (keine Zeiger in freigegebenen Speicher)
+    if (ui && content.getParent()) {
+        ui->remove(&content);
+    }
+    content.clearChildren();
+    contentElements.clear();
+    contentLayout = nullptr;      // Boxen liegen in der Arena
+    
+    size_t freed = arena.getCapacity();
+    arena.reset();
+    built = false;
+    lastUnloadUs = micros() - startUs;
+    
+    Serial.printf("UIPage: '%s' entladen (%u Byte freigegeben, %lu us)\n",
+                  pageName, (unsigned)freed, lastUnloadUs);
+    return true;
+}
+
+void UIPage::setContentBounds(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (layout.contentX == x && layout.contentY == y &&
+        layout.contentWidth == w && layout.contentHeight == h) return;
+    
+    layout.contentX = x;
+    layout.contentY = y;
+    layout.contentWidth = w;
+    layout.contentHeight = h;
+    content.setBounds(x, y, w, h);
+    
+    if (built) applyLayout();
+}
+
+bool UIPage::applyLayout() {
+    if (!contentLayout) return false;
+    
+    uint32_t startUs = micros();
+    bool changed = contentLayout->layout(layout.contentX, layout.contentY,
+                                         layout.contentWidth, layout.contentHeight);
+    if (changed) lastLayoutUs = micros() - startUs;
+    return changed;
+}
+
+void UIPage::invalidateLayout() {
+    if (!contentLayout) return;
+    
+    contentLayout->invalidate();
+    applyLayout();
+}
+
 void UIPage::onHide() {
     // Standard-Implementation (leer)
     // Kann in abgeleiteten Klassen überschrieben werden
@@ -136,11 +217,9 @@ void UIPage::setPageManager(PageManager* pm) {
 void UIPage::addContentElement(UIElement* element) {
     if (!element || !ui) return;
     
-    // Owner-Page setzen
-    element->setOwnerPage(this);
-    
+    // In den Teilbaum der Page einhängen
     contentElements.push_back(element);
-    ui->add(element);
+    content.addChild(element);
 }
 
 void UIPage::initDefaultLayout() {
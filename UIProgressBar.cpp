@@ -5,11 +5,10 @@
 #include "include/UIProgressBar.h"
 
 UIProgressBar::UIProgressBar(int16_t x, int16_t y, int16_t w, int16_t h)
-    : UIElement(x, y, w, h), value(0), barColor(COLOR_GREEN), 
+    : UIElement(x, y, w, h), value(0), 
       showText(true), showPercentage(true) {
     
-    style.bgColor = COLOR_DARKGRAY;
-    style.borderColor = COLOR_WHITE;
+    setStyleRole(StyleRole::PROGRESS_BAR);
 }
 
 UIProgressBar::~UIProgressBar() {
@@ -52,8 +51,7 @@ void UIProgressBar::setValue(int val) {
 }
 
 void UIProgressBar::setBarColor(uint16_t color) {
-    barColor = color;
-    needsRedraw = true;
+    setStyleField(STYLE_ACCENT, color);
 }
 
 void UIProgressBar::setShowText(bool show) {
@@ -67,18 +65,20 @@ void UIProgressBar::setShowPercentage(bool show) {
 }
 
 void UIProgressBar::drawProgressBar(TFT_eSPI* tft) {
+    const ElementStyle& st = style();
+    
     // Hintergrund
-    fillRoundRect(tft, x, y, width, height, style.cornerRadius, style.bgColor);
+    fillRoundRect(tft, x, y, width, height, st.cornerRadius, st.bgColor);
     
     // Fortschritts-Balken
     int barWidth = (width - 4) * value / 100;
     if (barWidth > 0) {
         fillRoundRect(tft, x + 2, y + 2, barWidth, height - 4, 
-                     style.cornerRadius - 1, barColor);
+                     st.cornerRadius - 1, st.accentColor);
     }
     
     // Rahmen
-    drawRoundRect(tft, x, y, width, height, style.cornerRadius, style.borderColor);
+    drawRoundRect(tft, x, y, width, height, st.cornerRadius, st.borderColor);
     
     // Text (Prozent-Anzeige)
     if (showText) {
@@ -90,7 +90,7 @@ void UIProgressBar::drawProgressBar(TFT_eSPI* tft) {
         }
         
         tft->setTextDatum(MC_DATUM);
-        tft->setTextColor(style.textColor);
+        tft->setTextColor(st.textColor);
         tft->drawString(buffer, x + width / 2, y + height / 2);
     }
 }
\ No newline at end of file
@@ -10,15 +10,12 @@
 
 UIRadioButton::UIRadioButton(int16_t x, int16_t y, int16_t size, const char* lbl, int val)
     : UIElement(x, y, size + 5 + 150, size), selected(false), wasInside(false),
-      dotColor(COLOR_BLUE), circleSize(size), value(val), group(nullptr) {
+      circleSize(size), value(val), group(nullptr) {
     
     strncpy(label, lbl, sizeof(label) - 1);
     label[sizeof(label) - 1] = '\0';
     
-    style.bgColor = COLOR_BLACK;
-    style.borderColor = COLOR_WHITE;
-    style.textColor = COLOR_WHITE;
-    style.borderWidth = 2;
+    setStyleRole(StyleRole::RADIO_BUTTON);
 }
 
 UIRadioButton::~UIRadioButton() {
@@ -79,8 +76,7 @@ void UIRadioButton::setLabel(const char* lbl) {
 }
 
 void UIRadioButton::setDotColor(uint16_t color) {
-    dotColor = color;
-    needsRedraw = true;
+    setStyleField(STYLE_ACCENT, color);
 }
 
 void UIRadioButton::drawRadioButton(TFT_eSPI* tft) {
@@ -88,28 +84,27 @@ void UIRadioButton::drawRadioButton(TFT_eSPI* tft) {
     int16_t circleX = x + circleSize / 2;
     int16_t circleY = y + circleSize / 2;
     int16_t radius = circleSize / 2;
+    const ElementStyle& st = style();   // Deaktiviert: grauer Rahmen + Text
     
     // Hintergrund
-    tft->fillCircle(circleX, circleY, radius, style.bgColor);
+    tft->fillCircle(circleX, circleY, radius, st.bgColor);
     
-    // Rahmen
+    // Rahmen (dünner wenn deaktiviert)
+    tft->drawCircle(circleX, circleY, radius, st.borderColor);
     if (enabled) {
-        tft->drawCircle(circleX, circleY, radius, style.borderColor);
-        tft->drawCircle(circleX, circleY, radius - 1, style.borderColor);
-    } else {
-        tft->drawCircle(circleX, circleY, radius, COLOR_GRAY);
+        tft->drawCircle(circleX, circleY, radius - 1, st.borderColor);
     }
     
     // Punkt wenn selected
     if (selected) {
         int16_t dotRadius = radius - 4;
-        tft->fillCircle(circleX, circleY, dotRadius, dotColor);
+        tft->fillCircle(circleX, circleY, dotRadius, st.accentColor);
     }
     
     // Label rechts neben dem Kreis
     if (strlen(label) > 0) {
         tft->setTextDatum(ML_DATUM);
-        tft->setTextColor(enabled ? style.textColor : COLOR_GRAY);
+        tft->setTextColor(st.textColor);
         tft->setTextSize(2);
         tft->drawString(label, x + circleSize + 5, y + circleSize / 2);
     }
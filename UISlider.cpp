@@ -8,14 +8,13 @@
 
 UISlider::UISlider(int16_t x, int16_t y, int16_t w, int16_t h)
     : UIElement(x, y, w, h), value(50), dragging(false), 
-      knobColor(COLOR_WHITE), barColor(COLOR_BLUE), showValue(true) {
+      knobColor(COLOR_WHITE), showValue(true) {
     
     knobRadius = h / 2 - 2;
     if (knobRadius < 5) knobRadius = 5;
     if (knobRadius > 10) knobRadius = 10;
     
-    style.bgColor = COLOR_BLACK;
-    style.borderColor = COLOR_WHITE;
+    setStyleRole(StyleRole::SLIDER);
 }
 
 UISlider::~UISlider() {
@@ -59,6 +58,14 @@ void UISlider::handleTouch(int16_t tx, int16_t ty, bool isPressed) {
     }
 }
 
+bool UISlider::handleGesture(EventType type, EventData* data) {
+    UIElement::handleGesture(type, data);
+    
+    // Bewegungs-Gesten gehören zum Drag (kein Seitenwechsel per Swipe)
+    // FLING nicht konsumieren → kein Kinetic-Scrolling für Slider
+    return type == EventType::PAN || type == EventType::SWIPE;
+}
+
 void UISlider::setValue(int val) {
     // Wert begrenzen auf 0-100
     if (val < 0) val = 0;
@@ -81,8 +88,7 @@ void UISlider::setKnobColor(uint16_t color) {
 }
 
 void UISlider::setBarColor(uint16_t color) {
-    barColor = color;
-    needsRedraw = true;
+    setStyleField(STYLE_ACCENT, color);
 }
 
 void UISlider::setShowValue(bool show) {
@@ -99,9 +105,10 @@ void UISlider::drawSlider(TFT_eSPI* tft) {
     int railWidth = width - (2 * padding);
     int railY = y + height / 2 - 3;
     int railHeight = 6;
+    const ElementStyle& st = style();
     
     // ✅ FIX: NUR innerhalb Widget-Bounds löschen (KEIN Überschreiben!)
-    tft->fillRect(x, y, width, height, style.bgColor);
+    tft->fillRect(x, y, width, height, st.bgColor);
     
     // Hintergrund-Schiene zeichnen (mit Padding)
     fillRoundRect(tft, railX, railY, railWidth, railHeight, 3, COLOR_DARKGRAY);
@@ -110,15 +117,15 @@ void UISlider::drawSlider(TFT_eSPI* tft) {
     int knobX = getKnobX();
     int filledWidth = knobX - railX;
     if (filledWidth > 0) {
-        fillRoundRect(tft, railX, railY, filledWidth, railHeight, 3, barColor);
+        fillRoundRect(tft, railX, railY, filledWidth, railHeight, 3, st.accentColor);
     }
     
     // Rahmen um Schiene
-    drawRoundRect(tft, railX, railY, railWidth, railHeight, 3, style.borderColor);
+    drawRoundRect(tft, railX, railY, railWidth, railHeight, 3, st.borderColor);
     
     // Knob (Schieberegler)
     tft->fillCircle(knobX, y + height / 2, knobRadius, knobColor);
-    tft->drawCircle(knobX, y + height / 2, knobRadius, style.borderColor);
+    tft->drawCircle(knobX, y + height / 2, knobRadius, st.borderColor);
     
     // Highlight auf Knob (für 3D-Effekt)
     if (!dragging) {
@@ -131,14 +138,40 @@ void UISlider::drawSlider(TFT_eSPI* tft) {
         sprintf(buffer, "%d%%", value);
         
         tft->setTextDatum(MR_DATUM);  // Middle Right
-        tft->setTextColor(style.textColor, COLOR_BLACK);  // Transparenter Hintergrund
+        tft->setTextColor(st.textColor, COLOR_BLACK);  // Transparenter Hintergrund
         tft->setTextSize(2);
         
+        // Alten (evtl. längeren) Wert löschen, Slider-Fläche ist schon gefüllt
+        tft->fillRect(x + width, y + height / 2 - VALUE_TEXT_HEIGHT / 2,
+                      VALUE_AREA_WIDTH, VALUE_TEXT_HEIGHT, COLOR_BLACK);
+        
         // Wert rechts neben dem Slider (außerhalb Widget)
-        tft->drawString(buffer, x + width + 40, y + height / 2);
+        tft->drawString(buffer, x + width + VALUE_AREA_WIDTH, y + height / 2);
     }
 }
 
+void UISlider::getPaintBounds(int16_t* outX, int16_t* outY, int16_t* outW, int16_t* outH) {
+    int16_t px = x, py = y, pw = width, ph = height;
+    
+    // Wert-Anzeige rechts außerhalb der Bounds
+    if (showValue) {
+        pw += VALUE_AREA_WIDTH;
+        int16_t textTop = y + height / 2 - VALUE_TEXT_HEIGHT / 2;
+        if (textTop < py) {
+            ph += py - textTop;
+            py = textTop;
+        }
+        if (textTop + VALUE_TEXT_HEIGHT > py + ph) {
+            ph = textTop + VALUE_TEXT_HEIGHT - py;
+        }
+    }
+    
+    if (outX) *outX = px;
+    if (outY) *outY = py;
+    if (outW) *outW = pw;
+    if (outH) *outH = ph;
+}
+
 void UISlider::updateValueFromTouch(int16_t tx) {
     // Touch-X in Wert umrechnen (0-100)
     int localX = tx - x;
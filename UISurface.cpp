@@ -0,0 +1,51 @@
+/**
+ * UISurface.cpp
+ */
+
+#include "include/UISurface.h"
+
+UISurface* UISurface::firstSurface = nullptr;
+
+UISurface::UISurface(TFT_eSPI* tft)
+    : TFT_eSprite(tft), nextSurface(firstSurface) {
+
+    firstSurface = this;
+}
+
+UISurface::~UISurface() {
+    // Aus der Verkettung lösen
+    for (UISurface** link = &firstSurface; *link; link = &(*link)->nextSurface) {
+        if (*link == this) {
+            *link = nextSurface;
+            break;
+        }
+    }
+}
+
+void UISurface::blit(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+    pushImage(x, y, w, h, const_cast<uint16_t*>(data));
+}
+
+void UISurface::push(TFT_eSPI* target, int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+    // pushImage() ist nicht virtuell → Sprite-Ziele direkt ansprechen
+    UISurface* surface = find(target);
+
+    // Pixel liegen bereits in Display-Byte-Reihenfolge
+    bool swap = target->getSwapBytes();
+    target->setSwapBytes(false);
+
+    if (surface) {
+        surface->blit(x, y, w, h, data);
+    } else {
+        target->pushImage(x, y, w, h, const_cast<uint16_t*>(data));
+    }
+
+    target->setSwapBytes(swap);
+}
+
+UISurface* UISurface::find(TFT_eSPI* target) {
+    for (UISurface* surface = firstSurface; surface; surface = surface->nextSurface) {
+        if (static_cast<TFT_eSPI*>(surface) == target) return surface;
+    }
+    return nullptr;
+}
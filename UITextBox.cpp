@@ -4,53 +4,130 @@
 
 #include "include/UITextBox.h"
 
+static_assert(UI_TEXTBOX_BUFFER_SIZE <= 65535, "UI_TEXTBOX_BUFFER_SIZE muss in uint16_t passen");
+
 UITextBox::UITextBox(int16_t x, int16_t y, int16_t w, int16_t h)
-    : UIElement(x, y, w, h), scrollY(0), lineHeight(16), fontSize(2), 
-      wordWrap(true), padding(5), scrolling(false), lastTouchY(0), scrollStartY(0) {
+    : UIElement(x, y, w, h), ringHead(0), lineCount(0), writePos(0), firstLineNo(0), droppedLines(0),
+      scrollY(0), lineHeight(16), fontSize(2), wordWrap(true), autoScroll(true), padding(5),
+      scrolling(false), scrollStartY(0), scrollRemainder(0),
+      fullRedraw(true), contentChanged(true), drawnFirstLine(0), drawnRows(0),
+      drawnIndicatorY(0), drawnIndicatorH(0), drawnBgColor(0), drawnTextColor(0), drawnBorderColor(0),
+      canvas(nullptr), canvasFailed(false), canvasValid(false), canvasFirstLine(0), canvasRows(0) {
     
-    style.bgColor = COLOR_BLACK;
-    style.borderColor = COLOR_WHITE;
-    style.textColor = COLOR_WHITE;
+    setStyleRole(StyleRole::TEXTBOX);
     
     maxVisibleLines = calculateMaxVisibleLines();
+    layoutWidth = width;
+    layoutHeight = height;
 }
 
 UITextBox::~UITextBox() {
+    releaseCanvas();
 }
 
 void UITextBox::draw(TFT_eSPI* tft) {
     if (!visible) return;
     
-    drawTextBox(tft);
+    checkSize();
+    ensureCanvas(tft);
+    
+    bool full = fullRedraw || !painted || styleChanged();
+    int first, end;
+    
+    if (full) {
+        // Hintergrund + Rahmen, dann alle Zeilen
+        fillRoundRect(tft, x, y, width, height, style().cornerRadius, style().bgColor);
+        drawRoundRect(tft, x, y, width, height, style().cornerRadius, style().borderColor);
+        first = 0;
+        end = canvas ? maxVisibleLines : visibleRows();
+    } else {
+        getChangedRows(&first, &end);
+    }
+    
+    // Kein eigener Viewport: Zeilen sind auf die Textbreite umbrochen, und ein
+    // setViewport()/resetViewport() würde das Clipping des Compositors aufheben
+    if (canvas) {
+        updateCanvas();
+        if (end > first) pushCanvasRows(tft, first, end);
+    } else if (end > first) {
+        drawRows(tft, first, end);
+    }
+    
+    int16_t iy = 0, ih = 0;
+    getIndicator(&iy, &ih);
+    bool indicatorChanged = iy != drawnIndicatorY || ih != drawnIndicatorH;
+    if (full || end > first || indicatorChanged) {
+        drawIndicator(tft, !full && indicatorChanged);
+    }
+    
+    drawnFirstLine = viewFirstLine();
+    drawnRows = visibleRows();
+    drawnBgColor = style().bgColor;
+    drawnTextColor = style().textColor;
+    drawnBorderColor = style().borderColor;
+    fullRedraw = false;
+    contentChanged = false;
     needsRedraw = false;
 }
 
+void UITextBox::getDirtyBounds(int16_t* outX, int16_t* outY, int16_t* outW, int16_t* outH) {
+    checkSize();
+    
+    int first, end;
+    getChangedRows(&first, &end);
+    
+    int16_t iy = 0, ih = 0;
+    bool indicator = getIndicator(&iy, &ih);
+    bool indicatorChanged = iy != drawnIndicatorY || ih != drawnIndicatorH;
+    
+    if (fullRedraw || styleChanged() || (end <= first && !indicatorChanged)) {
+        getPaintBounds(outX, outY, outW, outH);
+        return;
+    }
+    
+    // Geänderte Zeilen (volle Textbreite)
+    int16_t x0 = x + width, y0 = y + height, x1 = x, y1 = y;
+    if (end > first) {
+        x0 = x + padding;
+        x1 = x + width - padding;
+        y0 = y + padding + first * lineHeight;
+        y1 = y + padding + end * lineHeight;
+    }
+    
+    // Scroll-Indikator: alter und neuer Balken (wird nach den Zeilen neu gezeichnet)
+    int16_t ix = x + width - padding - INDICATOR_WIDTH;
+    if (indicatorChanged && drawnIndicatorH > 0) {
+        x0 = min(x0, ix);
+        x1 = max(x1, (int16_t)(ix + INDICATOR_WIDTH));
+        y0 = min(y0, drawnIndicatorY);
+        y1 = max(y1, (int16_t)(drawnIndicatorY + drawnIndicatorH));
+    }
+    if ((indicatorChanged || end > first) && indicator) {
+        x0 = min(x0, ix);
+        x1 = max(x1, (int16_t)(ix + INDICATOR_WIDTH));
+        y0 = min(y0, iy);
+        y1 = max(y1, (int16_t)(iy + ih));
+    }
+    
+    if (outX) *outX = x0;
+    if (outY) *outY = y0;
+    if (outW) *outW = x1 - x0;
+    if (outH) *outH = y1 - y0;
+}
+
 void UITextBox::handleTouch(int16_t tx, int16_t ty, bool isPressed) {
     if (!visible || !enabled) return;
     
     bool inside = isPointInside(tx, ty);
     
+    // Scrolling selbst läuft über PAN-Gesten (handleGesture)
     if (isPressed && inside) {
         if (!scrolling) {
-            // Scrolling starten
             scrolling = true;
             scrollStartY = ty;
-            lastTouchY = ty;
-        } else {
-            // Scrolling fortsetzen
-            int deltaY = ty - lastTouchY;
-            
-            if (abs(deltaY) > lineHeight / 2) {
-                int scrollLines = deltaY / (lineHeight / 2);
-                if (scrollLines > 0) {
-                    scrollUp(scrollLines);
-                } else if (scrollLines < 0) {
-                    scrollDown(-scrollLines);
-                }
-                lastTouchY = ty;
-            }
+            scrollRemainder = 0;
         }
-    } else {
+    } else if (!isPressed) {
         // Touch beendet
         if (scrolling) {
             scrolling = false;
@@ -64,120 +141,137 @@ void UITextBox::handleTouch(int16_t tx, int16_t ty, bool isPressed) {
     }
 }
 
-void UITextBox::setText(const char* text) {
-    lines.clear();
-    scrollY = 0;
-    
-    if (wordWrap) {
-        wrapText(text, lines);
-    } else {
-        // Text direkt als Zeilen speichern
-        String str(text);
-        int start = 0;
-        int pos = 0;
+bool UITextBox::handleGesture(EventType type, EventData* data) {
+    switch (type) {
+        case EventType::PAN:
+            // Inhalt folgt dem Finger (Finger nach unten → nach oben scrollen)
+            // false bei Anschlag → Kinetic-Scrolling endet
+            UIElement::handleGesture(type, data);
+            return scrollByPixels(-data->dy);
+        
+        case EventType::FLING:
+            // Nur vertikale Flings übernehmen (Kinetic-Scrolling)
+            UIElement::handleGesture(type, data);
+            return fabsf(data->vy) > fabsf(data->vx) && getMaxScroll() > 0;
         
-        while (pos < str.length()) {
-            if (str[pos] == '\n') {
-                lines.push_back(str.substring(start, pos));
-                start = pos + 1;
+        case EventType::SWIPE:
+            // Horizontale Swipes an Page weiterreichen (Seitenwechsel)
+            if (data->value == static_cast<int>(SwipeDirection::UP) ||
+                data->value == static_cast<int>(SwipeDirection::DOWN)) {
+                UIElement::handleGesture(type, data);
+                return true;
             }
-            pos++;
-        }
+            return UIElement::handleGesture(type, data);
         
-        // Letzte Zeile
-        if (start < str.length()) {
-            lines.push_back(str.substring(start));
-        }
+        default:
+            return UIElement::handleGesture(type, data);
     }
+}
+
+bool UITextBox::scrollByPixels(int pixels) {
+    if (lineHeight <= 0) return false;
+    
+    scrollRemainder += pixels;
+    int scrollLines = scrollRemainder / lineHeight;
+    if (scrollLines == 0) return true;
+    
+    scrollRemainder -= scrollLines * lineHeight;
     
+    int oldScroll = scrollY;
+    if (scrollLines > 0) {
+        scrollDown(scrollLines);
+    } else {
+        scrollUp(-scrollLines);
+    }
+    
+    if (scrollY == oldScroll) {
+        // Anschlag erreicht
+        scrollRemainder = 0;
+        return false;
+    }
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Text
+// ═══════════════════════════════════════════════════════════════
+
+void UITextBox::setText(const char* text) {
+    resetLines();
+    appendWrapped(text, false);
     needsRedraw = true;
 }
 
 void UITextBox::appendLine(const char* line) {
-    if (wordWrap) {
-        std::vector<String> wrappedLines;
-        wrapText(line, wrappedLines);
-        for (const auto& l : wrappedLines) {
-            lines.push_back(l);
-        }
-    } else {
-        lines.push_back(String(line));
-    }
+    appendWrapped(line, autoScroll && scrollY >= getMaxScroll());
     needsRedraw = true;
 }
 
 void UITextBox::appendText(const char* text) {
-    std::vector<String> newLines;
-    
-    if (wordWrap) {
-        wrapText(text, newLines);
-    } else {
-        String str(text);
-        int start = 0;
-        int pos = 0;
-        
-        while (pos < str.length()) {
-            if (str[pos] == '\n') {
-                newLines.push_back(str.substring(start, pos));
-                start = pos + 1;
-            }
-            pos++;
-        }
-        
-        if (start < str.length()) {
-            newLines.push_back(str.substring(start));
-        }
-    }
-    
-    for (const auto& line : newLines) {
-        lines.push_back(line);
-    }
-    
+    appendWrapped(text, autoScroll && scrollY >= getMaxScroll());
     needsRedraw = true;
 }
 
 void UITextBox::clear() {
-    lines.clear();
-    scrollY = 0;
+    resetLines();
     needsRedraw = true;
 }
 
 void UITextBox::scrollToBottom() {
-    scrollY = getMaxScroll();
-    needsRedraw = true;
+    int maxScroll = getMaxScroll();
+    if (scrollY != maxScroll) {
+        scrollY = maxScroll;
+        needsRedraw = true;
+    }
 }
 
 void UITextBox::scrollToTop() {
-    scrollY = 0;
-    needsRedraw = true;
+    if (scrollY != 0) {
+        scrollY = 0;
+        needsRedraw = true;
+    }
 }
 
 void UITextBox::setWordWrap(bool wrap) {
+    // Gilt für neu angehängten Text
     wordWrap = wrap;
-    needsRedraw = true;
 }
 
 void UITextBox::setLineHeight(int height) {
     lineHeight = height;
-    maxVisibleLines = calculateMaxVisibleLines();
-    needsRedraw = true;
+    layoutChanged();
 }
 
 void UITextBox::setFontSize(uint8_t size) {
     if (size >= 1 && size <= 4) {
         fontSize = size;
         lineHeight = fontSize * 8 + 4;
-        maxVisibleLines = calculateMaxVisibleLines();
-        needsRedraw = true;
+        layoutChanged();
     }
 }
 
 void UITextBox::setPadding(int pad) {
     padding = pad;
+    layoutChanged();
+}
+
+void UITextBox::layoutChanged() {
+    // Bereits umbrochene Zeilen bleiben wie sie sind (wie bisher)
     maxVisibleLines = calculateMaxVisibleLines();
+    layoutWidth = width;
+    layoutHeight = height;
+    if (scrollY > getMaxScroll()) scrollY = getMaxScroll();
+    
+    releaseCanvas();
+    canvasFailed = false;
+    fullRedraw = true;
     needsRedraw = true;
 }
 
+void UITextBox::checkSize() {
+    if (width != layoutWidth || height != layoutHeight) layoutChanged();
+}
+
 void UITextBox::scrollUp(int scrollLines) {
     if (scrollY > 0) {
         scrollY -= scrollLines;
@@ -196,104 +290,282 @@ void UITextBox::scrollDown(int scrollLines) {
 }
 
 int UITextBox::getMaxScroll() const {
-    int totalLines = lines.size();
-    int maxScroll = totalLines - maxVisibleLines;
+    int maxScroll = lineCount - maxVisibleLines;
     return maxScroll > 0 ? maxScroll : 0;
 }
 
-void UITextBox::drawTextBox(TFT_eSPI* tft) {
-    // Hintergrund
-    fillRoundRect(tft, x, y, width, height, style.cornerRadius, style.bgColor);
-    
-    // Rahmen
-    drawRoundRect(tft, x, y, width, height, style.cornerRadius, style.borderColor);
-    
-    // Clipping-Bereich setzen (damit Text nicht über Rahmen geht)
-    tft->setViewport(x + padding, y + padding, 
-                     width - 2 * padding, height - 2 * padding);
-    
-    // Text zeichnen
-    tft->setTextSize(fontSize);
-    tft->setTextColor(style.textColor, style.bgColor);
-    tft->setTextDatum(TL_DATUM);
+// ═══════════════════════════════════════════════════════════════
+// Ringpuffer
+// ═══════════════════════════════════════════════════════════════
+
+const char* UITextBox::lineText(int index) const {
+    return &textBuffer[lineRing[(ringHead + index) % UI_TEXTBOX_MAX_LINES].offset];
+}
+
+void UITextBox::pushLine(const char* text, int length) {
+    if (length > UI_TEXTBOX_BUFFER_SIZE - 1) length = UI_TEXTBOX_BUFFER_SIZE - 1;
+    int needed = length + 1;
     
-    int textY = 0;  // FIX: Nach setViewport() relativ!
-    int endLine = scrollY + maxVisibleLines;
-    if (endLine > lines.size()) endLine = lines.size();
+    if (lineCount == UI_TEXTBOX_MAX_LINES) dropOldestLine();
     
-    for (int i = scrollY; i < endLine; i++) {
-        if (textY + lineHeight > height - 2 * padding) break;
+    // Platz schaffen: jede Zeile liegt zusammenhängend (mit Nullterminator) im
+    // Puffer, passt sie nicht mehr ans Ende, geht es vorne weiter
+    while (lineCount > 0) {
+        int oldest = lineRing[ringHead].offset;
         
-        tft->drawString(lines[i].c_str(), 0, textY);  // FIX: Relativ zum Viewport!
-        textY += lineHeight;
+        if (oldest < writePos) {
+            // Belegt: [oldest, writePos) → frei bis Pufferende
+            if (writePos + needed <= UI_TEXTBOX_BUFFER_SIZE) break;
+            writePos = 0;  // Rest am Ende bleibt ungenutzt
+        } else if (oldest - writePos >= needed) {
+            // Frei: [writePos, oldest)
+            break;
+        } else {
+            dropOldestLine();
+        }
     }
+    if (lineCount == 0 && writePos + needed > UI_TEXTBOX_BUFFER_SIZE) writePos = 0;
     
-    // Viewport zurücksetzen
-    tft->resetViewport();
+    LineRecord& record = lineRing[(ringHead + lineCount) % UI_TEXTBOX_MAX_LINES];
+    record.offset = writePos;
+    record.length = length;
+    memcpy(&textBuffer[writePos], text, length);
+    textBuffer[writePos + length] = '\0';
     
-    // Scroll-Indikator zeichnen (falls mehr Zeilen vorhanden)
-    if (lines.size() > maxVisibleLines) {
-        int indicatorHeight = (height - 2 * padding) * maxVisibleLines / lines.size();
-        if (indicatorHeight < 10) indicatorHeight = 10;
-        
-        int indicatorY = y + padding + ((height - 2 * padding - indicatorHeight) * scrollY) / getMaxScroll();
-        
-        tft->fillRect(x + width - padding - 3, indicatorY, 3, indicatorHeight, style.borderColor);
-    }
+    writePos += needed;
+    lineCount++;
 }
 
-void UITextBox::wrapText(const char* text, std::vector<String>& outLines) {
-    // Temporäres TFT-Objekt für Breiten-Berechnung (nur wenn nötig)
-    // Annahme: Font ist bereits gesetzt
+void UITextBox::dropOldestLine() {
+    ringHead = (ringHead + 1) % UI_TEXTBOX_MAX_LINES;
+    lineCount--;
+    firstLineNo++;
+    droppedLines++;
     
-    String str(text);
-    int maxCharsPerLine = (width - 2 * padding) / (fontSize * 6);
+    // Ansicht bleibt auf denselben Zeilen (außer ganz oben)
+    if (scrollY > 0) scrollY--;
+}
+
+void UITextBox::resetLines() {
+    firstLineNo += lineCount;
+    ringHead = 0;
+    lineCount = 0;
+    writePos = 0;
+    droppedLines = 0;
+    scrollY = 0;
+    scrollRemainder = 0;
+    contentChanged = true;
+    canvasValid = false;
+}
+
+void UITextBox::appendWrapped(const char* text, bool follow) {
+    if (!text) text = "";
+    int maxChars = wordWrap ? getMaxCharsPerLine() : UI_TEXTBOX_BUFFER_SIZE - 1;
     
-    int start = 0;
-    while (start < str.length()) {
-        // Suche nach Zeilenumbruch
-        int newlinePos = str.indexOf('\n', start);
-        int end;
-        
-        if (newlinePos == -1) {
-            end = str.length();
-        } else {
-            end = newlinePos;
-        }
+    // Nur der neue Text wird umbrochen, bestehende Zeilen bleiben unberührt
+    const char* paragraph = text;
+    while (true) {
+        const char* newline = strchr(paragraph, '\n');
+        int end = newline ? newline - paragraph : strlen(paragraph);
         
-        // Zeile in Chunks aufteilen falls zu lang
-        while (start < end) {
-            int chunkEnd = start + maxCharsPerLine;
+        // Leere Absätze ergeben eine Leerzeile
+        int start = 0;
+        do {
+            int chunkEnd = start + maxChars;
             if (chunkEnd > end) chunkEnd = end;
             
             // Versuche an Leerzeichen zu trennen
             if (chunkEnd < end) {
-                int spacePos = str.lastIndexOf(' ', chunkEnd);
-                if (spacePos > start) {
-                    chunkEnd = spacePos + 1;
+                for (int pos = chunkEnd; pos > start; pos--) {
+                    if (paragraph[pos] == ' ') {
+                        chunkEnd = pos + 1;
+                        break;
+                    }
                 }
             }
             
-            outLines.push_back(str.substring(start, chunkEnd));
+            pushLine(paragraph + start, chunkEnd - start);
             start = chunkEnd;
             
             // Überspringe Leerzeichen am Anfang der neuen Zeile
-            while (start < end && str[start] == ' ') start++;
+            while (start < end && paragraph[start] == ' ') start++;
+        } while (start < end);
+        
+        // Abschließender Zeilenumbruch erzeugt keine weitere Zeile
+        if (!newline || newline[1] == '\0') break;
+        paragraph = newline + 1;
+    }
+    
+    if (follow) scrollY = getMaxScroll();
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Zeichnen
+// ═══════════════════════════════════════════════════════════════
+
+int UITextBox::visibleRows() const {
+    int rows = lineCount - scrollY;
+    if (rows > maxVisibleLines) rows = maxVisibleLines;
+    return rows > 0 ? rows : 0;
+}
+
+void UITextBox::getChangedRows(int* first, int* end) const {
+    int rows = visibleRows();
+    
+    if (contentChanged || viewFirstLine() != drawnFirstLine) {
+        // Gescrollt / ersetzt → alle Zeilen (auch zuvor gezeichnete leeren)
+        *first = 0;
+        *end = max(rows, drawnRows);
+    } else {
+        // Gleiche Position → nur hinzugekommene Zeilen
+        *first = min(rows, drawnRows);
+        *end = max(rows, drawnRows);
+    }
+}
+
+bool UITextBox::getIndicator(int16_t* outY, int16_t* outH) const {
+    *outY = 0;
+    *outH = 0;
+    if (lineCount <= maxVisibleLines) return false;
+    
+    int innerHeight = height - 2 * padding;
+    int indicatorHeight = innerHeight * maxVisibleLines / lineCount;
+    if (indicatorHeight < 10) indicatorHeight = 10;
+    
+    *outY = y + padding + ((innerHeight - indicatorHeight) * scrollY) / getMaxScroll();
+    *outH = indicatorHeight;
+    return true;
+}
+
+bool UITextBox::styleChanged() const {
+    return style().bgColor != drawnBgColor || style().textColor != drawnTextColor ||
+           style().borderColor != drawnBorderColor;
+}
+
+void UITextBox::drawRows(TFT_eSPI* tft, int first, int end) {
+    tft->setTextSize(fontSize);
+    tft->setTextColor(style().textColor, style().bgColor);
+    tft->setTextDatum(TL_DATUM);
+    
+    for (int row = first; row < end; row++) {
+        int16_t rowY = y + padding + row * lineHeight;
+        tft->fillRect(x + padding, rowY, textAreaWidth(), lineHeight, style().bgColor);
+        
+        int index = scrollY + row;
+        if (index < lineCount) tft->drawString(lineText(index), x + padding, rowY);
+    }
+}
+
+void UITextBox::drawIndicator(TFT_eSPI* tft, bool clearOld) {
+    int16_t ix = x + width - padding - INDICATOR_WIDTH;
+    
+    if (clearOld && drawnIndicatorH > 0) {
+        tft->fillRect(ix, drawnIndicatorY, INDICATOR_WIDTH, drawnIndicatorH, style().bgColor);
+    }
+    
+    int16_t iy, ih;
+    if (getIndicator(&iy, &ih)) {
+        tft->fillRect(ix, iy, INDICATOR_WIDTH, ih, style().borderColor);
+    }
+    
+    drawnIndicatorY = iy;
+    drawnIndicatorH = ih;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Textbereich-Sprite
+// ═══════════════════════════════════════════════════════════════
+
+void UITextBox::ensureCanvas(TFT_eSPI* tft) {
+#if UI_TEXTBOX_CANVAS
+    if (canvas || canvasFailed || maxVisibleLines <= 0 || textAreaWidth() <= 0) return;
+    
+    canvas = new TFT_eSprite(tft);
+    canvas->setColorDepth(16);
+    canvas->setAttribute(PSRAM_ENABLE, true);
+    
+    if (!canvas->createSprite(textAreaWidth(), maxVisibleLines * lineHeight)) {
+        Serial.println("UITextBox: ⚠️ Text-Sprite nicht verfügbar, zeichne Zeilen direkt");
+        delete canvas;
+        canvas = nullptr;
+        canvasFailed = true;
+        return;
+    }
+    
+    canvasValid = false;
+#endif
+}
+
+void UITextBox::releaseCanvas() {
+    if (canvas) {
+        canvas->deleteSprite();
+        delete canvas;
+        canvas = nullptr;
+    }
+    canvasValid = false;
+}
+
+void UITextBox::updateCanvas() {
+    uint32_t first = viewFirstLine();
+    int rows = visibleRows();
+    int32_t delta = (int32_t)(first - canvasFirstLine);
+    
+    if (!canvasValid || styleChanged() || delta >= maxVisibleLines || delta <= -maxVisibleLines) {
+        canvas->setScrollRect(0, 0, textAreaWidth(), maxVisibleLines * lineHeight, style().bgColor);
+        renderCanvasRows(0, maxVisibleLines);
+    } else {
+        // Weiterhin gültige Zeilen verschieben (freigelegter Bereich wird gelöscht)
+        if (delta != 0) canvas->scroll(0, -delta * lineHeight);
+        
+        int validFirst = constrain(-delta, 0, maxVisibleLines);
+        int validEnd = constrain(canvasRows - delta, validFirst, maxVisibleLines);
+        
+        // Oben freigelegte Zeilen (zurückgescrollt)
+        renderCanvasRows(0, validFirst);
+        
+        // Unten neue Zeilen (angehängt / weitergescrollt)
+        if (rows > validEnd) {
+            renderCanvasRows(validEnd, rows);
+        } else {
+            renderCanvasRows(rows, validEnd);
         }
+    }
+    
+    canvasFirstLine = first;
+    canvasRows = rows;
+    canvasValid = true;
+}
+
+void UITextBox::renderCanvasRows(int first, int end) {
+    if (end <= first) return;
+    
+    canvas->setTextSize(fontSize);
+    canvas->setTextColor(style().textColor, style().bgColor);
+    canvas->setTextDatum(TL_DATUM);
+    
+    for (int row = first; row < end; row++) {
+        canvas->fillRect(0, row * lineHeight, textAreaWidth(), lineHeight, style().bgColor);
         
-        // Überspringe Zeilenumbruch
-        if (newlinePos != -1) start = newlinePos + 1;
+        int index = scrollY + row;
+        if (index < lineCount) canvas->drawString(lineText(index), 0, row * lineHeight);
     }
 }
 
+void UITextBox::pushCanvasRows(TFT_eSPI* tft, int first, int end) {
+    const uint16_t* pixels = (const uint16_t*)canvas->getPointer();
+    int16_t canvasWidth = textAreaWidth();
+    
+    // Volle Zeilen liegen zusammenhängend im Sprite → ein Transfer
+    pushPixels(tft, x + padding, y + padding + first * lineHeight, canvasWidth, (end - first) * lineHeight,
+               pixels + first * lineHeight * canvasWidth);
+}
+
 int UITextBox::calculateMaxVisibleLines() {
     return (height - 2 * padding) / lineHeight;
 }
 
-int UITextBox::getCharWidth(TFT_eSPI* tft) {
-    return fontSize * 6;  // Approximation
+int UITextBox::getMaxCharsPerLine() const {
+    // Spalte des Scroll-Indikators freihalten
+    int chars = (width - 2 * padding - INDICATOR_WIDTH - 1) / (fontSize * 6);
+    return chars > 0 ? chars : 1;
 }
-
-int UITextBox::getMaxCharsPerLine(TFT_eSPI* tft) {
-    return (width - 2 * padding) / getCharWidth(tft);
-}
\ No newline at end of file
@@ -0,0 +1,282 @@
+/**
+ * UITheme.cpp
+ */
+
+#include "include/UITheme.h"
+#include <string.h>
+
+static_assert(UI_THEME_MAX_STYLES > (int)StyleRole::COUNT, "UI_THEME_MAX_STYLES kleiner als die Anzahl der Rollen");
+static_assert(UI_THEME_MAX_STYLES <= 255, "StyleId ist 8 Bit");
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Themes (Flash)
+// ═══════════════════════════════════════════════════════════════════════════
+
+struct ThemeDef {
+    const char* name;
+    uint16_t disabledColor;     // Rahmen + Text deaktivierter Elemente
+    uint16_t focusColor;        // Rahmen fokussierter Elemente
+    StyleSpec styles[UITheme::ROLE_COUNT];
+};
+
+//   bg, border, text, accent, pressedBg, pressedText, borderWidth, cornerRadius
+static const ThemeDef THEMES[] = {
+    {
+        "dark", COLOR_GRAY, COLOR_CYAN,
+        {
+            {COLOR_DARKGRAY, COLOR_WHITE,  COLOR_WHITE,  COLOR_BLUE,   COLOR_DARKGRAY, COLOR_WHITE,  2, 5},  // ELEMENT
+            {COLOR_BLACK,    COLOR_WHITE,  COLOR_WHITE,  COLOR_BLUE,   COLOR_BLACK,    COLOR_WHITE,  0, 5},  // LABEL
+            {COLOR_BLUE,     COLOR_WHITE,  COLOR_WHITE,  COLOR_BLUE,   COLOR_DARKGRAY, COLOR_WHITE,  2, 5},  // BUTTON
+            {COLOR_BLACK,    COLOR_WHITE,  COLOR_WHITE,  COLOR_BLUE,   COLOR_BLACK,    COLOR_WHITE,  2, 5},  // SLIDER
+            {COLOR_DARKGRAY, COLOR_WHITE,  COLOR_WHITE,  COLOR_GREEN,  COLOR_DARKGRAY, COLOR_WHITE,  2, 5},  // PROGRESS_BAR
+            {COLOR_BLACK,    COLOR_WHITE,  COLOR_WHITE,  COLOR_GREEN,  COLOR_BLACK,    COLOR_WHITE,  2, 3},  // CHECKBOX
+            {COLOR_BLACK,    COLOR_WHITE,  COLOR_WHITE,  COLOR_BLUE,   COLOR_BLACK,    COLOR_WHITE,  2, 5},  // RADIO_BUTTON
+            {COLOR_BLACK,    COLOR_WHITE,  COLOR_WHITE,  COLOR_BLUE,   COLOR_BLACK,    COLOR_WHITE,  2, 5},  // TEXTBOX
+            {COLOR_BLACK,    COLOR_WHITE,  COLOR_WHITE,  COLOR_BLUE,   COLOR_BLACK,    COLOR_WHITE,  2, 5},  // JOYSTICK
+            {COLOR_BLACK,    COLOR_WHITE,  COLOR_WHITE,  COLOR_BLUE,   COLOR_BLACK,    COLOR_WHITE,  2, 5},  // CONTAINER
+            {COLOR_BLUE,     COLOR_WHITE,  COLOR_WHITE,  COLOR_BLUE,   COLOR_DARKGRAY, COLOR_WHITE,  2, 5},  // HEADER_BUTTON
+            {COLOR_DARKGRAY, COLOR_WHITE,  COLOR_WHITE,  COLOR_BLUE,   COLOR_DARKGRAY, COLOR_WHITE,  0, 0},  // HEADER_TITLE
+            {COLOR_PURPLE,   COLOR_WHITE,  COLOR_WHITE,  COLOR_BLUE,   COLOR_DARKGRAY, COLOR_WHITE,  2, 5},  // SLEEP_BUTTON
+            {COLOR_GREEN,    COLOR_WHITE,  COLOR_WHITE,  COLOR_BLUE,   COLOR_GREEN,    COLOR_WHITE,  2, 3},  // BATTERY
+            {COLOR_DARKGRAY, COLOR_WHITE,  COLOR_WHITE,  COLOR_BLUE,   COLOR_DARKGRAY, COLOR_WHITE,  0, 0},  // FOOTER
+        }
+    },
+    {
+        "contrast", COLOR_GRAY, COLOR_CYAN,
+        {
+            {COLOR_BLACK,    COLOR_WHITE,  COLOR_WHITE,  COLOR_YELLOW, COLOR_WHITE,    COLOR_BLACK,  2, 5},  // ELEMENT
+            {COLOR_BLACK,    COLOR_WHITE,  COLOR_WHITE,  COLOR_YELLOW, COLOR_BLACK,    COLOR_WHITE,  0, 5},  // LABEL
+            {COLOR_BLACK,    COLOR_YELLOW, COLOR_YELLOW, COLOR_YELLOW, COLOR_YELLOW,   COLOR_BLACK,  2, 5},  // BUTTON
+            {COLOR_BLACK,    COLOR_WHITE,  COLOR_WHITE,  COLOR_YELLOW, COLOR_BLACK,    COLOR_WHITE,  2, 5},  // SLIDER
+            {COLOR_BLACK,    COLOR_WHITE,  COLOR_WHITE,  COLOR_GREEN,  COLOR_BLACK,    COLOR_WHITE,  2, 5},  // PROGRESS_BAR
+            {COLOR_BLACK,    COLOR_WHITE,  COLOR_WHITE,  COLOR_YELLOW, COLOR_BLACK,    COLOR_WHITE,  2, 3},  // CHECKBOX
+            {COLOR_BLACK,    COLOR_WHITE,  COLOR_WHITE,  COLOR_YELLOW, COLOR_BLACK,    COLOR_WHITE,  2, 5},  // RADIO_BUTTON
+            {COLOR_BLACK,    COLOR_WHITE,  COLOR_WHITE,  COLOR_YELLOW, COLOR_BLACK,    COLOR_WHITE,  2, 5},  // TEXTBOX
+            {COLOR_BLACK,    COLOR_WHITE,  COLOR_WHITE,  COLOR_YELLOW, COLOR_BLACK,    COLOR_WHITE,  2, 5},  // JOYSTICK
+            {COLOR_BLACK,    COLOR_WHITE,  COLOR_WHITE,  COLOR_YELLOW, COLOR_BLACK,    COLOR_WHITE,  2, 5},  // CONTAINER
+            {COLOR_BLACK,    COLOR_YELLOW, COLOR_YELLOW, COLOR_YELLOW, COLOR_YELLOW,   COLOR_BLACK,  2, 5},  // HEADER_BUTTON
+            {COLOR_DARKGRAY, COLOR_WHITE,  COLOR_YELLOW, COLOR_YELLOW, COLOR_DARKGRAY, COLOR_YELLOW, 0, 0},  // HEADER_TITLE
+            {COLOR_BLACK,    COLOR_YELLOW, COLOR_YELLOW, COLOR_YELLOW, COLOR_YELLOW,   COLOR_BLACK,  2, 5},  // SLEEP_BUTTON
+            {COLOR_GREEN,    COLOR_WHITE,  COLOR_WHITE,  COLOR_YELLOW, COLOR_GREEN,    COLOR_WHITE,  2, 3},  // BATTERY
+            {COLOR_DARKGRAY, COLOR_WHITE,  COLOR_WHITE,  COLOR_YELLOW, COLOR_DARKGRAY, COLOR_WHITE,  0, 0},  // FOOTER
+        }
+    },
+};
+
+static_assert(sizeof(THEMES) / sizeof(THEMES[0]) == (size_t)ThemeId::COUNT, "Theme-Tabelle unvollständig");
+
+UITheme::Record UITheme::records[UI_THEME_MAX_STYLES];
+uint8_t UITheme::changed[(UI_THEME_MAX_STYLES + 7) / 8];
+ThemeId UITheme::current = static_cast<ThemeId>(UI_THEME_DEFAULT);
+bool UITheme::ready = false;
+uint32_t UITheme::tableFull = 0;
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Tabelle
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UITheme::init() {
+    if ((uint8_t)current >= (uint8_t)ThemeId::COUNT) current = ThemeId::DARK;
+
+    for (uint8_t i = 0; i < UI_THEME_MAX_STYLES; i++) {
+        records[i].mask = 0;
+        records[i].refs = 0;
+        records[i].role = (i < ROLE_COUNT) ? static_cast<StyleRole>(i) : StyleRole::ELEMENT;
+        if (i < ROLE_COUNT) compute(records[i]);
+    }
+    memset(changed, 0, sizeof(changed));
+    ready = true;
+}
+
+void UITheme::compute(Record& record) {
+    const ThemeDef& theme = THEMES[static_cast<uint8_t>(current)];
+    StyleSpec spec = theme.styles[static_cast<uint8_t>(record.role)];
+    const StyleSpec& o = record.overrides;
+
+    // Abweichungen über den Theme-Wert legen
+    if (record.mask & STYLE_BG) spec.bgColor = o.bgColor;
+    if (record.mask & STYLE_BORDER) spec.borderColor = o.borderColor;
+    if (record.mask & STYLE_TEXT) spec.textColor = o.textColor;
+    if (record.mask & STYLE_ACCENT) spec.accentColor = o.accentColor;
+    if (record.mask & STYLE_PRESSED_BG) spec.pressedBgColor = o.pressedBgColor;
+    if (record.mask & STYLE_PRESSED_TEXT) spec.pressedTextColor = o.pressedTextColor;
+    if (record.mask & STYLE_BORDER_WIDTH) spec.borderWidth = o.borderWidth;
+    if (record.mask & STYLE_CORNER_RADIUS) spec.cornerRadius = o.cornerRadius;
+
+    ElementStyle& normal = record.states[static_cast<uint8_t>(StyleState::NORMAL)];
+    normal.bgColor = spec.bgColor;
+    normal.borderColor = spec.borderColor;
+    normal.textColor = spec.textColor;
+    normal.accentColor = spec.accentColor;
+    normal.borderWidth = spec.borderWidth;
+    normal.cornerRadius = spec.cornerRadius;
+
+    ElementStyle& pressed = record.states[static_cast<uint8_t>(StyleState::PRESSED)];
+    pressed = normal;
+    pressed.bgColor = spec.pressedBgColor;
+    pressed.textColor = spec.pressedTextColor;
+
+    ElementStyle& disabled = record.states[static_cast<uint8_t>(StyleState::DISABLED)];
+    disabled = normal;
+    disabled.borderColor = theme.disabledColor;
+    disabled.textColor = theme.disabledColor;
+
+    ElementStyle& focused = record.states[static_cast<uint8_t>(StyleState::FOCUSED)];
+    focused = normal;
+    focused.borderColor = theme.focusColor;
+}
+
+StyleId UITheme::acquire(StyleRole role, uint8_t mask, const StyleSpec& values) {
+    if (!ready) init();
+    if (mask == 0) return forRole(role);
+
+    // Gleicher Eintrag vorhanden? (nur die abweichenden Felder vergleichen)
+    StyleId freeSlot = 0;
+    for (uint8_t i = ROLE_COUNT; i < UI_THEME_MAX_STYLES; i++) {
+        Record& record = records[i];
+        if (record.refs == 0) {
+            if (freeSlot == 0) freeSlot = i;
+            continue;
+        }
+        if (record.role != role || record.mask != mask) continue;
+
+        const StyleSpec& o = record.overrides;
+        if ((mask & STYLE_BG) && o.bgColor != values.bgColor) continue;
+        if ((mask & STYLE_BORDER) && o.borderColor != values.borderColor) continue;
+        if ((mask & STYLE_TEXT) && o.textColor != values.textColor) continue;
+        if ((mask & STYLE_ACCENT) && o.accentColor != values.accentColor) continue;
+        if ((mask & STYLE_PRESSED_BG) && o.pressedBgColor != values.pressedBgColor) continue;
+        if ((mask & STYLE_PRESSED_TEXT) && o.pressedTextColor != values.pressedTextColor) continue;
+        if ((mask & STYLE_BORDER_WIDTH) && o.borderWidth != values.borderWidth) continue;
+        if ((mask & STYLE_CORNER_RADIUS) && o.cornerRadius != values.cornerRadius) continue;
+
+        record.refs++;
+        return i;
+    }
+
+    if (freeSlot == 0) {
+        // Tabelle voll: Rollen-Style statt Abweichung (falsche Farbe, aber kein Absturz)
+        if (tableFull++ == 0) {
+            Serial.printf("UITheme: ⚠️ Style-Tabelle voll (UI_THEME_MAX_STYLES = %d)\n", UI_THEME_MAX_STYLES);
+        }
+        return forRole(role);
+    }
+
+    Record& record = records[freeSlot];
+    record.role = role;
+    record.mask = mask;
+    record.overrides = values;
+    record.refs = 1;
+    compute(record);
+    return freeSlot;
+}
+
+void UITheme::release(StyleId id) {
+    if (id < ROLE_COUNT || id >= UI_THEME_MAX_STYLES) return;
+    if (records[id].refs > 0) records[id].refs--;
+}
+
+StyleId UITheme::setField(StyleId id, StyleField field, uint16_t value) {
+    if (!ready) init();
+
+    const Record& base = records[id];
+    StyleSpec values = base.overrides;
+    uint8_t mask = base.mask | field;
+
+    switch (field) {
+        case STYLE_BG:            values.bgColor = value; break;
+        case STYLE_BORDER:        values.borderColor = value; break;
+        case STYLE_TEXT:          values.textColor = value; break;
+        case STYLE_ACCENT:        values.accentColor = value; break;
+        case STYLE_PRESSED_BG:    values.pressedBgColor = value; break;
+        case STYLE_PRESSED_TEXT:  values.pressedTextColor = value; break;
+        case STYLE_BORDER_WIDTH:  values.borderWidth = value; break;
+        case STYLE_CORNER_RADIUS: values.cornerRadius = value; break;
+    }
+
+    // Erst den neuen Eintrag holen, dann den alten freigeben (sonst würde ein
+    // gerade frei gewordener Eintrag mit anderen Werten überschrieben)
+    StyleId next = acquire(base.role, mask, values);
+    release(id);
+    return next;
+}
+
+StyleId UITheme::setAll(StyleId id, const ElementStyle& style) {
+    if (!ready) init();
+
+    StyleSpec values = {};
+    values.bgColor = style.bgColor;
+    values.borderColor = style.borderColor;
+    values.textColor = style.textColor;
+    values.borderWidth = style.borderWidth;
+    values.cornerRadius = style.cornerRadius;
+
+    StyleId next = acquire(records[id].role, STYLE_BG | STYLE_BORDER | STYLE_TEXT |
+                           STYLE_BORDER_WIDTH | STYLE_CORNER_RADIUS, values);
+    release(id);
+    return next;
+}
+
+StyleId UITheme::setRole(StyleId id, StyleRole role) {
+    release(id);
+    return forRole(role);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Theme-Wechsel
+// ═══════════════════════════════════════════════════════════════════════════
+
+uint8_t UITheme::setTheme(ThemeId theme) {
+    if ((uint8_t)theme >= (uint8_t)ThemeId::COUNT) return 0;
+    if (!ready) init();
+
+    memset(changed, 0, sizeof(changed));
+    if (theme == current) return 0;
+    current = theme;
+
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < UI_THEME_MAX_STYLES; i++) {
+        Record& record = records[i];
+        if (i >= ROLE_COUNT && record.refs == 0) continue;
+
+        ElementStyle before[STATE_COUNT];
+        memcpy(before, record.states, sizeof(before));
+        compute(record);
+
+        if (memcmp(before, record.states, sizeof(before)) != 0) {
+            changed[i >> 3] |= 1 << (i & 7);
+            count++;
+        }
+    }
+    return count;
+}
+
+const char* UITheme::getThemeName(ThemeId theme) {
+    if ((uint8_t)theme >= (uint8_t)ThemeId::COUNT) return "?";
+    return THEMES[static_cast<uint8_t>(theme)].name;
+}
+
+void UITheme::printStats() {
+    if (!ready) init();
+
+    uint8_t used = 0;
+    uint32_t refs = 0;
+    for (uint8_t i = ROLE_COUNT; i < UI_THEME_MAX_STYLES; i++) {
+        if (records[i].refs == 0) continue;
+        used++;
+        refs += records[i].refs;
+    }
+
+    Serial.println("\n=== Theme ===");
+    Serial.printf("Aktiv:       %s\n", getThemeName(current));
+    Serial.printf("Tabelle:     %d Rollen + %u/%d Abweichungen (%lu Elemente), %u Byte pro Eintrag, %u Byte gesamt\n",
+                  ROLE_COUNT, used, UI_THEME_MAX_STYLES - ROLE_COUNT, (unsigned long)refs,
+                  (unsigned)sizeof(Record), (unsigned)sizeof(records));
+    // Vorher: ElementStyle ohne accentColor (3 Farben + Rahmen + Radius) in jedem Element
+    Serial.printf("Pro Element: %u Byte Index (vorher: 8 Byte ElementStyle-Kopie)\n",
+                  (unsigned)sizeof(StyleId));
+    if (tableFull > 0) {
+        Serial.printf("⚠️ %lu Abweichungen abgewiesen (Tabelle voll)\n", (unsigned long)tableFull);
+    }
+    Serial.println("=============\n");
+}
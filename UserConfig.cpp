@@ -136,6 +136,9 @@ void UserConfig::printInfo() const {
     DEBUG_PRINTF("  touchMaxY: %d\n", config.touchMaxY);
     DEBUG_PRINTF("  touchThreshold: %d\n", config.touchThreshold);
     DEBUG_PRINTF("  touchRotation: %d\n", config.touchRotation);
+    DEBUG_PRINTF("  touchCalAffine: %s\n", config.touchCalAffine ? "true" : "false");
+    DEBUG_PRINTF("  touchCal A-C: %ld, %ld, %ld\n", (long)config.touchCalA, (long)config.touchCalB, (long)config.touchCalC);
+    DEBUG_PRINTF("  touchCal D-F: %ld, %ld, %ld\n", (long)config.touchCalD, (long)config.touchCalE, (long)config.touchCalF);
     
     // ESP-NOW
     DEBUG_PRINTLN("[ESP-NOW]");
@@ -201,6 +204,31 @@ void UserConfig::setTouchRotation(uint8_t value) {
     setDirty(true);
 }
 
+void UserConfig::getTouchAffine(int32_t coeffs[6]) const {
+    coeffs[0] = config.touchCalA;
+    coeffs[1] = config.touchCalB;
+    coeffs[2] = config.touchCalC;
+    coeffs[3] = config.touchCalD;
+    coeffs[4] = config.touchCalE;
+    coeffs[5] = config.touchCalF;
+}
+
+void UserConfig::setTouchAffine(const int32_t coeffs[6]) {
+    config.touchCalA = coeffs[0];
+    config.touchCalB = coeffs[1];
+    config.touchCalC = coeffs[2];
+    config.touchCalD = coeffs[3];
+    config.touchCalE = coeffs[4];
+    config.touchCalF = coeffs[5];
+    config.touchCalAffine = true;
+    setDirty(true);
+}
+
+void UserConfig::clearTouchAffine() {
+    config.touchCalAffine = false;
+    setDirty(true);
+}
+
 void UserConfig::setEspnowChannel(uint8_t value) {
     config.espnowChannel = value;
     setDirty(true);
@@ -361,6 +389,83 @@ ConfigScheme UserConfig::buildScheme() {
             .maxValue = 3,
             .maxLength = 0
         },
+        {
+            .key = "touchCalA",
+            .category = "Touch",
+            .type = ConfigType::INT32,
+            .valuePtr = &config.touchCalA,
+            .defaultPtr = &defaults.touchCalA,
+            .hasRange = false,
+            .minValue = 0,
+            .maxValue = 0,
+            .maxLength = 0
+        },
+        {
+            .key = "touchCalB",
+            .category = "Touch",
+            .type = ConfigType::INT32,
+            .valuePtr = &config.touchCalB,
+            .defaultPtr = &defaults.touchCalB,
+            .hasRange = false,
+            .minValue = 0,
+            .maxValue = 0,
+            .maxLength = 0
+        },
+        {
+            .key = "touchCalC",
+            .category = "Touch",
+            .type = ConfigType::INT32,
+            .valuePtr = &config.touchCalC,
+            .defaultPtr = &defaults.touchCalC,
+            .hasRange = false,
+            .minValue = 0,
+            .maxValue = 0,
+            .maxLength = 0
+        },
+        {
+            .key = "touchCalD",
+            .category = "Touch",
+            .type = ConfigType::INT32,
+            .valuePtr = &config.touchCalD,
+            .defaultPtr = &defaults.touchCalD,
+            .hasRange = false,
+            .minValue = 0,
+            .maxValue = 0,
+            .maxLength = 0
+        },
+        {
+            .key = "touchCalE",
+            .category = "Touch",
+            .type = ConfigType::INT32,
+            .valuePtr = &config.touchCalE,
+            .defaultPtr = &defaults.touchCalE,
+            .hasRange = false,
+            .minValue = 0,
+            .maxValue = 0,
+            .maxLength = 0
+        },
+        {
+            .key = "touchCalF",
+            .category = "Touch",
+            .type = ConfigType::INT32,
+            .valuePtr = &config.touchCalF,
+            .defaultPtr = &defaults.touchCalF,
+            .hasRange = false,
+            .minValue = 0,
+            .maxValue = 0,
+            .maxLength = 0
+        },
+        {
+            .key = "touchCalAffine",
+            .category = "Touch",
+            .type = ConfigType::BOOL,
+            .valuePtr = &config.touchCalAffine,
+            .defaultPtr = &defaults.touchCalAffine,
+            .hasRange = true,
+            .minValue = 0,
+            .maxValue = 1,
+            .maxLength = 0
+        },
         
         // ESP-NOW
         {
@@ -579,6 +684,13 @@ void UserConfig::initDefaults() {
     defaults.touchMaxY = TOUCH_MAX_Y;
     defaults.touchThreshold = TOUCH_THRESHOLD;
     defaults.touchRotation = TOUCH_ROTATION;
+    defaults.touchCalA = 0;
+    defaults.touchCalB = 0;
+    defaults.touchCalC = 0;
+    defaults.touchCalD = 0;
+    defaults.touchCalE = 0;
+    defaults.touchCalF = 0;
+    defaults.touchCalAffine = false;
     
     // ESP-NOW
     defaults.espnowChannel = ESPNOW_CHANNEL;
@@ -6,10 +6,18 @@
  * NUR HARDWARE-VERWALTUNG:
  * - Display-Initialisierung
  * - Backlight-Steuerung (PWM)
- * - Touch CS deaktivieren
+ * - Chip-Selects verwaltet der SpiBusArbiter
  * - Rotation
+ * - Hardware-Scrolling (ST7796 VSCRDEF/VSCRSADD)
  * 
  * KEIN UI-SYSTEM mehr! (PageManager verwaltet UI)
+ * 
+ * Hardware-Scrolling: der Controller liest einen Streifen des Bildspeichers
+ * ab einem Offset aus (Ringpuffer) - der Inhalt verschiebt sich ohne dass
+ * Pixel übertragen werden, nur die neu sichtbaren Zeilen werden gezeichnet.
+ * Der Streifen liegt immer auf der Gate-Achse des Panels (480 Zeilen) und
+ * reicht über die volle Breite der anderen Achse. Im Querformat (Rotation
+ * 1/3) ist das die X-Achse des Screens → getScrollAxis().
  */
 
 #ifndef DISPLAY_HANDLER_H
@@ -21,6 +29,12 @@
 
 class UserConfig;
 
+// Screen-Achse auf der das Panel hardwareseitig scrollt
+enum class ScrollAxis : uint8_t {
+    VERTICAL,       // Hochformat (Rotation 0/2): Streifen = Zeilen
+    HORIZONTAL      // Querformat (Rotation 1/3): Streifen = Spalten
+};
+
 class DisplayHandler {
 public:
     /**
@@ -58,6 +72,65 @@ public:
      */
     void setBacklightOn(bool on);
 
+    /**
+     * Eingestellte Helligkeit (setBacklight())
+     */
+    uint8_t getBacklight() const { return currentBrightness; }
+
+    /**
+     * PWM direkt setzen (ohne BACKLIGHT_MIN, eingestellte Helligkeit bleibt)
+     * Für Überblendungen, z.B. Fade-Out vor dem Sleep
+     * @param level 0-255
+     */
+    void setBacklightLevel(uint8_t level);
+
+    /**
+     * Scroll-Achse der aktuellen Rotation
+     */
+    ScrollAxis getScrollAxis() const { return scrollAxis; }
+    
+    /**
+     * Länge der Scroll-Achse in Pixeln (Gate-Zeilen des Panels)
+     */
+    int16_t getScrollAxisLength();
+
+    /**
+     * Scroll-Bereich festlegen (Offset wird auf 0 gesetzt)
+     * Außerhalb des Bereichs bleibt die Anzeige fest (z.B. Header/Footer
+     * im Hochformat)
+     * @param start Erste Screen-Position auf der Scroll-Achse
+     * @param length Länge des Bereichs
+     * @return false bei ungültigem Bereich
+     */
+    bool setScrollArea(int16_t start, int16_t length);
+
+    /**
+     * Inhalt im Scroll-Bereich verschieben
+     * Screen-Position start + i zeigt danach die Pixel die an
+     * start + (i + offset) % length gezeichnet wurden
+     * @param offset Verschiebung in Pixeln (wird modulo length genommen)
+     */
+    void setScrollOffset(int16_t offset);
+    int16_t getScrollOffset() const { return scrollOffset; }
+
+    /**
+     * Screen-Position → Zeichen-Position im Bildspeicher
+     * Zum Zeichnen neu sichtbarer Zeilen/Spalten bei gesetztem Offset
+     */
+    int16_t mapScrollPosition(int16_t screenPos) const;
+
+    /**
+     * Scrolling beenden (ganzer Bildspeicher ohne Offset)
+     * Ab hier zeigt das Display den Bildspeicher 1:1
+     */
+    void resetScroll();
+    bool isScrollActive() const { return scrollLength > 0; }
+
+    /**
+     * Anzahl Offset-Befehle seit Start (Statistik)
+     */
+    uint32_t getScrollSteps() const { return scrollSteps; }
+
     /**
      * Text zeichnen (Basis-Funktion)
      * @param text Text
@@ -123,10 +196,23 @@ private:
     bool initialized;          // Initialisierungs-Flag
     uint8_t currentBrightness; // Aktuelle Helligkeit
     
+    // Hardware-Scrolling (Screen-Koordinaten auf der Scroll-Achse)
+    ScrollAxis scrollAxis;     // Aus der Rotation
+    bool scrollReversed;       // Screen-Richtung entgegen der Gate-Reihenfolge (Rotation 2/3)
+    int16_t scrollStart;
+    int16_t scrollLength;      // 0 = kein Scroll-Bereich
+    int16_t scrollOffset;
+    uint32_t scrollSteps;
+    
+    /**
+     * VSCRDEF senden (Bereich in Gate-Zeilen)
+     */
+    void writeScrollArea(uint16_t top, uint16_t length, uint16_t bottom);
+    
     /**
-     * Touch CS inaktiv setzen (wichtig!)
+     * VSCRSADD senden (erste angezeigte Zeile des Bereichs)
      */
-    void disableTouch();
+    void writeScrollStart(uint16_t line);
     
     /**
      * Backlight initialisieren
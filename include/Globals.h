@@ -20,6 +20,9 @@ class TouchManager;
 class UserConfig;
 class PowerManager;
 class ESPNowRemoteController;
+class SpiBusArbiter;
+class UIFont;
+class ScreenCapture;
 
 // Globale Objekte (extern)
 extern DisplayHandler display;
@@ -31,6 +34,9 @@ extern TouchManager touch;
 extern UserConfig userConfig;
 extern PowerManager powerMgr;
 extern ESPNowRemoteController espNow;
+extern SpiBusArbiter spiBus;
+extern UIFont uiFont;          // Atlas-Font (UI_FONT_FILE), optional
+extern ScreenCapture screenCapture;
 
 // PageManager als Pointer (wird in setup() erstellt)
 extern PageManager* pageManager;
@@ -20,6 +20,32 @@
 #include "UIManager.h"
 #include "BatteryMonitor.h"
 #include "PowerManager.h"
+#include "SpiBusArbiter.h"
+
+class SDCardHandler;
+class UIFrameBuffer;
+class DisplayHandler;
+
+// Frame-Statistik: wie lange draw() den Main-Loop blockiert
+struct PageFrameStats {
+    uint32_t frames;            // Frames mit Damage
+    uint32_t lastBlockUs;       // Blockierzeit von draw() im letzten Frame
+    uint32_t maxBlockUs;        // Maximum
+    uint64_t totalBlockUs;      // Summe seit resetFrameStats()
+    uint32_t lastFlushUs;       // Render-Start bis letzter Transfer fertig (ohne Frame-Takt/Animator)
+    uint32_t busyPolls;         // draw() ohne Zeichnen (Transfer lief noch)
+    uint32_t missedFrames;      // Frame-Slots ohne Zeichnen (loop() zu spät / Transfer lief)
+    uint32_t deferredFrames;    // Frames mit erschöpftem Budget (Rest-Damage verschoben)
+};
+
+// Page-Slide-Statistik (Hardware-Scrolling)
+struct PageSlideStats {
+    uint32_t slides;            // Slides seit Start (inkl. abgebrochener)
+    uint32_t aborted;           // Durch neuen Seitenwechsel abgebrochen
+    uint32_t lastMs;            // Dauer des letzten Slides
+    uint16_t lastSteps;         // Scroll-Schritte (Frames) im letzten Slide
+    uint32_t lastPixels;        // Gepushte Pixel im letzten Slide
+};
 
 class PageManager {
 public:
@@ -64,8 +90,10 @@ public:
      * Zu Seite wechseln (verzögert)
      * Sicherer Aufruf während ui->update()
      * @param pageId Seiten-ID
+     * @param slide Übergang: 1 = neue Seite kommt von rechts (Hochformat: unten),
+     *              -1 = von links (oben), 0 = sofort
      */
-    void showPageDeferred(int pageId);
+    void showPageDeferred(int pageId, int8_t slide = 0);
 
     /**
      * Zu Seite wechseln (nach Index)
@@ -74,6 +102,14 @@ public:
      */
     bool showPageByIndex(int index);
 
+    /**
+     * Ganzen Screen neu aufbauen, nachdem direkt darüber gezeichnet wurde
+     * (Kalibrierung, fillScreen). showPage() allein reicht nicht: Header/Footer
+     * bleiben beim Seitenwechsel stehen und zeichnen nur geänderte Felder
+     * @return true bei Erfolg
+     */
+    bool redrawScreen();
+
     /**
      * Nächste Seite anzeigen
      */
@@ -120,18 +156,120 @@ public:
     /**
      * Alles zeichnen: Layout (Header/Footer) + aktive Page Content
      * In loop() aufrufen!
+     * 
+     * Asynchroner Flush (Sprite-Rendering + DMA): draw() kehrt zurück während
+     * der letzte Tile-Transfer läuft, der Display-Bus bleibt so lange belegt.
+     * Der nächste draw()-Aufruf prüft die Fertigmeldung und gibt den Bus frei.
+     * 
+     * Frame-Scheduler: gezeichnet wird nur im Takt der Ziel-FPS, höchstens
+     * für das Frame-Budget - übrige Damage-Bereiche folgen im nächsten Frame.
      */
     void draw();
+    
+    /**
+     * Ziel-Framerate setzen
+     * @param fps Frames pro Sekunde (0 = in jedem draw()-Aufruf zeichnen)
+     */
+    void setTargetFps(uint8_t fps);
+    uint8_t getTargetFps() const { return targetFps; }
+    
+    /**
+     * Max. Renderzeit pro Frame
+     * @param us Mikrosekunden (0 = unbegrenzt)
+     */
+    void setFrameBudget(uint32_t us) { frameBudgetUs = us; }
+    uint32_t getFrameBudget() const { return frameBudgetUs; }
+
+    /**
+     * Laufenden Flush abwarten und Bus freigeben
+     * Vor direktem Zeichnen außerhalb von update()/draw() aufrufen
+     */
+    void waitFlush() { completeFlush(true); }
+    bool isFlushPending() const { return flushPending; }
+
+    // Frame-Statistik (Blockierzeit pro Frame)
+    const PageFrameStats& getFrameStats() const { return frameStats; }
+    void resetFrameStats();
+    void printFrameStats();
+
+    /**
+     * Page-Cache: max. Anzahl gebauter Pages (inkl. aktueller)
+     * Überzählige werden entladen, am längsten nicht angezeigte zuerst
+     * @param size Anzahl (0 = alle behalten)
+     */
+    void setPageCacheSize(uint8_t size);
+    uint8_t getPageCacheSize() const { return pageCacheSize; }
+    
+    /**
+     * Seite entladen (nicht die aktuelle)
+     * @return false wenn aktuell angezeigt oder nicht gefunden
+     */
+    bool unloadPage(int pageId);
+    
+    // Pages mit Aufbau-/Abbau-Zeiten, Arena und Cache-Status ausgeben
+    void printPageStats();
+    
+    /**
+     * Render-Benchmark: jede Page als Vollbild in einen Offscreen-Framebuffer,
+     * danach frames Update-Frames im Frame-Takt. Gibt Primitiv-Aufrufe,
+     * geschriebene Pixel und Überzeichnung aus. Das Display wird danach neu aufgebaut.
+     */
+    void benchmarkRender(uint16_t frames = UI_RENDER_BENCH_FRAMES);
+    
+    /**
+     * Golden-Image-Test: jede Page als Vollbild rendern und mit dem
+     * Referenzbild UI_GOLDEN_DIR/page_<id>.raw vergleichen
+     * @param save true = Referenzbilder schreiben statt vergleichen
+     * @return Anzahl abweichender/fehlender Pages, -1 bei Fehler
+     */
+    int runGoldenTest(SDCardHandler* sd, bool save);
 
     /**
      * UILayout abrufen (für direkten Zugriff)
      */
     UILayout* getLayout() { return &layout; }
 
+    /**
+     * UIManager abrufen (für Diagnose-Befehle)
+     */
+    UIManager* getUIManager() { return ui; }
+
+    /**
+     * HSPI-Arbiter setzen
+     * Zeichnen (Page-Wechsel, Page-Update, drawUpdates) läuft dann als
+     * ein Display-Burst - Touch-Reads erfolgen nur dazwischen
+     * @param arbiter Arbiter oder nullptr
+     */
+    void setBusArbiter(SpiBusArbiter* arbiter) { busArbiter = arbiter; }
+    
+    /**
+     * DisplayHandler für Page-Slides (Hardware-Scrolling) setzen
+     * Ohne Handler wechseln Seiten immer sofort
+     */
+    void setDisplayHandler(DisplayHandler* handler) { displayHandler = handler; }
+    
+    /**
+     * Page-Slide bei Swipe-Navigation ein-/ausschalten
+     * 
+     * Der Panel-Controller verschiebt den ganzen Bildspeicher (VSCRSADD),
+     * pro Frame wird nur der neu aufgedeckte Streifen der neuen Page
+     * gezeichnet - an ihrer endgültigen Position. Nach einer vollen
+     * Achsenlänge steht die neue Page ohne Offset im Bildspeicher.
+     * Gleitet auf der Scroll-Achse des Panels (Querformat: horizontal).
+     */
+    void setPageSlide(bool enable);
+    bool isPageSlide() const { return slideEnabled; }
+    bool isSliding() const { return slide.active; }
+    
+    // Slide-Statistik (Pixel gegenüber Vollbild pro Schritt)
+    const PageSlideStats& getSlideStats() const { return slideStats; }
+    void printSlideStats();
+
 private:
     struct PageEntry {
         UIPage* page;
         int pageId;
+        uint32_t lastUsed;          // LRU-Zeitstempel (useCounter beim Anzeigen)
     };
     
     TFT_eSPI* tft;                  // Display
@@ -143,14 +281,95 @@ private:
     int currentPageIndex;           // Aktueller Seiten-Index
     
     bool initialized;               // Initialisierungs-Flag
+    SpiBusArbiter* busArbiter;      // HSPI-Arbiter (optional)
     
     // Deferred page change (verhindert Crash während ui->update())
     int deferredPageId;             // -1 = kein Wechsel ausstehend
+    int8_t deferredSlide;           // Übergang des ausstehenden Wechsels (0 = sofort)
+    
+    // Page-Slide (Hardware-Scrolling)
+    struct SlideState {
+        bool active;
+        int8_t direction;           // 1: neue Page von rechts/unten, -1: von links/oben
+        int16_t axisLength;         // Länge der Scroll-Achse
+        int16_t exposed;            // Bereits gezeichnete Pixel der neuen Page auf der Achse
+        float progress;             // 0..1 (Tween)
+        TweenId tween;
+        uint32_t startMs;
+        uint16_t steps;
+        uint32_t pixels;
+    };
+    DisplayHandler* displayHandler; // Hardware-Scrolling (optional)
+    bool slideEnabled;
+    SlideState slide;
+    PageSlideStats slideStats;
+    
+    // LRU-Cache gebauter Pages
+    uint8_t pageCacheSize;          // 0 = unbegrenzt
+    uint32_t useCounter;            // Zählt Seitenwechsel (LRU-Zeitstempel)
+    uint32_t evictions;             // Entladene Pages seit Start
+    
+    // Asynchroner Flush
+    bool flushPending;              // Letzter Tile-Transfer läuft noch
+    bool flushLocked;               // Display-Bus für den Transfer belegt
+    uint32_t flushStartUs;          // micros() beim Start von drawUpdates()
+    PageFrameStats frameStats;
+    
+    // Frame-Scheduler
+    uint8_t targetFps;              // 0 = ungebremst
+    uint32_t frameIntervalUs;       // 1 s / targetFps
+    uint32_t frameBudgetUs;         // Max. Renderzeit pro Frame (0 = unbegrenzt)
+    uint32_t nextFrameUs;           // micros() des nächsten Frame-Slots
+    
+    /**
+     * Flush abschließen (Bus freigeben)
+     * @param wait true = auf Transfer warten, false = nur prüfen
+     * @return true wenn kein Transfer mehr läuft
+     */
+    bool completeFlush(bool wait);
+    
+    /**
+     * Überzählige gebaute Pages entladen (LRU)
+     */
+    void evictPages();
+    
+    /**
+     * Vollbild ins Offscreen-Ziel (UIManager muss umgeleitet sein)
+     * @return Renderzeit in us
+     */
+    uint32_t renderOffscreen(UIFrameBuffer* frameBuffer);
     
     /**
      * Seiten-Index nach ID finden
      */
     int findPageIndex(int pageId);
+    
+    /**
+     * Swipe-Geste → nächste/vorherige Seite (verzögert)
+     */
+    void handleSwipe(SwipeDirection direction);
+    
+    /**
+     * Slide starten (Seite wird sofort gewechselt, gezeichnet wird streifenweise)
+     * @return false wenn nicht möglich → Aufrufer wechselt ohne Slide
+     */
+    bool startSlide(int pageId, int8_t direction);
+    
+    /**
+     * Nächsten Streifen zeichnen und Offset setzen (im Frame-Takt aus draw())
+     */
+    void stepSlide();
+    
+    /**
+     * Slide beenden: Scrolling zurücksetzen, bei Abbruch Rest neu zeichnen
+     */
+    void finishSlide();
+    
+    /**
+     * Bereich [from, to) der neuen Page auf der Scroll-Achse als Rechteck
+     * (von der Einlaufseite aus gezählt, volle Breite der anderen Achse)
+     */
+    void getSlideRect(int16_t from, int16_t to, int16_t* x, int16_t* y, int16_t* w, int16_t* h);
 };
 
 #endif // PAGE_MANAGER_H
\ No newline at end of file
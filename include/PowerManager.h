@@ -6,7 +6,7 @@
  * Features:
  * - Deep-Sleep mit Wake-Up via Touch/Timer
  * - Auto-Sleep bei kritischer Batterie
- * - Backlight Fade-Out
+ * - Backlight Fade-Out (nicht blockierend über UIAnimator, Sleep danach)
  * - Before-Sleep Callback
  * - Wake-Up Reason Detection
  */
@@ -19,6 +19,7 @@
 #include "setupConf.h"
 #include "BatteryMonitor.h"
 #include "DisplayHandler.h"
+#include "UIAnimator.h"
 
 // Wake-Up Quellen
 enum class WakeSource : uint8_t {
@@ -53,11 +54,24 @@ public:
 
     /**
      * Deep-Sleep aktivieren
+     * Mit Animator kehrt sleep() sofort zurück: das Backlight wird im
+     * Frame-Takt ausgeblendet, danach folgt der Deep-Sleep
      * @param wakeSource Wake-Up Quelle
      * @param timerSeconds Timer in Sekunden (nur bei TIMER/TOUCH_AND_TIMER)
      */
     void sleep(WakeSource wakeSource = WakeSource::TOUCH, uint32_t timerSeconds = 0);
 
+    /**
+     * Animator für den Backlight-Fade (z.B. UIManager::getAnimator())
+     * nullptr → Fade blockiert in sleep()
+     */
+    void setAnimator(UIAnimator* anim) { animator = anim; }
+
+    /**
+     * Fade-Out läuft, Deep-Sleep folgt
+     */
+    bool isSleepPending() const { return sleepPending; }
+
     /**
      * Permanent ausschalten (kein Wake-Up)
      */
@@ -117,6 +131,12 @@ private:
     
     BeforeSleepCallback beforeSleepCallback;
     
+    // Nicht blockierender Fade-Out vor dem Sleep
+    UIAnimator* animator;
+    bool sleepPending;
+    WakeSource pendingWakeSource;
+    uint32_t pendingTimerSeconds;
+    
     // Critical Battery Warnung
     bool criticalWarningShown;
     unsigned long criticalWarningStart;
@@ -128,10 +148,15 @@ private:
     void shutdownPeripherals();
     
     /**
-     * Backlight sanft ausblenden
+     * Backlight sanft ausblenden (blockierend, ohne Animator)
      */
     void fadeBacklight();
     
+    /**
+     * Peripherie herunterfahren und Deep-Sleep starten (kehrt nicht zurück)
+     */
+    void enterSleep(WakeSource wakeSource, uint32_t timerSeconds);
+    
     /**
      * Wake-Up Quellen konfigurieren
      */
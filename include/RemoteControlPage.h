@@ -11,6 +11,7 @@
 #include "UIManager.h"
 #include "UILabel.h"
 #include "UIProgressBar.h"
+#include "UIJoystickView.h"
 #include <TFT_eSPI.h>
 
 class RemoteControlPage : public UIPage {
@@ -23,12 +24,13 @@ public:
     void setJoystickPosition(int16_t x, int16_t y);
     
 private:
-    void drawJoystickPosition();
+    static constexpr int16_t JOYSTICK_AREA_SIZE = 180;
     
     int16_t joystickX, joystickY;
-    int16_t joystickAreaX, joystickAreaY, joystickAreaSize;
-    int16_t joystickCenterX, joystickCenterY;
+    int16_t lastJoyX, lastJoyY;     // Zuletzt angezeigt
+    bool wasConnected;
     
+    UIJoystickView* joystickView;
     UILabel* labelConnectionStatus;
     UILabel* labelJoystickX;
     UILabel* labelJoystickY;
@@ -0,0 +1,150 @@
+/**
+ * ScreenCapture.h
+ *
+ * Screenshot / Bildschirm-Spiegelung über die serielle Schnittstelle
+ *
+ * - Liest den Bildspeicher des Displays kachelweise zurück (readRect über
+ *   MISO, HSPI-Arbiter) - erfasst alles was sichtbar ist, auch direkt
+ *   gezeichnete Inhalte
+ * - Kacheln (UI_SCREEN_TILE) werden RLE-komprimiert (RGB565) und als
+ *   Base64-Textzeilen gesendet, Log-Ausgaben dazwischen stören nicht
+ * - Nach dem ersten Vollbild nur geänderte Kacheln (CRC pro Kachel),
+ *   alle UI_SCREEN_KEYFRAME Frames wieder ein Vollbild
+ * - Streaming blockiert loop() nie: höchstens UI_SCREEN_BUDGET_US pro
+ *   update(), gesendet wird nur was in den TX-Puffer passt, Frames
+ *   frühestens alle UI_SCREEN_INTERVAL_MS
+ *
+ * Protokoll (eine Zeile pro Nachricht):
+ *   SCR F <frame> <breite> <höhe> <kachel> <voll 0|1>
+ *   SCR T <x> <y> <w> <h> <adler32 hex> <base64(RLE)>
+ *   SCR E <frame> <kacheln> <byte>
+ *
+ * RLE: Kopfbyte h, Bit 7 gesetzt → (h & 0x7F) + 1 Wiederholungen des
+ * folgenden Pixels, sonst h + 1 einzelne Pixel. Pixel als RGB565,
+ * High-Byte zuerst (Display-Reihenfolge).
+ *
+ * Host: tools/screen_capture.py setzt die Kacheln zusammen und schreibt PNGs.
+ */
+
+#ifndef SCREEN_CAPTURE_H
+#define SCREEN_CAPTURE_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "setupConf.h"
+
+class SpiBusArbiter;
+
+// Statistik seit Start
+struct ScreenCaptureStats {
+    uint32_t frames;            // Abgeschlossene Frames (Einzelbild + Stream)
+    uint32_t tilesSent;         // Gesendete Kacheln
+    uint32_t tilesSkipped;      // Unveränderte Kacheln (nicht gesendet)
+    uint64_t rawBytes;          // RGB565-Byte der gesendeten Kacheln
+    uint64_t rleBytes;          // Nach RLE
+    uint64_t lineBytes;         // Gesendet (Base64 + Zeilenkopf)
+    uint32_t lastFrameMs;       // Dauer des letzten Frames (Start bis Ende)
+    uint16_t lastFrameTiles;    // Gesendete Kacheln im letzten Frame
+    uint32_t busyPolls;         // update() ohne Arbeit (Flush/Slide/TX-Puffer voll)
+};
+
+class ScreenCapture {
+public:
+    ScreenCapture();
+    ~ScreenCapture();
+
+    /**
+     * Initialisieren (nach dem Display)
+     * @param tft Display
+     * @param arbiter HSPI-Arbiter (optional)
+     */
+    void begin(TFT_eSPI* tft, SpiBusArbiter* arbiter = nullptr);
+
+    /**
+     * Einzelbild: alle Kacheln, blockierend
+     * Während des Streamings: nächster Stream-Frame wird ein Vollbild
+     * @return false wenn das Display gerade nicht gelesen werden kann
+     */
+    bool captureFrame();
+
+    /**
+     * Streaming starten (erster Frame = Vollbild)
+     * @param intervalMs Frühester Abstand zwischen Frame-Starts
+     */
+    void startStream(uint16_t intervalMs = UI_SCREEN_INTERVAL_MS);
+    void stopStream();
+    bool isStreaming() const { return streaming; }
+
+    /**
+     * In loop() aufrufen (nach dem Zeichnen)
+     * Arbeitet höchstens UI_SCREEN_BUDGET_US, setzt im nächsten Aufruf fort
+     */
+    void update();
+
+    const ScreenCaptureStats& getStats() const { return stats; }
+    void printStats();
+
+private:
+    static const int16_t TILE = UI_SCREEN_TILE;
+    static const int16_t TILES_X = (DISPLAY_WIDTH + TILE - 1) / TILE;
+    static const int16_t TILES_Y = (DISPLAY_HEIGHT + TILE - 1) / TILE;
+    static const uint16_t TILE_COUNT = TILES_X * TILES_Y;
+
+    // Schlechtester Fall: nur Einzelpixel (1 Kopfbyte pro 128 Pixel)
+    static const size_t RLE_CAPACITY = TILE * TILE * 2 + (TILE * TILE + 127) / 128;
+    static const size_t LINE_CAPACITY = 64 + (RLE_CAPACITY + 2) / 3 * 4;
+
+    TFT_eSPI* tft;
+    SpiBusArbiter* arbiter;
+
+    uint16_t pixels[TILE * TILE];       // Gelesene Kachel (Display-Byte-Reihenfolge)
+    uint8_t rle[RLE_CAPACITY];
+    char line[LINE_CAPACITY];           // Ausstehende Zeile
+    uint16_t lineLength;
+    uint16_t lineSent;                  // Davon bereits in den TX-Puffer geschrieben
+
+    uint32_t tileCrc[TILE_COUNT];       // Zuletzt gesendeter Inhalt pro Kachel
+
+    // Streaming
+    bool streaming;
+    uint16_t intervalMs;
+    bool frameActive;                   // Frame begonnen, Kacheln folgen
+    bool frameFull;                     // Alle Kacheln senden (Vollbild)
+    bool forceFull;                     // Nächster Frame als Vollbild
+    uint16_t cursor;                    // Nächste Kachel im laufenden Frame
+    uint32_t frameNumber;
+    uint32_t frameStartMs;
+    uint16_t frameTiles;
+    uint32_t frameBytes;
+
+    ScreenCaptureStats stats;
+
+    /**
+     * Kann der Bildspeicher jetzt gelesen werden?
+     * (kein laufender Tile-Transfer, kein Hardware-Scroll-Offset)
+     */
+    bool canRead() const;
+
+    /**
+     * Kachel lesen und ggf. als Zeile vorbereiten
+     * @param force auch unverändert senden
+     * @return true wenn eine Zeile bereitsteht
+     */
+    bool prepareTile(uint16_t index, bool force);
+
+    void beginFrame(bool full);
+    void endFrame();
+
+    /**
+     * Ausstehende Zeile senden
+     * @param block true = warten bis alles geschrieben ist
+     * @return true wenn keine Zeile mehr aussteht
+     */
+    bool flushLine(bool block);
+
+    size_t encodeRLE(const uint16_t* data, size_t count);
+    static size_t encodeBase64(const uint8_t* data, size_t length, char* out);
+    static uint32_t adler32(const uint8_t* data, size_t length);
+};
+
+#endif // SCREEN_CAPTURE_H
@@ -21,6 +21,10 @@
  *   config         - Zeigt aktuelle Konfiguration
  *   battery        - Zeigt Battery-Status
  *   espnow         - Zeigt ESP-NOW Status
+ *   spi [reset]    - HSPI-Bus Auslastung (Display/Touch)
+ *   ui [bench [n]|reset|sprite [on|off]|async [on|off]|fps [n]|budget [us]|arena|pages|cache [n]|render [n]|golden [save]|perf [reset]|overlay [on|off]|font [bench [n]]|events|theme [dark|contrast]|slide [on|off]|layout] - UI-Debug-Info / Benchmark / Statistik / Rendering / Speicher / Render-Tests / Profil / Fonts / Events / Theme / Page-Slide / Layout
+ *   screen [stream [ms]|stop|stats] - Screenshot / Bildschirm-Stream (tools/screen_capture.py)
+ *   touchcal [3|5|clear] - Affine Touch-Kalibrierung
  */
 
 #ifndef SERIAL_COMMAND_HANDLER_H
@@ -92,6 +96,10 @@ private:
     void handleConfigReset();
     void handleBattery();
     void handleESPNow();
+    void handleSPI(const String& args);
+    void handleUI(const String& args);
+    void handleScreen(const String& args);
+    void handleTouchCal(const String& args);
 
     // Hilfsfunktionen
     void listDirectory(const char* dirname);
@@ -0,0 +1,179 @@
+/**
+ * SpiBusArbiter.h
+ *
+ * Arbiter für den gemeinsamen HSPI-Bus (Display + Touch)
+ *
+ * Display (TFT_eSPI, 40 MHz) und Touch (XPT2046, 1 MHz) teilen sich
+ * einen Bus. Ohne Koordination landet jeder Touch-Read mitten in
+ * einer Zeichen-Sequenz und erzwingt zwei Takt-Umschaltungen.
+ *
+ * Features:
+ * - Besitzt den Bus (Rekursiver Mutex, Chip-Selects)
+ * - Display-Bursts: Ein Frame = eine SPI-Transaktion (Burst-Hooks)
+ * - Touch-Reads werden zwischen Display-Bursts eingeplant: der Touch-Task
+ *   (höhere Priorität, gleicher Core) wartet am Mutex und läuft sofort nach
+ *   dem release() des Display-Bursts
+ * - Takt-Caching: Geräte ohne eigene Transaktion (Touch, setDeviceSettings())
+ *   bekommen ihre SPISettings vom Arbiter - nur wenn das Takt-Register seit
+ *   dem letzten Mal umgestellt wurde (Display-Burst dazwischen), nicht pro Read
+ * - Geräte- und echte Takt-Wechsel gezählt
+ * - Auslastungs-Metriken pro Gerät (Belegung, Wartezeit, Timeouts)
+ *
+ * Verwendung:
+ *   spiBus.acquire(SpiDevice::TOUCH, 20);
+ *   ... SPI-Zugriffe ...
+ *   spiBus.release(SpiDevice::TOUCH);
+ *
+ * oder per Guard:
+ *   SpiBusGuard guard(&spiBus, SpiDevice::DISPLAY);
+ */
+
+#ifndef SPI_BUS_ARBITER_H
+#define SPI_BUS_ARBITER_H
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <functional>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "setupConf.h"
+
+// Geräte am gemeinsamen Bus
+enum class SpiDevice : uint8_t {
+    NONE = 0,
+    DISPLAY,
+    TOUCH,
+    COUNT
+};
+
+// Statistik pro Gerät
+struct SpiDeviceStats {
+    uint32_t acquisitions;  // Anzahl Bus-Belegungen (äußerste Ebene)
+    uint64_t busyUs;        // Summe Belegungszeit
+    uint64_t waitUs;        // Summe Wartezeit auf den Bus
+    uint32_t maxWaitUs;     // Längste Wartezeit
+    uint32_t maxHoldUs;     // Längste Belegung
+    uint32_t timeouts;      // acquire() fehlgeschlagen
+};
+
+// Hook beim Beginn/Ende eines Bursts (z.B. tft.startWrite/endWrite)
+typedef std::function<void()> SpiBurstHook;
+
+class SpiBusArbiter {
+public:
+    SpiBusArbiter();
+    ~SpiBusArbiter();
+
+    /**
+     * Chip-Selects konfigurieren (alle Geräte inaktiv)
+     * Vor display.begin() aufrufen!
+     * @return true bei Erfolg
+     */
+    bool begin();
+
+    /**
+     * SPI-Instanz übernehmen (nach TFT-Init)
+     * @param spi SPIClass des Displays (TFT_eSPI::getSPIinstance())
+     */
+    void attach(SPIClass* spi) { this->spi = spi; }
+
+    /**
+     * Bus für Gerät belegen (rekursiv für denselben Task)
+     * @param device Gerät
+     * @param timeoutMs Max. Wartezeit (Standard: unbegrenzt)
+     * @return true wenn Bus belegt
+     */
+    bool acquire(SpiDevice device, uint32_t timeoutMs = portMAX_DELAY);
+
+    /**
+     * Bus freigeben
+     * @param device Gerät (muss aktueller Besitzer sein)
+     */
+    void release(SpiDevice device);
+
+    /**
+     * Burst-Hooks setzen (beim ersten acquire / letzten release)
+     * Display: Transaktion über den ganzen Burst offen halten
+     */
+    void setBurstHooks(SpiDevice device, SpiBurstHook onBegin, SpiBurstHook onEnd);
+
+    /**
+     * Bus-Einstellungen für ein Gerät ohne eigene Transaktion setzen
+     * acquire() stellt Takt/Modus nur um, wenn ein anderes Gerät sie verändert hat -
+     * der Treiber greift danach ohne beginTransaction() auf getSPI() zu
+     * (Display nicht: TFT_eSPI stellt in startWrite() selbst um)
+     */
+    void setDeviceSettings(SpiDevice device, const SPISettings& settings);
+
+    // Status
+    bool isReady() const { return mutex != nullptr; }
+    SpiDevice getOwner() const { return owner; }
+    SPIClass* getSPI() { return spi; }
+
+    // Metriken
+    const SpiDeviceStats& getStats(SpiDevice device) const;
+    uint32_t getDeviceSwitches() const { return deviceSwitches; }
+    uint32_t getClockSwitches() const { return clockSwitches; }
+    float getUtilization(SpiDevice device) const;  // Prozent seit resetStats()
+    void resetStats();
+    void printStats();
+
+    static const char* deviceName(SpiDevice device);
+
+private:
+    static const uint8_t DEVICE_COUNT = static_cast<uint8_t>(SpiDevice::COUNT);
+
+    SPIClass* spi;
+    SemaphoreHandle_t mutex;
+
+    // Aktueller Besitzer (nur unter Mutex verändert)
+    SpiDevice owner;
+    SpiDevice lastDevice;       // Letzter Besitzer (Gerätewechsel zählen)
+    uint8_t depth;              // Verschachtelungstiefe
+    uint32_t holdStart;         // micros() bei Belegung
+
+    // Burst-Hooks
+    SpiBurstHook beginHooks[DEVICE_COUNT];
+    SpiBurstHook endHooks[DEVICE_COUNT];
+
+    // Vom Arbiter verwaltete Bus-Einstellungen
+    SPISettings deviceSettings[DEVICE_COUNT];
+    bool managedSettings[DEVICE_COUNT];
+    uint32_t appliedDivider[DEVICE_COUNT];  // Takt-Register nach dem Umstellen (0 = nie)
+    SpiDevice clockDevice;                  // Wessen Takt gerade im Register steht
+
+    void applyClock(SpiDevice device);
+
+    // Metriken
+    SpiDeviceStats stats[DEVICE_COUNT];
+    uint32_t deviceSwitches;    // Gerätewechsel (Display ↔ Touch)
+    uint32_t clockSwitches;     // Tatsächliche Takt-Umstellungen
+    uint32_t conflicts;         // Verschachtelte Belegung durch anderes Gerät
+    unsigned long statsStart;   // millis() bei resetStats()
+};
+
+/**
+ * Bus-Belegung für einen Scope (gibt im Destruktor frei)
+ */
+class SpiBusGuard {
+public:
+    SpiBusGuard(SpiBusArbiter* arbiter, SpiDevice device, uint32_t timeoutMs = portMAX_DELAY)
+        : arbiter(arbiter), device(device), locked(false) {
+        if (arbiter && arbiter->isReady()) {
+            locked = arbiter->acquire(device, timeoutMs);
+        }
+    }
+
+    ~SpiBusGuard() {
+        if (locked) arbiter->release(device);
+    }
+
+    bool isLocked() const { return locked; }
+
+private:
+    SpiBusArbiter* arbiter;
+    SpiDevice device;
+    bool locked;
+};
+
+#endif // SPI_BUS_ARBITER_H
@@ -6,9 +6,18 @@
  * Features:
  * - Optional (Pointer-basiert)
  * - Touch-Erkennung mit Zustandsverwaltung
- * - Koordinaten-Mapping auf Display
- * - Kalibrierung (via UserConfig)
- * - Rotation-Unterstützung
+ * - Koordinaten-Mapping auf Display (Festkomma-Affin, Q16)
+ * - Kalibrierung (via UserConfig): Min/Max oder 3/5-Punkt-Affin
+ * - Rotation-Unterstützung (in die Mapping-Koeffizienten eingerechnet)
+ * - IRQ-getriebener Sampling-Task mit Median/Trimmed-Mean Filter
+ *   (TouchPoint-Events via Queue an UIManager)
+ * 
+ * Mapping:
+ *   Die XPT2046-Lib läuft fest in Rotation 1 (native Achsen). Pro Sample
+ *   wird nur noch x = (A*rawX + B*rawY + C) >> 16 (y analog) gerechnet.
+ *   Die Koeffizienten werden bei Kalibrierung/Rotation einmal berechnet:
+ *   - Affin-Kalibrierung vorhanden → korrigiert auch Scherung/Verdrehung
+ *   - sonst aus Min/Max (native Achsen) abgeleitet
  * 
  * WICHTIG: Touch ist OPTIONAL!
  * - nullptr = Touch nicht verfügbar/deaktiviert
@@ -21,19 +30,25 @@
 #include <Arduino.h>
 #include <SPI.h>
 #include <XPT2046_Touchscreen.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
 #include "setupConf.h"
+#include "SpiBusArbiter.h"
 
 // Forward declaration
 class UserConfig;
+class TFT_eSPI;
 
 // Touch-Punkt Struktur
 struct TouchPoint {
     int16_t x;              // X-Koordinate (Display-Koordinaten)
     int16_t y;              // Y-Koordinate (Display-Koordinaten)
-    int16_t rawX;           // Rohe X-Koordinate
-    int16_t rawY;           // Rohe Y-Koordinate
+    int16_t rawX;           // Rohe X-Koordinate (native Achse, Rotation 1)
+    int16_t rawY;           // Rohe Y-Koordinate (native Achse, Rotation 1)
     uint16_t z;             // Druck
-    bool valid;             // Punkt gültig?
+    bool valid;             // Punkt gültig? (false = Release-Event)
     unsigned long timestamp; // Zeitstempel
 };
 
@@ -88,6 +103,42 @@ public:
      */
     bool isIRQActive();
 
+    /**
+     * IRQ-getriebenen Sampling-Task starten
+     * TOUCH_IRQ weckt den Task, der Bursts liest, filtert und
+     * TouchPoint-Events in die Event-Queue schiebt.
+     * Danach NICHT mehr update()/updateIfIRQ() in loop() aufrufen!
+     * @return true bei Erfolg
+     */
+    bool startSampling();
+
+    /**
+     * Sampling-Task stoppen (IRQ lösen, Task + Queue löschen)
+     * Wartet bis der Task sich beendet hat - erst dann wird die Queue gelöscht
+     */
+    void stopSampling();
+
+    /**
+     * Läuft der Sampling-Task?
+     */
+    bool isSampling() const { return samplingTask != nullptr; }
+
+    /**
+     * Nächstes Touch-Event aus der Queue holen (Main-Thread)
+     * Aktualisiert auch isTouched()/isTouchActive()/isTouchReleased()
+     * @param point Ziel für das Event (valid=false → Release)
+     * @return true wenn ein Event vorhanden war
+     */
+    bool pollEvent(TouchPoint* point);
+
+    /**
+     * HSPI-Arbiter setzen (Touch-Reads nur zwischen Display-Bursts)
+     * Meldet die Touch-SPISettings am Arbiter an - der stellt den Takt nur bei
+     * Bedarf um, gelesen wird dann ohne eigene Transaktion (readPoint())
+     * @param arbiter Arbiter oder nullptr (ohne Koordination)
+     */
+    void setBusArbiter(SpiBusArbiter* arbiter);
+
     /**
      * Wurde Touch gerade gedrückt?
      * @return true wenn Touch gerade begonnen
@@ -139,14 +190,56 @@ public:
      */
     void saveCalibrationToConfig(UserConfig* config);
 
+    /**
+     * Affine Kalibrierung interaktiv durchführen (BLOCKIERT!)
+     * Zeichnet Kreuze, mittelt die Rohwerte pro Punkt und löst die
+     * Transformation per Least-Squares. Sampling-Task wird solange gestoppt.
+     * @param tft Display zum Zeichnen der Kreuze
+     * @param points Anzahl Punkte (3 = exakt, 5 = Least-Squares)
+     * @return true wenn Kalibrierung übernommen wurde
+     */
+    bool runCalibration(TFT_eSPI* tft, uint8_t points = 5);
+
+    /**
+     * Affine Kalibrierung setzen
+     * @param coeffs A-F in Q16 (Rohwerte → Display in Rotation 1)
+     * @return false wenn Koeffizienten außerhalb Bereich (alte Kalibrierung bleibt)
+     */
+    bool setAffineCalibration(const int32_t coeffs[6]);
+
+    /**
+     * Affine Kalibrierung verwerfen (zurück zu Min/Max)
+     */
+    void clearAffineCalibration();
+
+    /**
+     * Ist eine affine Kalibrierung aktiv?
+     */
+    bool hasAffineCalibration() const { return affineValid; }
+
+    /**
+     * Affine Transformation aus Punktpaaren lösen (Least-Squares)
+     * @param rawX Rohe X-Werte
+     * @param rawY Rohe Y-Werte
+     * @param dispX Ziel-X (Display, Rotation 1)
+     * @param dispY Ziel-Y (Display, Rotation 1)
+     * @param count Anzahl Punkte (min. 3, nicht kollinear)
+     * @param coeffs Ergebnis A-F in Q16
+     * @return false wenn Punkte degeneriert oder Koeffizienten außerhalb Bereich
+     */
+    static bool solveAffine(const int16_t* rawX, const int16_t* rawY,
+                            const int16_t* dispX, const int16_t* dispY,
+                            uint8_t count, int32_t coeffs[6]);
+
     /**
      * Kalibrier-Werte manuell setzen
      * @param minX Minimum X
      * @param maxX Maximum X
      * @param minY Minimum Y
      * @param maxY Maximum Y
+     * @return false wenn Bereich ungültig (außerhalb 0-4095 oder < TOUCH_CAL_MIN_SPAN)
      */
-    void setCalibration(int16_t minX, int16_t maxX, int16_t minY, int16_t maxY);
+    bool setCalibration(int16_t minX, int16_t maxX, int16_t minY, int16_t maxY);
 
     /**
      * Kalibrier-Werte abrufen
@@ -212,6 +305,18 @@ private:
     int16_t calMaxY;
     bool calibrated;
     
+    // Affine Kalibrierung (Q16, Rotation 1)
+    int32_t affine[6];
+    bool affineValid;
+    
+    // Wirksame Abbildung (inkl. Rotation + Rundung), liest der Sampling-Task
+    struct TouchMapping {
+        int32_t coeffs[6];
+        int16_t width, height;      // Begrenzung (Display-Größe in dieser Rotation)
+    };
+    TouchMapping mapping;
+    portMUX_TYPE mappingLock = portMUX_INITIALIZER_UNLOCKED;   // mapping nur als Ganzes schreiben/lesen
+    
     // Schwellwert
     uint16_t pressureThreshold;
     
@@ -225,6 +330,75 @@ private:
     // Touch-Zeitstempel
     unsigned long touchStartTime;  // Wann wurde Touch gedrückt
     
+    // Gemeinsamer HSPI-Bus (nullptr = keine Koordination)
+    SpiBusArbiter* busArbiter;
+    
+    // Sampling-Task (IRQ → Task → Queue → Main-Thread)
+    TaskHandle_t samplingTask;     // nullptr = Polling-Modus
+    QueueHandle_t eventQueue;      // TouchPoint-Events
+    uint32_t droppedEvents;        // Verworfene Events (Queue voll)
+    uint32_t busyBursts;           // Verworfene Bursts (Bus-Timeout)
+    volatile bool samplingStopRequested;  // Task-Beendigung angefordert
+    SemaphoreHandle_t samplingExited;     // Task gibt ihn direkt vor vTaskDelete()
+    
+    /**
+     * IRQ-Handler (TOUCH_IRQ fallende Flanke → Task wecken)
+     */
+    static void onTouchIRQ(void* arg);
+    
+    /**
+     * Task-Einstiegspunkt
+     */
+    static void samplingTaskEntry(void* arg);
+    
+    /**
+     * Sampling-Schleife (läuft im Task)
+     */
+    void samplingLoop();
+    
+    // Ergebnis eines Bursts
+    enum class BurstResult : uint8_t {
+        TOUCHED,        // Mehrheit gültig → point gesetzt
+        RELEASED,       // Zu wenige Samples über Schwellwert
+        BUS_BUSY        // HSPI nicht rechtzeitig frei → Burst verworfen, Zustand unverändert
+    };
+    
+    /**
+     * Einen Burst lesen und filtern
+     * @param point Ziel-Punkt (rawX/rawY/z/x/y)
+     */
+    BurstResult readFilteredBurst(TouchPoint* point);
+    
+    /**
+     * Ein Sample lesen (Bus muss belegt sein)
+     * Mit Arbiter direkt über dessen SPI, sonst über die XPT2046-Lib
+     */
+    TS_Point readPoint();
+    
+    /**
+     * Event in Queue schieben (Release-Events verdrängen ältestes Event)
+     */
+    void pushEvent(const TouchPoint& point);
+    
+    /**
+     * Median/Trimmed-Mean: sortiert, verwirft Min/Max, mittelt den Rest
+     * @param values Samples (werden sortiert!)
+     * @param count Anzahl Samples
+     * @return Gefilterter Wert
+     */
+    static int16_t trimmedMean(int16_t* values, uint8_t count);
+    
+    /**
+     * Mapping-Koeffizienten aus Kalibrierung + Rotation neu berechnen
+     */
+    void rebuildMapping();
+    
+    /**
+     * Kalibrier-Punkt abwarten und gemittelte Rohwerte lesen
+     * @return false bei Timeout
+     */
+    bool readCalibrationPoint(int16_t* rawX, int16_t* rawY);
+    
     /**
      * Rohe Koordinaten auf Display mappen
      * @param rawX Rohe X-Koordinate
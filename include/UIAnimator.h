@@ -0,0 +1,126 @@
+/**
+ * UIAnimator.h
+ *
+ * Zeitbasierte Tweens für Widget-Eigenschaften (Position, Farbe, Wert)
+ * und sonstige Werte (z.B. Backlight)
+ *
+ * - Fester Pool (UI_ANIM_MAX_TWEENS), kein Heap pro Frame
+ * - Fortschritt über die Zeit (millis()), nicht über die Frame-Anzahl →
+ *   gleiche Dauer bei jeder Framerate, ausgelassene Frames werden übersprungen
+ * - update() läuft im Frame-Takt (PageManager::draw() vor drawUpdates()).
+ *   Pro Tick wird nur der Setter aufgerufen - Widgets markieren sich selbst
+ *   als geändert, der Compositor zeichnet nur deren Damage-Bereiche
+ * - Tweens mit Owner-Element werden beim Entfernen des Elements
+ *   (UIManager::remove()) abgebrochen
+ */
+
+#ifndef UI_ANIMATOR_H
+#define UI_ANIMATOR_H
+
+#include <Arduino.h>
+#include <functional>
+#include "setupConf.h"
+
+class UIElement;
+
+// Easing-Kurven (Fortschritt 0..1 → 0..1)
+enum class Easing : uint8_t {
+    LINEAR,
+    EASE_IN,        // Quadratisch beschleunigen
+    EASE_OUT,       // Quadratisch abbremsen
+    EASE_IN_OUT     // Kubisch: beschleunigen, dann abbremsen
+};
+
+// Tween-Schritt: t = Fortschritt nach Easing (0..1)
+typedef std::function<void(float t)> TweenStep;
+
+// Tween beendet (nicht bei cancel())
+typedef std::function<void()> TweenDone;
+
+// Kennung eines laufenden Tweens (0 = ungültig)
+typedef uint16_t TweenId;
+
+class UIAnimator {
+public:
+    UIAnimator();
+    ~UIAnimator();
+
+    /**
+     * Tween starten (Basis für alle anderen Varianten)
+     * @param durationMs Dauer (0 = im nächsten update() fertig)
+     * @param step Wird pro update() mit dem Fortschritt aufgerufen, zuletzt mit 1.0
+     * @param owner Element dessen Entfernen den Tween abbricht (optional)
+     * @param done Nach dem letzten Schritt (optional, darf neue Tweens starten)
+     * @return Kennung oder 0 wenn der Pool voll ist
+     */
+    TweenId animate(uint32_t durationMs, Easing easing, TweenStep step,
+                    UIElement* owner = nullptr, TweenDone done = nullptr);
+
+    /**
+     * Ganzzahligen Wert von from nach to (z.B. UISlider::setValue, Backlight)
+     */
+    TweenId animateValue(int32_t from, int32_t to, uint32_t durationMs, Easing easing,
+                         std::function<void(int32_t value)> setter,
+                         UIElement* owner = nullptr, TweenDone done = nullptr);
+
+    /**
+     * RGB565-Farbe kanalweise überblenden (z.B. UILabel::setTextColor)
+     */
+    TweenId animateColor(uint16_t from, uint16_t to, uint32_t durationMs, Easing easing,
+                         std::function<void(uint16_t color)> setter,
+                         UIElement* owner = nullptr, TweenDone done = nullptr);
+
+    /**
+     * Element von der aktuellen Position nach (x, y) verschieben
+     * Ein laufender moveTo() desselben Elements wird ersetzt
+     */
+    TweenId moveTo(UIElement* element, int16_t x, int16_t y, uint32_t durationMs,
+                   Easing easing = Easing::EASE_OUT, TweenDone done = nullptr);
+
+    /**
+     * Tween abbrechen (Wert bleibt auf dem letzten Schritt stehen)
+     */
+    void cancel(TweenId id);
+
+    /**
+     * Alle Tweens deren Owner subtree oder ein Nachfahre davon ist abbrechen
+     */
+    void cancelSubtree(UIElement* subtree);
+
+    void cancelAll();
+
+    /**
+     * Alle laufenden Tweens auf den Zeitpunkt nowMs setzen
+     */
+    void update(uint32_t nowMs);
+
+    bool isRunning(TweenId id) const;
+    uint8_t getActiveCount() const { return activeCount; }
+    uint32_t getCompletedCount() const { return completed; }
+
+    static float ease(Easing easing, float t);
+    static uint16_t lerpColor(uint16_t from, uint16_t to, float t);
+
+private:
+    struct Tween {
+        TweenId id;             // 0 = Slot frei
+        UIElement* owner;
+        bool move;              // moveTo() (ersetzt sich pro Element)
+        uint32_t startMs;
+        uint32_t durationMs;
+        Easing easing;
+        TweenStep step;
+        TweenDone done;
+    };
+
+    Tween tweens[UI_ANIM_MAX_TWEENS];
+    TweenId nextId;
+    uint8_t activeCount;
+    uint32_t completed;
+
+    Tween* start(uint32_t durationMs, Easing easing, TweenStep step, UIElement* owner, TweenDone done);
+    Tween* allocate();
+    void release(Tween& tween);
+};
+
+#endif // UI_ANIMATOR_H
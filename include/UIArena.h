@@ -0,0 +1,146 @@
+/**
+ * UIArena.h
+ *
+ * Bump-Allocator für die Widgets einer Page
+ *
+ * - Speicher wird in Blöcken (UI_ARENA_CHUNK_SIZE) angefordert, optional im
+ *   PSRAM → Widgets fragmentieren nicht den internen Heap (WiFi/ESP-NOW)
+ * - create<T>() legt Objekte per Placement-New an, Destruktoren werden in der
+ *   Arena selbst vermerkt
+ * - reset() zerstört alle Objekte (rückwärts) und gibt alle Blöcke in einem
+ *   Schritt frei - einzelne Objekte werden nie freigegeben
+ * - Alle Arenen sind verkettet → printAll() für die serielle Konsole
+ */
+
+#ifndef UI_ARENA_H
+#define UI_ARENA_H
+
+#include <Arduino.h>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "setupConf.h"
+
+class UIArena {
+public:
+    /**
+     * @param name Anzeigename (z.B. Seitenname, wird nicht kopiert)
+     * @param chunkSize Blockgröße in Byte
+     * @param usePsram Blöcke im PSRAM anlegen (Fallback: interner Heap)
+     */
+    UIArena(const char* name, size_t chunkSize = UI_ARENA_CHUNK_SIZE, bool usePsram = UI_ARENA_PSRAM);
+    ~UIArena();
+
+    /**
+     * Rohspeicher anfordern (lebt bis reset())
+     * @return nullptr wenn kein Speicher
+     */
+    void* allocate(size_t size, size_t align = alignof(std::max_align_t));
+
+    /**
+     * Objekt in der Arena anlegen
+     * Destruktor läuft bei reset() (nur für nicht-triviale Typen vermerkt)
+     * @return nullptr wenn kein Speicher
+     */
+    template <typename T, typename... Args>
+    T* create(Args&&... args);
+
+    /**
+     * C-String in die Arena kopieren
+     */
+    char* duplicate(const char* text);
+
+    /**
+     * Alle Objekte zerstören und alle Blöcke freigeben
+     */
+    void reset();
+
+    // Statistik
+    const char* getName() const { return name; }
+    size_t getUsed() const { return used; }              // Belegte Byte (inkl. Verschnitt)
+    size_t getCapacity() const { return capacity; }      // Angeforderte Byte (alle Blöcke)
+    size_t getPeak() const { return peak; }              // Max. Belegung seit Start
+    uint16_t getChunkCount() const { return chunkCount; }
+    uint16_t getObjectCount() const { return objectCount; }
+    bool isPsram() const { return psramChunks > 0; }
+
+    void printStats() const;
+
+    /**
+     * Alle Arenen ausgeben (Summe + freier Heap)
+     */
+    static void printAll();
+
+private:
+    // Block-Kopf, Nutzdaten folgen direkt dahinter
+    struct Chunk {
+        Chunk* next;
+        size_t size;            // Nutzbare Byte
+        size_t offset;          // Belegte Byte
+        bool psram;
+    };
+
+    // Destruktor-Vermerk (liegt selbst in der Arena)
+    struct Destructor {
+        Destructor* next;
+        void (*destroy)(void* object);
+        void* object;
+    };
+
+    const char* name;
+    size_t chunkSize;
+    bool usePsram;
+
+    Chunk* chunks;              // Aktueller Block zuerst
+    Destructor* destructors;    // Zuletzt angelegtes Objekt zuerst
+
+    size_t used;
+    size_t capacity;
+    size_t peak;
+    uint16_t chunkCount;
+    uint16_t psramChunks;
+    uint16_t objectCount;
+
+    // Verkettung aller Arenen
+    UIArena* nextArena;
+    static UIArena* firstArena;
+
+    Chunk* addChunk(size_t minSize);
+
+    template <typename T>
+    static void destroyObject(void* object) { static_cast<T*>(object)->~T(); }
+
+    // Nicht kopierbar (Objekte verweisen in die Blöcke)
+    UIArena(const UIArena&) = delete;
+    UIArena& operator=(const UIArena&) = delete;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TEMPLATE-IMPLEMENTATION
+// ═══════════════════════════════════════════════════════════════════════════
+
+template <typename T, typename... Args>
+T* UIArena::create(Args&&... args) {
+    Destructor* record = nullptr;
+    if (!std::is_trivially_destructible<T>::value) {
+        record = static_cast<Destructor*>(allocate(sizeof(Destructor), alignof(Destructor)));
+        if (!record) return nullptr;
+    }
+
+    void* memory = allocate(sizeof(T), alignof(T));
+    if (!memory) return nullptr;
+
+    T* object = new (memory) T(std::forward<Args>(args)...);
+    objectCount++;
+
+    if (record) {
+        record->destroy = &UIArena::destroyObject<T>;
+        record->object = object;
+        record->next = destructors;
+        destructors = record;
+    }
+    return object;
+}
+
+#endif // UI_ARENA_H
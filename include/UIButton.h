@@ -16,22 +16,25 @@ public:
 
     // Override virtuelle Funktionen
     void draw(TFT_eSPI* tft) override;
+    const char* getTypeName() const override { return "Button"; }
+    void measure(int16_t* outW, int16_t* outH) override;
     void handleTouch(int16_t x, int16_t y, bool pressed) override;
 
     // Button-spezifische Funktionen
     void setText(const char* text);
     const char* getText() const { return text; }
     void setTextColor(uint16_t color);
-    void setPressedColor(uint16_t color);
+    void setPressedColor(uint16_t color);      // Hintergrund wenn gedrückt
     bool isPressed() const { return pressed; }
     void setFontSize(uint8_t size);  // Font-Größe setzen (1-7)
 
+protected:
+    StyleState getStyleState() const override;
+
 private:
     char text[32];              // Button-Text
     bool pressed;               // Button gedrückt?
     bool wasInside;             // War Touch beim letzten Mal innerhalb?
-    uint16_t pressedColor;      // Farbe wenn gedrückt
-    uint16_t normalColor;       // Normale Farbe
     uint8_t fontSize;           // Font-Größe (1-7)
     
     void drawButton(TFT_eSPI* tft, bool isPressed);
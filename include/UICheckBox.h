@@ -16,7 +16,9 @@ public:
 
     // Override virtuelle Funktionen
     void draw(TFT_eSPI* tft) override;
+    const char* getTypeName() const override { return "CheckBox"; }
     void handleTouch(int16_t x, int16_t y, bool pressed) override;
+    bool isOpaque() const override { return false; }  // Label ohne Hintergrund
 
     // CheckBox-spezifische Funktionen
     void setChecked(bool checked);
@@ -26,15 +28,17 @@ public:
     const char* getLabel() const { return label; }
     void setCheckColor(uint16_t color);
 
+protected:
+    StyleState getStyleState() const override { return enabled ? StyleState::NORMAL : StyleState::DISABLED; }
+
 private:
     char label[32];             // Label-Text
     bool checked;               // Checked-Status
     bool wasInside;             // War Touch beim letzten Mal innerhalb?
-    uint16_t checkColor;        // Farbe des Häkchens
     int16_t boxSize;            // Größe der Box
     
     void drawCheckBox(TFT_eSPI* tft);
-    void drawCheckMark(TFT_eSPI* tft, int16_t x, int16_t y, int16_t size);
+    void drawCheckMark(TFT_eSPI* tft, int16_t x, int16_t y, int16_t size, uint16_t checkColor);
 };
 
 #endif // UI_CHECKBOX_H
\ No newline at end of file
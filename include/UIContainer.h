@@ -0,0 +1,71 @@
+/**
+ * UIContainer.h
+ *
+ * Container-Knoten im Widget-Baum (z.B. Content einer UIPage)
+ *
+ * - Kinder liegen in Z-Order (hinten → vorne), gleiche Z-Order in Einfüge-Reihenfolge
+ * - Versteckter Container: kompletter Teilbaum wird beim Zeichnen und
+ *   beim Hit-Test übersprungen (UIManager nimmt ihn nicht in die Zeichenliste)
+ * - Optionaler Clip: Kinder zeichnen und reagieren nur innerhalb der Bounds
+ * - Container selbst ist nicht berührbar, zeichnet nur den optionalen Hintergrund
+ */
+
+#ifndef UI_CONTAINER_H
+#define UI_CONTAINER_H
+
+#include <vector>
+#include "UIElement.h"
+
+class UIContainer : public UIElement {
+public:
+    UIContainer(int16_t x, int16_t y, int16_t w, int16_t h);
+    ~UIContainer();
+
+    // Override virtuelle Funktionen
+    void draw(TFT_eSPI* tft) override;
+    const char* getTypeName() const override { return "Container"; }
+    void handleTouch(int16_t x, int16_t y, bool pressed) override;
+    bool isOpaque() const override { return hasBackground; }
+    UIContainer* asContainer() override { return this; }
+
+    /**
+     * Kind hinzufügen (nach Z-Order einsortieren)
+     * Ein Element kann nur einen Parent haben - wird ggf. umgehängt
+     */
+    void addChild(UIElement* child);
+
+    /**
+     * Kind entfernen (Parent wird zurückgesetzt)
+     * @return false wenn kein Kind dieses Containers
+     */
+    bool removeChild(UIElement* child);
+
+    // Alle Kinder entfernen
+    void clearChildren();
+
+    const std::vector<UIElement*>& getChildren() const { return children; }
+
+    /**
+     * Kinder neu nach Z-Order sortieren (von UIElement::setZOrder())
+     */
+    void sortChildren();
+
+    /**
+     * Kinder auf die Container-Bounds clippen
+     */
+    void setClipChildren(bool clip);
+    bool getClipChildren() const { return clipChildren; }
+
+    /**
+     * Hintergrund füllen (deckend) statt transparent
+     */
+    void setBackground(uint16_t color);
+    void setTransparent() { hasBackground = false; needsRedraw = true; }
+
+private:
+    std::vector<UIElement*> children;   // Z-Order (hinten → vorne)
+    bool clipChildren;
+    bool hasBackground;
+};
+
+#endif // UI_CONTAINER_H
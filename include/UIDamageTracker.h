@@ -0,0 +1,81 @@
+/**
+ * UIDamageTracker.h
+ *
+ * Damage-Rechtecke für den Compositor in UIManager::drawUpdates()
+ *
+ * Sammelt pro Frame die Bereiche, die neu gezeichnet werden müssen:
+ * - Neue/aktuelle Bounds geänderter Elemente
+ * - Alte Bounds verschobener/versteckter Elemente (Hintergrund freilegen)
+ *
+ * Überlappende oder nahe beieinander liegende Rechtecke werden vereinigt
+ * (UI_DAMAGE_MERGE_WASTE), die Anzahl ist auf UI_DAMAGE_MAX_RECTS begrenzt.
+ * Nach merge() sind alle Rechtecke disjunkt.
+ */
+
+#ifndef UI_DAMAGE_TRACKER_H
+#define UI_DAMAGE_TRACKER_H
+
+#include <Arduino.h>
+#include "setupConf.h"
+
+// Ein Damage-Bereich
+struct DamageRect {
+    int16_t x, y, w, h;
+    bool clearBackground;   // Hintergrund vor dem Neuzeichnen füllen
+    uint16_t firstElement;  // Niedrigster Z-Index der neu gezeichnet werden muss
+
+    uint32_t area() const { return (uint32_t)w * h; }
+};
+
+class UIDamageTracker {
+public:
+    UIDamageTracker();
+    ~UIDamageTracker();
+
+    /**
+     * Bereich als beschädigt markieren (wird auf den Screen begrenzt)
+     * @param clearBackground Hintergrund muss neu gefüllt werden
+     * @param firstElement Z-Index ab dem Elemente neu gezeichnet werden
+     */
+    void add(int16_t x, int16_t y, int16_t w, int16_t h, bool clearBackground, uint16_t firstElement);
+
+    /**
+     * Rechtecke vereinigen bis alle disjunkt sind und das Limit passt
+     */
+    void merge();
+
+    /**
+     * Alle Rechtecke verwerfen
+     */
+    void clear() { count = 0; }
+
+    /**
+     * Die ersten processed Rechtecke verwerfen, Rest für den nächsten Frame
+     * behalten (Frame-Budget erschöpft). Verschobene Bereiche werden komplett
+     * neu aufgebaut, da Elemente darin evtl. schon teilweise gezeichnet wurden.
+     */
+    void defer(uint8_t processed);
+
+    bool isEmpty() const { return count == 0; }
+    uint8_t getCount() const { return count; }
+    const DamageRect& get(uint8_t index) const { return rects[index]; }
+
+    /**
+     * Schnittmenge zweier Rechtecke
+     * @return false wenn leer
+     */
+    static bool intersect(int16_t ax, int16_t ay, int16_t aw, int16_t ah,
+                          int16_t bx, int16_t by, int16_t bw, int16_t bh,
+                          int16_t* ox, int16_t* oy, int16_t* ow, int16_t* oh);
+
+private:
+    // Eine Reserve über dem Limit, damit add() nie verwerfen muss
+    DamageRect rects[UI_DAMAGE_MAX_RECTS + 1];
+    uint8_t count;
+
+    static DamageRect unite(const DamageRect& a, const DamageRect& b);
+    static bool overlaps(const DamageRect& a, const DamageRect& b);
+    void removeAt(uint8_t index);
+};
+
+#endif // UI_DAMAGE_TRACKER_H
@@ -10,15 +10,17 @@
 #include <Arduino.h>
 #include <TFT_eSPI.h>
 #include "UIEventHandler.h"
+#include "UITheme.h"
 #include "setupConf.h"
 
-// Element-Style Struktur
-struct ElementStyle {
-    uint16_t bgColor;
-    uint16_t borderColor;
-    uint16_t textColor;
-    uint8_t borderWidth;
-    uint8_t cornerRadius;
+class UIContainer;
+
+// Render-Profil eines Elements (seit resetPerf(), vom UIManager gemessen)
+struct UIElementPerf {
+    uint32_t draws;             // draw()-Aufrufe
+    uint32_t totalUs;           // Summe der draw()-Dauer
+    uint32_t maxUs;             // Längster draw()-Aufruf
+    uint64_t pixels;            // Abgedeckte Pixel (Element ∩ Damage-Bereich), summiert
 };
 
 class UIElement {
@@ -29,22 +31,66 @@ public:
     // Rein virtuelle Funktionen (müssen implementiert werden)
     virtual void draw(TFT_eSPI* tft) = 0;
     virtual void handleTouch(int16_t x, int16_t y, bool pressed) = 0;
+    
+    /**
+     * Geste verarbeiten (vom UIManager an berührte Elemente)
+     * Standard: registrierten Event-Handler auslösen
+     * @return true wenn Geste konsumiert wurde (nicht an Page weiterreichen)
+     */
+    virtual bool handleGesture(EventType type, EventData* data);
 
     // Gemeinsame Funktionen
-    bool isPointInside(int16_t px, int16_t py);
+    bool isPointInside(int16_t px, int16_t py);     // Bounds und Clip-Bereich
     void setPosition(int16_t x, int16_t y);
     void setSize(int16_t w, int16_t h);
     void setBounds(int16_t x, int16_t y, int16_t w, int16_t h);
     void setVisible(bool visible);
     void setEnabled(bool enabled);
+    
+    /**
+     * Style (Einträge der gemeinsamen UITheme-Tabelle)
+     * setStyle(): alle Farben fest, unabhängig vom Theme
+     * setStyleRole(): Theme-Style der Rolle, Abweichungen entfallen
+     */
     void setStyle(ElementStyle style);
+    void setStyleRole(StyleRole role);
+    StyleId getStyleId() const { return styleId; }
+    
+    /**
+     * Style-Eintrag hat sich geändert (Theme-Wechsel, Setter)
+     * Standard: komplett neu zeichnen (wie nach onBackgroundPainted())
+     */
+    virtual void onStyleChanged();
+    
+    // Widget-Baum (Parent wird von UIContainer::addChild() gesetzt)
+    void setParent(UIContainer* container) { parent = container; geometryRevision++; }
+    UIContainer* getParent() const { return parent; }
+    virtual UIContainer* asContainer() { return nullptr; }
+    
+    /**
+     * Element und alle Vorfahren sichtbar?
+     * (Versteckter Container blendet seinen kompletten Teilbaum aus)
+     */
+    bool isShown() const;
+    
+    /**
+     * Z-Order innerhalb des Parents (größer = weiter vorne)
+     * Gleiche Z-Order: Einfüge-Reihenfolge
+     */
+    void setZOrder(int16_t z);
+    int16_t getZOrder() const { return zOrder; }
     
-    // Owner-Page Verwaltung
-    void setOwnerPage(void* page) { ownerPage = page; }
-    void* getOwnerPage() const { return ownerPage; }
+    /**
+     * Clip-Bereich (vom UIManager aus den Vorfahren berechnet)
+     * Zeichnen und Touch sind auf diesen Bereich begrenzt
+     */
+    void setClipRect(int16_t cx, int16_t cy, int16_t cw, int16_t ch);
+    void clearClipRect() { clipped = false; }
+    bool hasClipRect() const { return clipped; }
+    void getClipRect(int16_t* outX, int16_t* outY, int16_t* outW, int16_t* outH) const;
     
     // Event-Handler
-    void on(EventType type, EventCallback callback);
+    bool on(EventType type, EventCallback callback);     // false: nicht registriert (siehe UIEventHandler::on)
     void off(EventType type);
     
     // Getter
@@ -56,6 +102,67 @@ public:
     // Redraw-Flag
     void setNeedsRedraw(bool redraw) { needsRedraw = redraw; }
     bool getNeedsRedraw() const { return needsRedraw; }
+    
+    /**
+     * Bereich den draw() tatsächlich beschreibt
+     * Standard: Bounds (Widgets die außerhalb zeichnen überschreiben)
+     */
+    virtual void getPaintBounds(int16_t* outX, int16_t* outY, int16_t* outW, int16_t* outH);
+    
+    /**
+     * Wunschgröße für das Flex-Layout (UIFlexBox, Einträge mit LAYOUT_AUTO)
+     * Standard: aktuelle Größe (Widgets mit Text messen den Text)
+     */
+    virtual void measure(int16_t* outW, int16_t* outH) {
+        if (outW) *outW = width;
+        if (outH) *outH = height;
+    }
+    
+    /**
+     * Überschreibt draw() alles was das Element vorher gezeichnet hat?
+     * false → Compositor füllt vorher den Hintergrund (z.B. transparente Labels)
+     */
+    virtual bool isOpaque() const { return true; }
+    
+    /**
+     * Nimmt das Element Touch an seiner Fläche an?
+     * false → Touch geht an das Element darunter (reine Anzeigen ohne Handler)
+     */
+    virtual bool acceptsTouch() { return true; }
+    
+    /**
+     * Teilbereich der sich seit dem letzten draw() geändert hat
+     * Retained-Widgets (z.B. UIJoystickView) melden so nur kleine Damage-Bereiche
+     * Standard: Paint-Bounds
+     */
+    virtual void getDirtyBounds(int16_t* outX, int16_t* outY, int16_t* outW, int16_t* outH) {
+        getPaintBounds(outX, outY, outW, outH);
+    }
+    
+    /**
+     * Compositor hat den Hintergrund unter dem Element überschrieben
+     * → Retained-Widgets müssen beim folgenden draw() komplett zeichnen
+     */
+    virtual void onBackgroundPainted() {}
+    
+    /**
+     * Typname für Diagnose-Ausgaben (ui perf)
+     */
+    virtual const char* getTypeName() const { return "Element"; }
+    
+    // Render-Profil (UIManager misst jeden draw()-Aufruf)
+    void recordDraw(uint32_t us, uint32_t pixels);
+    const UIElementPerf& getPerf() const { return perf; }
+    void resetPerf();
+    
+    // Zuletzt gezeichneter Bereich (vom UIManager-Compositor gepflegt)
+    void setPainted(bool painted);
+    bool isPainted() const { return painted; }
+    void getPaintedBounds(int16_t* outX, int16_t* outY, int16_t* outW, int16_t* outH) const;
+    
+    // Geometrie-Revision (global, ändert sich bei Bounds/Sichtbarkeit/Baum/Z-Order)
+    // UIManager baut Zeichenliste und Hit-Test-Index nur bei Änderung neu auf
+    static uint32_t getGeometryRevision() { return geometryRevision; }
 
 protected:
     // Position und Größe
@@ -68,23 +175,59 @@ protected:
     bool touched;
     bool needsRedraw;
     
-    // Style
-    ElementStyle style;
+    // Zuletzt gezeichnet (für Damage beim Verschieben/Verstecken)
+    bool painted;
+    int16_t paintedX, paintedY, paintedW, paintedH;
+    
+    // Style (Index in die UITheme-Tabelle)
+    StyleId styleId;
     
     // Event-Handler
     UIEventHandler eventHandler;
     
-    // Owner-Page (void* um Zirkelbezug zu vermeiden)
-    void* ownerPage;
+    // Widget-Baum
+    UIContainer* parent;
+    int16_t zOrder;
+    
+    // Effektiver Clip-Bereich (clipped == false → unbegrenzt)
+    bool clipped;
+    int16_t clipX, clipY, clipW, clipH;
     
     // Letzte Touch-Position
     int16_t lastTouchX, lastTouchY;
     
+    // Render-Profil
+    UIElementPerf perf;
+    
+    // Globaler Zähler für Geometrie-Änderungen (alle Elemente)
+    static uint32_t geometryRevision;
+    
+    /**
+     * Aktueller Style (vorberechnete Variante für getStyleState())
+     */
+    const ElementStyle& style() const { return UITheme::get(styleId, getStyleState()); }
+    
+    /**
+     * Zustand für style() - Widgets mit Gedrückt-/Deaktiviert-Darstellung überschreiben
+     */
+    virtual StyleState getStyleState() const { return StyleState::NORMAL; }
+    
+    /**
+     * Einzelnes Feld abweichend vom Theme setzen (teilt Einträge mit gleichen Abweichungen)
+     */
+    void setStyleField(StyleField field, uint16_t value);
+    
     // Helper-Funktionen
     void drawRoundRect(TFT_eSPI* tft, int16_t x, int16_t y, int16_t w, int16_t h, 
                        uint8_t r, uint16_t color);
     void fillRoundRect(TFT_eSPI* tft, int16_t x, int16_t y, int16_t w, int16_t h, 
                        uint8_t r, uint16_t color);
+    
+    /**
+     * RGB565-Block zeichnen (Display oder Offscreen-Surface)
+     * Pixel in Display-Byte-Reihenfolge (z.B. aus einem Sprite)
+     */
+    static void pushPixels(TFT_eSPI* tft, int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
 };
 
 #endif // UI_ELEMENT_H
\ No newline at end of file
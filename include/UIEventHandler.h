@@ -1,15 +1,26 @@
 /**
  * UIEventHandler.h
- * 
+ *
  * Event-System für UI-Elemente
  * Verwaltet Callbacks für verschiedene Event-Types
+ *
+ * Speicher: die meisten Widgets haben keinen oder einen Handler. Statt einer
+ * Callback-Tabelle pro Widget (ein std::function pro Event-Type) liegen alle
+ * Handler in einem zentralen Pool (UI_EVENT_MAX_HANDLERS), das Widget hält
+ * nur den Index seines ersten Eintrags (verkettete Liste).
+ * EventCallback speichert die Captures inline (UI_EVENT_CALLBACK_SIZE Byte)
+ * und legt nie Heap an - zu große Captures scheitern beim Kompilieren.
  */
 
 #ifndef UI_EVENT_HANDLER_H
 #define UI_EVENT_HANDLER_H
 
 #include <Arduino.h>
-#include <functional>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "setupConf.h"
 
 // Event-Daten Struktur
 struct EventData {
@@ -18,6 +29,19 @@ struct EventData {
     int value;          // Wert (bei onChange)
     int oldValue;       // Alter Wert (bei onChange)
     void* userData;     // Optionale Benutzerdaten
+    int16_t dx;         // Verschiebung (bei Gesten: PAN inkrementell, SWIPE gesamt)
+    int16_t dy;
+    float vx;           // Geschwindigkeit in px/s (bei Gesten)
+    float vy;
+};
+
+// Swipe-Richtung (EventData.value bei SWIPE)
+enum class SwipeDirection {
+    NONE = 0,
+    LEFT,
+    RIGHT,
+    UP,
+    DOWN
 };
 
 // Event-Types
@@ -32,26 +56,134 @@ enum class EventType {
     DRAG_START,     // Drag begonnen (Slider)
     DRAG_END,       // Drag beendet (Slider)
     FOCUS,          // Element fokussiert
-    BLUR            // Element verliert Fokus
+    BLUR,           // Element verliert Fokus
+
+    // Gesten (UIGestureRecognizer)
+    TAP,            // Kurzer Touch ohne Bewegung
+    LONG_PRESS,     // Touch gehalten ohne Bewegung
+    PAN,            // Bewegung während Touch (dx/dy inkrementell, value=1 bei Kinetic)
+    SWIPE,          // Schnelle gerichtete Bewegung (value = SwipeDirection)
+    FLING           // Loslassen mit Geschwindigkeit (vx/vy)
 };
 
-// Callback-Typ
-typedef std::function<void(EventData*)> EventCallback;
+/**
+ * Callback-Typ: void(EventData*) mit Inline-Speicher statt std::function
+ * Lambdas, Funktionszeiger und Funktoren bis UI_EVENT_CALLBACK_SIZE Byte
+ */
+class EventCallback {
+public:
+    static const size_t CAPACITY = UI_EVENT_CALLBACK_SIZE;
+
+    EventCallback() : invoker(nullptr), manager(nullptr) {}
+    EventCallback(std::nullptr_t) : invoker(nullptr), manager(nullptr) {}
+
+    template <typename F, typename T = typename std::decay<F>::type,
+              typename = typename std::enable_if<!std::is_same<T, EventCallback>::value &&
+                                                 !std::is_same<T, std::nullptr_t>::value>::type>
+    EventCallback(F&& callable) {
+        static_assert(sizeof(T) <= CAPACITY, "Capture zu groß für EventCallback (UI_EVENT_CALLBACK_SIZE)");
+        static_assert(alignof(T) <= alignof(Storage), "Capture-Ausrichtung nicht unterstützt");
+
+        new (&storage) T(std::forward<F>(callable));
+        invoker = &invokeTarget<T>;
+        manager = &manageTarget<T>;
+    }
+
+    EventCallback(const EventCallback& other) : invoker(nullptr), manager(nullptr) { copyFrom(other); }
+    EventCallback& operator=(const EventCallback& other) {
+        if (this != &other) {
+            reset();
+            copyFrom(other);
+        }
+        return *this;
+    }
+    EventCallback& operator=(std::nullptr_t) { reset(); return *this; }
+    ~EventCallback() { reset(); }
+
+    void operator()(EventData* data) const { if (invoker) invoker(&storage, data); }
+    explicit operator bool() const { return invoker != nullptr; }
+
+private:
+    typedef typename std::aligned_storage<CAPACITY, alignof(void*)>::type Storage;
+
+    mutable Storage storage;
+    void (*invoker)(void* target, EventData* data);
+    void (*manager)(void* target, const void* source);     // source: kopieren, nullptr: zerstören
+
+    template <typename T>
+    static void invokeTarget(void* target, EventData* data) { (*static_cast<T*>(target))(data); }
+
+    template <typename T>
+    static void manageTarget(void* target, const void* source) {
+        if (source) new (target) T(*static_cast<const T*>(source));
+        else static_cast<T*>(target)->~T();
+    }
+
+    void copyFrom(const EventCallback& other) {
+        if (!other.invoker) return;
+        other.manager(&storage, &other.storage);
+        invoker = other.invoker;
+        manager = other.manager;
+    }
+
+    void reset() {
+        if (manager) manager(&storage, nullptr);
+        invoker = nullptr;
+        manager = nullptr;
+    }
+};
 
 class UIEventHandler {
 public:
     UIEventHandler();
     ~UIEventHandler();
 
-    void on(EventType type, EventCallback callback);
+    /**
+     * Handler registrieren (ersetzt vorhandenen gleichen Typs)
+     * Pool voll heißt UI_EVENT_MAX_HANDLERS zu klein: wird geloggt und gezählt
+     * (ui events), UIPage::show() meldet die betroffene Seite - kein Abbruch,
+     * Pages werden zur Laufzeit gebaut (Fernbedienung mitten im Betrieb)
+     * @return false wenn nicht registriert (ungültiger Typ, Pool voll)
+     */
+    bool on(EventType type, EventCallback callback);
     void off(EventType type);
     void clear();
     void trigger(EventType type, EventData* data = nullptr);
     bool hasHandler(EventType type);
 
+    /**
+     * Pool-Belegung + Byte pro Widget (vorher: Tabelle mit EVENT_COUNT std::function)
+     */
+    static void printStats();
+    static uint16_t getPoolUsed() { return poolUsed; }
+    static uint32_t getPoolFailures() { return poolFailures; }
+    static size_t getLegacyTableBytes();
+
 private:
-    EventCallback callbacks[11];  // NONE bis BLUR = 11 Events
-    int eventToIndex(EventType type);
+    static const int EVENT_COUNT = static_cast<int>(EventType::FLING) + 1;
+    static const uint16_t NO_SLOT = 0xFFFF;
+
+    // Pool-Eintrag (frei: in der Freiliste über next)
+    struct Slot {
+        EventCallback callback;
+        uint16_t next;
+        uint8_t type;
+    };
+
+    uint16_t head;                  // Erster Handler dieses Widgets (NO_SLOT = keiner)
+
+    static Slot slots[UI_EVENT_MAX_HANDLERS];
+    static uint16_t freeHead;
+    static bool poolReady;
+    static uint16_t poolUsed, poolPeak;
+    static uint32_t poolFailures;
+
+    uint16_t findSlot(EventType type) const;
+    static void initPool();
+
+    // Nicht kopierbar (Einträge im Pool gehören genau einem Widget)
+    UIEventHandler(const UIEventHandler&) = delete;
+    UIEventHandler& operator=(const UIEventHandler&) = delete;
 };
 
-#endif // UI_EVENT_HANDLER_H
\ No newline at end of file
+#endif // UI_EVENT_HANDLER_H
@@ -0,0 +1,159 @@
+/**
+ * UIFlexLayout.h
+ *
+ * Constraint-Layout für den Content-Bereich einer Page (Flex-Zeilen/-Spalten + Raster)
+ *
+ * Statt Koordinaten in build() von Hand aus layout.contentX/Y zu rechnen,
+ * beschreibt die Page einen Baum aus Boxen:
+ *
+ *   UIFlexBox* root = arena.create<UIFlexBox>(FlexDirection::ROW, 10, 10);
+ *   UIFlexBox* left = arena.create<UIFlexBox>(FlexDirection::COLUMN, 5);
+ *   root->add(left).grow = 1;                   // Restbreite
+ *   left->add(label);                           // Größe aus dem Text (measure())
+ *   left->add(bar, 150, 25);                    // Feste Größe
+ *   setContentLayout(root);                     // UIPage wendet es an
+ *
+ * Zwei Durchläufe:
+ * - measure(): von unten nach oben, Wunschgröße jedes Eintrags
+ *   (UIElement::measure() - Labels/Buttons kennen ihre Textgröße)
+ * - arrange(): von oben nach unten, Restplatz nach grow verteilen,
+ *   Ausrichtung, setBounds() auf die Elemente
+ *
+ * Ergebnis wird gecacht: layout() mit gleichem Bereich macht nichts, erst
+ * invalidate() (z.B. nach Textänderung mit Auto-Größe) oder ein anderer
+ * Bereich (Content-Bereich geändert) rechnet neu.
+ * Boxen liegen in der Arena der Page, Einträge in einem festen Array pro Box.
+ */
+
+#ifndef UI_FLEX_LAYOUT_H
+#define UI_FLEX_LAYOUT_H
+
+#include <Arduino.h>
+#include "setupConf.h"
+
+class UIElement;
+class UIFlexBox;
+
+// Größe aus measure() statt fest
+static const int16_t LAYOUT_AUTO = -1;
+
+enum class FlexDirection : uint8_t {
+    ROW,            // Einträge nebeneinander
+    COLUMN,         // Einträge untereinander
+    GRID            // Raster mit festen Spalten, zeilenweise gefüllt
+};
+
+// Verteilung auf der Hauptachse (wenn kein Eintrag wächst)
+enum class FlexJustify : uint8_t {
+    START,
+    CENTER,
+    END,
+    SPACE_BETWEEN
+};
+
+// Ausrichtung auf der Querachse (im Raster: innerhalb der Zelle)
+enum class FlexAlign : uint8_t {
+    AUTO,           // Wie die Box (setAlign())
+    START,
+    CENTER,
+    END,
+    STRETCH         // Volle Breite/Höhe (nur bei LAYOUT_AUTO)
+};
+
+// Eintrag einer Box: Element, Unter-Box oder Abstandhalter
+struct LayoutItem {
+    UIElement* element;
+    UIFlexBox* box;
+    int16_t width, height;      // Fest oder LAYOUT_AUTO
+    uint8_t grow;               // Anteil am Restplatz der Hauptachse (0 = fest)
+    FlexAlign align;            // Querachse (AUTO = wie die Box)
+
+    // Ergebnis (Cache)
+    int16_t measuredW, measuredH;
+    int16_t x, y, w, h;
+};
+
+class UIFlexBox {
+public:
+    /**
+     * @param direction ROW, COLUMN oder GRID (dann setColumns())
+     * @param gap Abstand zwischen Einträgen
+     * @param padding Innenabstand an allen Seiten
+     */
+    explicit UIFlexBox(FlexDirection direction = FlexDirection::COLUMN, int16_t gap = 0, int16_t padding = 0);
+
+    /**
+     * Element einfügen
+     * @return Eintrag (grow/align anpassbar), bei vollem Array ein Dummy
+     */
+    LayoutItem& add(UIElement* element, int16_t width = LAYOUT_AUTO, int16_t height = LAYOUT_AUTO);
+    LayoutItem& add(UIFlexBox* box, int16_t width = LAYOUT_AUTO, int16_t height = LAYOUT_AUTO);
+
+    /**
+     * Abstandhalter (grow 1 = schiebt folgende Einträge ans Ende)
+     */
+    LayoutItem& addSpacer(uint8_t grow = 1, int16_t size = 0);
+
+    void setJustify(FlexJustify value) { justify = value; invalidate(); }
+    void setAlign(FlexAlign value) { align = value; invalidate(); }
+    void setColumns(uint8_t count) { columns = count > 0 ? count : 1; invalidate(); }
+
+    /**
+     * Wunschgröße (measure-Durchlauf)
+     */
+    void measure(int16_t* outW, int16_t* outH);
+
+    /**
+     * Einträge im Bereich anordnen (arrange-Durchlauf)
+     */
+    void arrange(int16_t x, int16_t y, int16_t w, int16_t h);
+
+    /**
+     * measure() + arrange() - nur wenn invalidiert oder anderer Bereich
+     * @return true wenn neu berechnet
+     */
+    bool layout(int16_t x, int16_t y, int16_t w, int16_t h);
+
+    /**
+     * Cache verwerfen (dieser Box und aller Unter-Boxen)
+     */
+    void invalidate();
+
+    uint8_t getItemCount() const { return itemCount; }
+    const LayoutItem& getItem(uint8_t index) const { return items[index]; }
+
+    // Statistik (alle Boxen)
+    static uint32_t getMeasureCount() { return measureCount; }
+    static uint32_t getArrangeCount() { return arrangeCount; }
+    static uint32_t getCacheHits() { return cacheHits; }
+
+private:
+    FlexDirection direction;
+    FlexJustify justify;
+    FlexAlign align;
+    int16_t gap;
+    int16_t padding;
+    uint8_t columns;
+
+    LayoutItem items[UI_LAYOUT_MAX_ITEMS];
+    uint8_t itemCount;
+
+    // Cache
+    bool measured;
+    int16_t measuredW, measuredH;
+    bool arranged;
+    int16_t areaX, areaY, areaW, areaH;
+
+    static uint32_t measureCount, arrangeCount, cacheHits;
+    static LayoutItem overflowItem;
+
+    LayoutItem& append();
+    void measureItem(LayoutItem& item);
+    void arrangeFlex(int16_t innerX, int16_t innerY, int16_t innerW, int16_t innerH);
+    void arrangeGrid(int16_t innerX, int16_t innerY, int16_t innerW, int16_t innerH);
+    void place(LayoutItem& item, int16_t x, int16_t y, int16_t w, int16_t h);
+    static void alignCross(FlexAlign align, int16_t fixed, int16_t measured, int16_t space,
+                           int16_t* outOffset, int16_t* outSize);
+};
+
+#endif // UI_FLEX_LAYOUT_H
@@ -0,0 +1,136 @@
+/**
+ * UIFont.h
+ *
+ * Anti-Aliasing-Fonts aus vorgerasterten Atlanten (TFT_eSPI Smooth-Font .vlw)
+ *
+ * - Atlas (Glyph-Metriken + 8-Bit-Alpha-Bitmaps) wird aus einem Flash-Array
+ *   oder von der SD-Karte komplett ins PSRAM geladen
+ * - Glyph-Cache (gemeinsam für alle Fonts, PSRAM): jede Glyphe wird pro
+ *   Vorder-/Hintergrundfarbe einmal gegen den Hintergrund gemischt und als
+ *   RGB565-Zelle (Vorschub × Zeilenhöhe, Display-Byte-Reihenfolge) abgelegt.
+ *   Text zeichnen = ein Block-Transfer pro Zeichen, keine Pixel-Rechtecke wie
+ *   bei skalierten Bitmap-Fonts (setTextSize())
+ * - Ist der Cache voll, wird er komplett geleert (kein LRU-Aufwand pro Glyphe)
+ * - Überhänge außerhalb der Zelle (negativer Versatz, kursive Glyphen) werden
+ *   abgeschnitten
+ */
+
+#ifndef UI_FONT_H
+#define UI_FONT_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "setupConf.h"
+
+class SDCardHandler;
+
+class UIFont {
+public:
+    /**
+     * @param name Anzeigename (wird nicht kopiert)
+     */
+    explicit UIFont(const char* name);
+    ~UIFont();
+
+    /**
+     * Atlas aus dem Speicher laden (z.B. PROGMEM-Array im Flash)
+     * Die Daten werden ins PSRAM kopiert
+     */
+    bool loadFromMemory(const uint8_t* data, size_t size);
+
+    /**
+     * Atlas von der SD-Karte laden (.vlw)
+     */
+    bool loadFromSD(SDCardHandler* sd, const char* path);
+
+    void unload();
+    bool isLoaded() const { return glyphs != nullptr; }
+
+    // Metriken
+    const char* getName() const { return name; }
+    uint16_t getGlyphCount() const { return glyphCount; }
+    int16_t getLineHeight() const { return ascent + descent; }
+    int16_t getAscent() const { return ascent; }
+    size_t getAtlasSize() const { return atlasSize; }
+
+    /**
+     * Breite des Texts in Pixeln (UTF-8)
+     */
+    int16_t textWidth(const char* text) const;
+
+    /**
+     * Text als Glyph-Zellen zeichnen (Display oder Surface, Viewport wird beachtet)
+     * @param x/y Linke obere Ecke der Textzeile
+     * @param bg Hintergrund, gegen den die Kanten gemischt werden
+     * @return Gezeichnete Breite
+     */
+    int16_t drawText(TFT_eSPI* tft, const char* text, int16_t x, int16_t y, uint16_t fg, uint16_t bg);
+
+    /**
+     * Alle Fonts + Glyph-Cache ausgeben
+     */
+    static void printStats();
+    static void clearCache();
+
+    /**
+     * Text-Durchsatz: TFT_eSPI drawString() (skalierter Bitmap-Font in
+     * vergleichbarer Höhe) gegen Glyph-Cache, beide im UIFrameBuffer
+     * @param iterations Anzahl gezeichneter Zeilen pro Verfahren
+     */
+    static void benchmark(TFT_eSPI* tft, UIFont* font, uint16_t iterations = UI_FONT_BENCH_ITERATIONS);
+
+private:
+    struct Glyph {
+        uint32_t code;          // Unicode
+        uint16_t width, height; // Bitmap-Größe
+        int16_t advance;        // Vorschub
+        int16_t dY;             // Oberkante über der Grundlinie
+        int16_t dX;             // Versatz der Bitmap zum Cursor
+        uint32_t offset;        // Bitmap im Atlas
+    };
+
+    // Gemischte Glyphe im Cache
+    struct CacheEntry {
+        const UIFont* font;     // nullptr = frei
+        uint16_t glyph;
+        uint16_t fg, bg;
+        uint16_t width, height;
+        uint16_t* pixels;
+    };
+
+    const char* name;
+    uint8_t* atlas;             // Kompletter Atlas (PSRAM)
+    size_t atlasSize;
+    Glyph* glyphs;
+    uint16_t glyphCount;
+    int16_t asciiIndex[95];     // 0x20-0x7E → Glyph-Index (-1 = fehlt)
+    int16_t fallbackGlyph;      // '?' für fehlende Zeichen
+    int16_t ascent, descent;
+    int16_t spaceAdvance;       // Fehlende Leerzeichen-Glyphe
+
+    // Verkettung aller Fonts
+    UIFont* nextFont;
+    static UIFont* firstFont;
+
+    // Glyph-Cache (gemeinsam)
+    static CacheEntry* cacheEntries;
+    static uint8_t* cachePool;
+    static size_t cacheUsed;
+    static uint16_t cacheCount;
+    static uint32_t cacheHits, cacheMisses, cacheFlushes;
+
+    bool parse();
+    int16_t findGlyph(uint32_t code) const;
+    static uint32_t nextCodepoint(const char** text);
+
+    const uint16_t* getCell(uint16_t glyph, uint16_t fg, uint16_t bg, uint16_t* outW);
+    uint16_t* composeCell(uint16_t glyph, uint16_t fg, uint16_t bg, uint16_t width);
+    static bool ensureCache();
+    static void dropFont(const UIFont* font);
+
+    // Nicht kopierbar (Registry, Cache-Einträge verweisen auf den Font)
+    UIFont(const UIFont&) = delete;
+    UIFont& operator=(const UIFont&) = delete;
+};
+
+#endif // UI_FONT_H
@@ -0,0 +1,118 @@
+/**
+ * UIFrameBuffer.h
+ *
+ * Offscreen-Framebuffer in Display-Größe (RGB565, PSRAM) mit Zähler
+ *
+ * - Gleiche Primitive wie das Display (TFT_eSprite), Widgets zeichnen
+ *   unverändert hinein (UIManager::redirect())
+ * - Zählt Aufrufe pro Primitiv und geschriebene Pixel (nach Clipping)
+ * - Abdeckungs-Bitmap → verschiedene Pixel, Überzeichnung = Pixel / verschiedene
+ * - Grundlage für Render-Benchmark und Golden-Image-Vergleich (PageManager)
+ *
+ * Gezählt werden die virtuellen TFT_eSPI-Primitive: fillRoundRect, drawString
+ * usw. erscheinen als die fillRect/drawFastHLine/drawChar-Aufrufe aus denen
+ * sie bestehen.
+ */
+
+#ifndef UI_FRAME_BUFFER_H
+#define UI_FRAME_BUFFER_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "UISurface.h"
+#include "setupConf.h"
+
+enum class DrawPrimitive : uint8_t {
+    PIXEL,
+    HLINE,
+    VLINE,
+    LINE,
+    RECT,
+    CHAR,
+    IMAGE,
+    COUNT
+};
+
+// Zähler seit resetStats()
+struct UIDrawStats {
+    uint32_t calls[static_cast<int>(DrawPrimitive::COUNT)];
+    uint32_t totalCalls;
+    uint32_t pixels;            // Geschriebene Pixel (mehrfach geschriebene mehrfach)
+    uint32_t uniquePixels;      // Verschiedene Pixel
+
+    float overdraw() const { return uniquePixels > 0 ? (float)pixels / uniquePixels : 0.0f; }
+};
+
+class UIFrameBuffer : public UISurface {
+public:
+    explicit UIFrameBuffer(TFT_eSPI* tft);
+    ~UIFrameBuffer();
+
+    /**
+     * Framebuffer + Abdeckungs-Bitmap anlegen (PSRAM)
+     * @return false wenn kein Speicher
+     */
+    bool begin();
+    void end();
+    bool isReady() const { return coverage != nullptr; }
+
+    /**
+     * Zähler und Abdeckung zurücksetzen (Pixel bleiben erhalten)
+     */
+    void resetStats();
+
+    /**
+     * Zähler abrufen (verschiedene Pixel werden dabei gezählt)
+     */
+    UIDrawStats getStats() const;
+
+    /**
+     * Zähler ausgeben
+     * @param frames Anzahl Frames → Werte pro Frame
+     */
+    static void printStats(const char* label, const UIDrawStats& stats, uint32_t frames = 1);
+    static const char* getPrimitiveName(DrawPrimitive primitive);
+
+    // Pixel (Display-Byte-Reihenfolge, zeilenweise)
+    const uint16_t* getPixels() { return static_cast<const uint16_t*>(getPointer()); }
+    size_t getByteSize() const { return (size_t)DISPLAY_WIDTH * DISPLAY_HEIGHT * sizeof(uint16_t); }
+
+    // CRC32 über alle Pixel
+    uint32_t checksum();
+
+    /**
+     * Mit Referenzbild vergleichen
+     * @param reference Pixel in gleichem Format (getByteSize() Byte)
+     * @param outX/outY/outW/outH Umriss der Abweichungen (optional)
+     * @return Anzahl abweichender Pixel
+     */
+    uint32_t compare(const uint16_t* reference, int16_t* outX, int16_t* outY, int16_t* outW, int16_t* outH);
+
+    // Gezählte Primitive (TFT_eSPI-virtuell)
+    void drawPixel(int32_t x, int32_t y, uint32_t color) override;
+    void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size) override;
+    int16_t drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font) override;
+    int16_t drawChar(uint16_t uniCode, int32_t x, int32_t y) override;
+    void drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color) override;
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) override;
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) override;
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) override;
+    void blit(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) override;
+
+private:
+    static const int COVERAGE_STRIDE = (DISPLAY_WIDTH + 31) / 32;     // Worte pro Zeile
+
+    uint32_t* coverage;         // 1 Bit pro Pixel
+    UIDrawStats stats;
+    uint8_t depth;              // Verschachtelung (innere Aufrufe zählen nicht als Aufruf)
+    bool inLeaf;                // Pixel werden bereits vom äußeren Primitiv gezählt
+
+    void countCall(DrawPrimitive primitive);
+
+    /**
+     * Geschriebene Pixel zählen (nach Viewport-Clipping, wie TFT_eSprite)
+     */
+    void countPixels(int32_t x, int32_t y, int32_t w, int32_t h);
+};
+
+#endif // UI_FRAME_BUFFER_H
@@ -0,0 +1,117 @@
+/**
+ * UIGestureRecognizer.h
+ *
+ * Gesten-Erkennung zwischen TouchManager und UIManager
+ *
+ * Klassifiziert den Touch-Strom (Position + Zeitstempel) in:
+ * - TAP:        Kurzer Touch ohne Bewegung
+ * - LONG_PRESS: Touch gehalten ohne Bewegung (GESTURE_LONG_PRESS_MS)
+ * - PAN:        Bewegung während Touch (inkrementelle dx/dy)
+ * - SWIPE:      Schnelle, gerichtete Bewegung (value = SwipeDirection)
+ * - FLING:      Loslassen mit Geschwindigkeit (vx/vy in px/s)
+ *
+ * Geschwindigkeit: Lineare Regression über die Samples der letzten
+ * GESTURE_VELOCITY_WINDOW_MS (robust gegen einzelne Ausreißer).
+ *
+ * Kinetic-Scrolling: Nach einem FLING kann startKinetic() aufgerufen
+ * werden - update() erzeugt dann abbremsende PAN-Events (value = 1).
+ */
+
+#ifndef UI_GESTURE_RECOGNIZER_H
+#define UI_GESTURE_RECOGNIZER_H
+
+#include <Arduino.h>
+#include <functional>
+#include "UIEventHandler.h"
+#include "setupConf.h"
+
+// Callback für erkannte Gesten
+typedef std::function<void(EventType, EventData*)> GestureCallback;
+
+class UIGestureRecognizer {
+public:
+    UIGestureRecognizer();
+    ~UIGestureRecognizer();
+
+    /**
+     * Callback für erkannte Gesten setzen
+     */
+    void setCallback(GestureCallback callback) { this->callback = callback; }
+
+    /**
+     * Touch-Sample verarbeiten
+     * @param x X-Koordinate
+     * @param y Y-Koordinate
+     * @param pressed true = Touch aktiv, false = losgelassen
+     * @param timestamp Zeitstempel des Samples (millis)
+     */
+    void addSample(int16_t x, int16_t y, bool pressed, unsigned long timestamp);
+
+    /**
+     * Zeitbasierte Gesten (Long-Press, Kinetic) - in jedem Loop aufrufen
+     * @param now Aktuelle Zeit (millis)
+     */
+    void update(unsigned long now);
+
+    /**
+     * Kinetic-Scrolling mit Startgeschwindigkeit starten
+     * @param vx Geschwindigkeit X (px/s)
+     * @param vy Geschwindigkeit Y (px/s)
+     */
+    void startKinetic(float vx, float vy);
+
+    /**
+     * Kinetic-Scrolling stoppen
+     */
+    void stopKinetic() { kinetic = false; }
+
+    /**
+     * Zustand zurücksetzen (z.B. bei Page-Wechsel)
+     */
+    void reset();
+
+    // Status
+    bool isActive() const { return active; }
+    bool isPanning() const { return panning; }
+    bool isKinetic() const { return kinetic; }
+
+private:
+    static const uint8_t HISTORY_SIZE = 8;
+
+    struct Sample {
+        int16_t x;
+        int16_t y;
+        unsigned long t;
+    };
+
+    GestureCallback callback;
+
+    // Sample-Historie (Ringpuffer)
+    Sample history[HISTORY_SIZE];
+    uint8_t historyHead;
+    uint8_t historyCount;
+
+    // Aktueller Touch
+    bool active;
+    bool panning;
+    bool longPressFired;
+    int16_t startX, startY;
+    int16_t lastX, lastY;
+    unsigned long startTime;
+    unsigned long lastSampleTime;
+
+    // Kinetic-Scrolling
+    bool kinetic;
+    float kineticVX, kineticVY;
+    float kineticRestX, kineticRestY;   // Sub-Pixel-Reste
+    unsigned long kineticLastTime;
+
+    void pushHistory(int16_t x, int16_t y, unsigned long t);
+    void estimateVelocity(float* vx, float* vy) const;
+    void finishGesture(unsigned long releaseTime);
+    void updateKinetic(unsigned long now);
+    void emit(EventType type, int16_t x, int16_t y, int16_t dx, int16_t dy,
+              float vx, float vy, int value = 0);
+};
+
+#endif // UI_GESTURE_RECOGNIZER_H
@@ -0,0 +1,165 @@
+/**
+ * UIHitGrid.h
+ *
+ * Räumlicher Index (uniformes Raster) für Touch-Hit-Tests
+ *
+ * Raster über den gesamten Screen (480x320 → 12x8 Zellen à 40px).
+ * Jede Zelle kennt die Elemente, deren Bounds sie überlappen,
+ * in Z-Order (Einfüge-Reihenfolge = Zeichen-Reihenfolge).
+ *
+ * Speicher kompakt (CSR-Format):
+ * - cellStart[c] .. cellStart[c+1] = Bereich in cellItems
+ * - cellItems = Element-Pointer aller Zellen hintereinander
+ *
+ * Neuaufbau nur wenn sich Bounds/Sichtbarkeit/Page ändern
+ * (siehe UIElement::getGeometryRevision()).
+ */
+
+#ifndef UI_HIT_GRID_H
+#define UI_HIT_GRID_H
+
+#include <Arduino.h>
+#include <vector>
+#include "UIElement.h"
+#include "setupConf.h"
+
+class UIHitGrid {
+public:
+    // Raster-Konstanten
+    static const int16_t CELL_SIZE = 40;
+    static const int16_t COLS = (DISPLAY_WIDTH + CELL_SIZE - 1) / CELL_SIZE;
+    static const int16_t ROWS = (DISPLAY_HEIGHT + CELL_SIZE - 1) / CELL_SIZE;
+    static const int16_t CELL_COUNT = COLS * ROWS;
+
+    UIHitGrid();
+    ~UIHitGrid();
+
+    /**
+     * Index aus Element-Liste aufbauen
+     * Nur Elemente mit include(element) == true werden aufgenommen
+     * @param elements Elemente in Z-Order (hinten → vorne)
+     * @param include Filter (z.B. sichtbar + aktuelle Page)
+     */
+    template <typename Filter>
+    void rebuild(const std::vector<UIElement*>& elements, Filter include);
+
+    /**
+     * Oberstes Element an Position finden
+     * @param x X-Koordinate
+     * @param y Y-Koordinate
+     * @return Element oder nullptr
+     */
+    UIElement* hitTest(int16_t x, int16_t y) const;
+
+    /**
+     * Oberstes Element an Position, das accept erfüllt
+     * Abgelehnte Elemente werden übersprungen (Touch fällt nach unten durch)
+     * @param accept Filter bool(UIElement*)
+     */
+    template <typename Filter>
+    UIElement* hitTest(int16_t x, int16_t y, Filter accept) const;
+
+    /**
+     * Alle Elemente an Position besuchen (Z-Order, hinten → vorne)
+     * Nur Elemente deren Bounds den Punkt enthalten
+     * @param fn Callback fn(UIElement*)
+     */
+    template <typename Fn>
+    void forEachAt(int16_t x, int16_t y, Fn fn) const;
+
+    /**
+     * Index leeren
+     */
+    void clear();
+
+    /**
+     * Anzahl Einträge (Element-Zell-Paare)
+     */
+    size_t getEntryCount() const { return cellItems.size(); }
+
+private:
+    std::vector<uint16_t> cellStart;    // CELL_COUNT + 1 Offsets
+    std::vector<UIElement*> cellItems;  // Elemente je Zelle (Z-Order)
+
+    /**
+     * Zellbereich eines Elements berechnen (auf Raster begrenzt)
+     * @return false wenn Element komplett außerhalb
+     */
+    static bool cellRange(UIElement* element, int16_t* c0, int16_t* r0, int16_t* c1, int16_t* r1);
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TEMPLATE-IMPLEMENTATION
+// ═══════════════════════════════════════════════════════════════════════════
+
+template <typename Filter>
+void UIHitGrid::rebuild(const std::vector<UIElement*>& elements, Filter include) {
+    // Pass 1: Einträge pro Zelle zählen
+    std::vector<uint16_t> counts(CELL_COUNT, 0);
+
+    for (auto* element : elements) {
+        int16_t c0, r0, c1, r1;
+        if (!element || !include(element) || !cellRange(element, &c0, &r0, &c1, &r1)) continue;
+
+        for (int16_t r = r0; r <= r1; r++) {
+            for (int16_t c = c0; c <= c1; c++) {
+                counts[r * COLS + c]++;
+            }
+        }
+    }
+
+    // Offsets (Prefix-Summe)
+    cellStart.assign(CELL_COUNT + 1, 0);
+    for (int16_t i = 0; i < CELL_COUNT; i++) {
+        cellStart[i + 1] = cellStart[i] + counts[i];
+    }
+
+    // Pass 2: Elemente einsortieren (Reihenfolge bleibt Z-Order)
+    cellItems.assign(cellStart[CELL_COUNT], nullptr);
+    std::vector<uint16_t> fill(cellStart.begin(), cellStart.end() - 1);
+
+    for (auto* element : elements) {
+        int16_t c0, r0, c1, r1;
+        if (!element || !include(element) || !cellRange(element, &c0, &r0, &c1, &r1)) continue;
+
+        for (int16_t r = r0; r <= r1; r++) {
+            for (int16_t c = c0; c <= c1; c++) {
+                cellItems[fill[r * COLS + c]++] = element;
+            }
+        }
+    }
+}
+
+template <typename Filter>
+UIElement* UIHitGrid::hitTest(int16_t x, int16_t y, Filter accept) const {
+    if (x < 0 || y < 0 || x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) {
+        return nullptr;
+    }
+
+    int16_t cell = (y / CELL_SIZE) * COLS + (x / CELL_SIZE);
+
+    // Von vorne nach hinten (letztes Element = oberstes)
+    for (int i = cellStart[cell + 1] - 1; i >= (int)cellStart[cell]; i--) {
+        UIElement* element = cellItems[i];
+        if (element->isPointInside(x, y) && accept(element)) {
+            return element;
+        }
+    }
+
+    return nullptr;
+}
+
+template <typename Fn>
+void UIHitGrid::forEachAt(int16_t x, int16_t y, Fn fn) const {
+    if (x < 0 || y < 0 || x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) return;
+
+    int16_t cell = (y / CELL_SIZE) * COLS + (x / CELL_SIZE);
+
+    for (uint16_t i = cellStart[cell]; i < cellStart[cell + 1]; i++) {
+        if (cellItems[i]->isPointInside(x, y)) {
+            fn(cellItems[i]);
+        }
+    }
+}
+
+#endif // UI_HIT_GRID_H
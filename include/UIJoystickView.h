@@ -0,0 +1,81 @@
+/**
+ * UIJoystickView.h
+ *
+ * Retained Joystick-Visualisierung (Ring, Fadenkreuz, Knopf)
+ *
+ * Der statische Hintergrund wird einmal in ein Sprite (PSRAM) gerendert.
+ * Bei Positionsänderung wird nur der alte Knopf-Bereich aus dem Sprite
+ * wiederhergestellt und der Knopf neu gezeichnet - ohne Änderung nichts.
+ * Ohne Sprite-Speicher: komplettes Neuzeichnen (wie bisher).
+ */
+
+#ifndef UI_JOYSTICK_VIEW_H
+#define UI_JOYSTICK_VIEW_H
+
+#include "UIElement.h"
+
+class UIJoystickView : public UIElement {
+public:
+    /**
+     * @param size Kantenlänge des quadratischen Bereichs
+     */
+    UIJoystickView(int16_t x, int16_t y, int16_t size);
+    ~UIJoystickView();
+
+    // Override virtuelle Funktionen
+    void draw(TFT_eSPI* tft) override;
+    const char* getTypeName() const override { return "JoystickView"; }
+    void handleTouch(int16_t x, int16_t y, bool pressed) override;
+    bool acceptsTouch() override { return false; }
+    void getDirtyBounds(int16_t* outX, int16_t* outY, int16_t* outW, int16_t* outH) override;
+    void onBackgroundPainted() override { fullRedraw = true; }
+    void onStyleChanged() override;
+
+    /**
+     * Joystick-Position setzen (-100 bis 100)
+     * Nur bei Änderung wird neu gezeichnet
+     */
+    void setValue(int16_t valueX, int16_t valueY);
+    int16_t getValueX() const { return valueX; }
+    int16_t getValueY() const { return valueY; }
+
+    void setKnobColor(uint16_t color);
+
+    static const int16_t KNOB_RADIUS = 8;
+
+private:
+    static const int16_t KNOB_SIZE = 2 * KNOB_RADIUS + 1;
+
+    int16_t valueX, valueY;     // Position (-100 bis 100)
+
+    // Zuletzt gezeichneter Knopf (Mittelpunkt, Screen-Koordinaten)
+    int16_t drawnKnobX, drawnKnobY;
+    bool fullRedraw;            // Hintergrund muss komplett gezeichnet werden
+
+    // Statischer Hintergrund (nullptr → prozedural zeichnen)
+    TFT_eSprite* background;
+    int16_t backgroundW, backgroundH;   // Größe beim Anlegen (setBounds() ändert width/height)
+    bool backgroundFailed;      // Sprite-Anlage fehlgeschlagen, nicht erneut versuchen
+
+    // Sprite passt nicht mehr zur Elementgröße → neu anlegen, alles zeichnen
+    bool backgroundStale() const { return background && (backgroundW != width || backgroundH != height); }
+
+    int16_t ringRadius() const { return width / 2 - 8; }
+    void knobPosition(int16_t* outX, int16_t* outY) const;
+
+    /**
+     * Sprite anlegen bzw. nach Größenänderung neu anlegen
+     */
+    void ensureBackground(TFT_eSPI* tft);
+    void releaseBackground();
+    void drawStatic(TFT_eSPI* tft, int16_t originX, int16_t originY);
+
+    /**
+     * Ausschnitt des Hintergrund-Sprites auf das Ziel kopieren
+     * (Screen-Koordinaten, auf das Element begrenzt)
+     */
+    void restoreBackground(TFT_eSPI* tft, int16_t rx, int16_t ry, int16_t rw, int16_t rh);
+    void drawKnob(TFT_eSPI* tft, int16_t kx, int16_t ky);
+};
+
+#endif // UI_JOYSTICK_VIEW_H
@@ -2,12 +2,22 @@
  * UILabel.h
  * 
  * Label-Element für Text-Anzeige (nur Anzeige, keine Interaktion)
+ * 
+ * setText() mit unverändertem Text löst kein Neuzeichnen aus.
+ * Deckende Labels mit Festbreiten-Font merken sich den gezeichneten Text
+ * (Glyph-Run) und zeichnen bei Änderung nur die geänderten Zeichen neu
+ * ("X: 42" → "X: 43" → nur "3"), solange die Textposition gleich bleibt.
+ *
+ * Mit setFont() wird der Text aus dem Glyph-Cache eines UIFont geblittet
+ * (Anti-Aliasing gegen bgColor - bei transparenten Labels muss bgColor
+ * der Farbe darunter entsprechen).
  */
 
 #ifndef UI_LABEL_H
 #define UI_LABEL_H
 
 #include "UIElement.h"
+#include "UIFont.h"
 
 enum class TextAlignment {
     LEFT,
@@ -22,24 +32,56 @@ public:
 
     // Override virtuelle Funktionen
     void draw(TFT_eSPI* tft) override;
+    const char* getTypeName() const override { return "Label"; }
     void handleTouch(int16_t x, int16_t y, bool pressed) override;
+    bool isOpaque() const override { return !transparent; }
+    bool acceptsTouch() override { return eventHandler.hasHandler(EventType::CLICK); }
+    void getDirtyBounds(int16_t* outX, int16_t* outY, int16_t* outW, int16_t* outH) override;
+    void onBackgroundPainted() override { glyphsValid = false; }
+    void measure(int16_t* outW, int16_t* outH) override;
 
     // Label-spezifische Funktionen
     void setText(const char* text);
     const char* getText() const { return text; }
     void setTextColor(uint16_t color);
+    void setBgColor(uint16_t color);
     void setAlignment(TextAlignment align);
     void setFontSize(uint8_t size);
     void setTransparent(bool transparent);
+    
+    /**
+     * Atlas-Font verwenden (nullptr oder nicht geladen → eingebauter Font mit fontSize)
+     */
+    void setFont(UIFont* font);
 
 private:
     char text[64];              // Label-Text
     TextAlignment alignment;    // Text-Ausrichtung
     uint8_t fontSize;           // Font-Größe (1-7)
     bool transparent;           // Transparenter Hintergrund?
+    UIFont* font;               // Atlas-Font (nullptr = TFT_eSPI-Font)
+    
+    // Glyph-Run Cache (zuletzt gezeichneter Text)
+    char drawnText[64];
+    int16_t drawnLeft;          // Linke Kante des gezeichneten Texts
+    uint8_t glyphAdvance;       // Zeichenbreite (Festbreiten-Font)
+    bool glyphsValid;           // false → nächstes draw() komplett
     
     void drawLabel(TFT_eSPI* tft);
     uint8_t getDatum();         // TFT_eSPI Datum für Alignment
+    int16_t getTextX();         // Anker-X für Alignment
+    
+    /**
+     * Geänderter Zeichenbereich gegenüber dem gezeichneten Text
+     * @return false wenn komplett gezeichnet werden muss
+     */
+    bool getChangedRun(int16_t* firstChar, int16_t* endChar);
+    
+    // Linke Textkante bei Festbreiten-Font
+    int16_t textLeft(size_t length);
+    
+    // Teilbereich zeichnen (nur geänderte Zeichen)
+    void drawRun(TFT_eSPI* tft, int16_t firstChar, int16_t endChar);
 };
 
 #endif // UI_LABEL_H
\ No newline at end of file
@@ -18,6 +18,11 @@
  * - Header/Footer werden EINMAL erstellt und bleiben fix
  * - Nur Content-Bereich wird bei Page-Wechsel aktualisiert
  * - Alle Widgets (Buttons, Icons) nur 1x im Speicher
+ * - Änderungserkennung: Titel, Zurück-Button, Battery und Footer merken sich
+ *   den dargestellten Wert, gezeichnet wird nur ein geändertes Feld.
+ *   Die Hintergründe von Header/Footer werden einmal in init() gezeichnet,
+ *   danach nur noch über den Compositor (Damage-Bereich), nie pauschal
+ *   beim Seitenwechsel
  */
 
 #ifndef UI_LAYOUT_H
@@ -35,6 +40,26 @@
 // Forward declaration
 class PageManager;
 
+/**
+ * Felder mit Änderungserkennung
+ */
+enum class LayoutField : uint8_t {
+    TITLE,
+    BACK_BUTTON,
+    BATTERY,
+    FOOTER,
+    COUNT
+};
+
+/**
+ * Statistik der Änderungserkennung
+ */
+struct LayoutStats {
+    uint32_t changed[(uint8_t)LayoutField::COUNT];      // Neu gezeichnet
+    uint32_t unchanged[(uint8_t)LayoutField::COUNT];    // Gleicher Wert → nichts gezeichnet
+    uint32_t repaints;                                  // drawHeader()/drawFooter()
+};
+
 /**
  * Layout-Bereiche
  */
@@ -76,12 +101,15 @@ public:
     void setPageManager(PageManager* pm);
 
     /**
-     * Header-Bereich zeichnen (Hintergrund + Widgets)
+     * Header-Bereich komplett neu zeichnen (Hintergrund + Widgets)
+     * Nur nötig wenn direkt darüber gezeichnet wurde - der Seitenwechsel
+     * braucht es nicht. Markiert den Bereich als Damage, gezeichnet wird
+     * im nächsten Frame
      */
     void drawHeader();
 
     /**
-     * Footer-Bereich zeichnen (Hintergrund + Widgets)
+     * Footer-Bereich komplett neu zeichnen (wie drawHeader())
      */
     void drawFooter();
 
@@ -106,6 +134,7 @@ public:
 
     /**
      * Battery-Icon aktualisieren (in loop() alle 2 Sekunden aufrufen)
+     * Zeichnet nur wenn sich Prozent oder Farbe geändert haben
      */
     void updateBattery();
 
@@ -122,6 +151,12 @@ public:
     const LayoutBounds& getContentBounds() const { return contentBounds; }
     const LayoutBounds& getFooterBounds() const { return footerBounds; }
 
+    /**
+     * Statistik der Änderungserkennung
+     */
+    const LayoutStats& getStats() const { return stats; }
+    void printStats();
+
     // Layout-Konstanten
     static const int16_t HEADER_HEIGHT = 40;
     static const int16_t FOOTER_HEIGHT = 20;
@@ -149,6 +184,15 @@ private:
     // Footer Widgets
     UILabel* lblFooter;             // Footer-Text (zentriert)
     
+    uint16_t contentColor;          // Letzte Content-Hintergrundfarbe
+    
+    // Zuletzt dargestellter Zustand (Titel/Footer-Text stehen im Label)
+    int backTarget;                 // Ziel des Zurück-Buttons (-1 = keins)
+    int16_t batteryPercent;         // Angezeigte Prozent (-1 = noch keine)
+    uint16_t batteryColor;          // Angezeigte Hintergrundfarbe
+    
+    LayoutStats stats;
+    
     bool initialized;               // Initialisierungs-Flag
     
     /**
@@ -158,18 +202,32 @@ private:
     
     /**
      * Header Hintergrund zeichnen
+     * @param target Display oder Sprite-Tile des Compositors
      */
-    void drawHeaderBackground();
+    void drawHeaderBackground(TFT_eSPI* target);
     
     /**
      * Footer Hintergrund zeichnen
+     * @param target Display oder Sprite-Tile des Compositors
+     */
+    void drawFooterBackground(TFT_eSPI* target);
+    
+    /**
+     * Hintergrund für Damage-Bereich (BackgroundPainter des UIManagers)
+     * Clipping ist bereits gesetzt → Bereiche komplett zeichnen
+     */
+    void paintBackground(TFT_eSPI* target, int16_t x, int16_t y, int16_t w, int16_t h);
+    
+    /**
+     * Hintergrundfarbe des Battery-Icons für den Ladezustand
      */
-    void drawFooterBackground();
+    uint16_t getBatteryColor(uint8_t percent) const;
     
     /**
-     * Battery-Icon Farbe aktualisieren
+     * Ergebnis der Änderungserkennung zählen
+     * @return changed (zum direkten Weiterverwenden)
      */
-    void updateBatteryColor(uint8_t percent);
+    bool countField(LayoutField field, bool changed);
     
     /**
      * Sleep-Button Callback
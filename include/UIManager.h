@@ -2,6 +2,33 @@
  * UIManager.h
  * 
  * UI-Manager - Verwaltet alle UI-Elemente
+ * 
+ * Widget-Baum: Wurzel-Container mit Top-Level-Elementen (Header/Footer)
+ * und Page-Containern. Der Baum wird bei Änderung zu einer Zeichenliste
+ * in Z-Order abgeflacht - Kinder versteckter Container fehlen darin, eine
+ * versteckte Page kostet beim Zeichnen und Hit-Test also nichts.
+ * Clip-Bereiche der Container werden dabei an die Kinder weitergegeben.
+ * 
+ * drawUpdates() arbeitet als Damage-Compositor:
+ * - Geänderte Elemente melden ihre Bounds (alte + neue) als Damage
+ * - Damage-Rechtecke werden vereinigt (UIDamageTracker)
+ * - Pro Rechteck: ggf. Hintergrund füllen, dann alle betroffenen
+ *   Elemente in Z-Order neu zeichnen, auf das Rechteck geclippt
+ * - Gepushte Pixel pro Frame werden gezählt (getRenderStats())
+ *
+ * Optional (setSpriteRendering()): Rechtecke werden in einem PSRAM-Sprite
+ * komplett zusammengesetzt (Hintergrund + alle Elemente) und pro Tile mit
+ * einem einzigen (DMA-)Transfer gepusht → kein Flackern, weniger Transaktionen.
+ * Mit DMA gibt es zwei Tiles (Ping-Pong): das nächste wird gerendert während
+ * das vorherige überträgt. Asynchron (setAsyncFlush()) kehrt drawUpdates()
+ * vor dem Ende des letzten Transfers zurück → isFlushBusy() / waitFlush().
+ *
+ * Animationen (getAnimator()) laufen im Frame-Takt vor drawUpdates() und
+ * ändern nur Widget-Eigenschaften - gezeichnet wird über den Compositor.
+ *
+ * Render-Profil: jedes draw() wird pro Element gemessen (Aufrufe, Zeit,
+ * Pixel) → printPerfStats(). Das Overlay (setPerfOverlay()) umrandet die
+ * im letzten Frame neu gezeichneten Rechtecke direkt auf dem Display.
  */
 
 #ifndef UI_MANAGER_H
@@ -11,38 +38,283 @@
 #include <TFT_eSPI.h>
 #include <vector>
 #include "UIElement.h"
+#include "UIContainer.h"
 #include "TouchManager.h"
+#include "UIHitGrid.h"
+#include "UIGestureRecognizer.h"
+#include "UIDamageTracker.h"
+#include "UISurface.h"
+#include "UIAnimator.h"
+
+// Hintergrund unter Elementen zeichnen (Clip ist bereits gesetzt, tft kann ein Sprite sein)
+typedef std::function<void(TFT_eSPI* tft, int16_t x, int16_t y, int16_t w, int16_t h)> BackgroundPainter;
+
+// Compositor-Statistik
+struct UIRenderStats {
+    uint32_t frames;            // Frames mit Damage
+    uint32_t lastPixels;        // Gepushte Pixel im letzten Frame
+    uint32_t maxPixels;         // Maximum pro Frame
+    uint64_t totalPixels;       // Summe seit resetRenderStats()
+    uint32_t lastDrawUs;        // Dauer des letzten Frames
+    uint8_t lastRects;          // Damage-Rechtecke im letzten Frame (nach Merge)
+    uint16_t lastElements;      // Gezeichnete Elemente im letzten Frame
+    uint8_t lastTiles;          // Gepushte Sprite-Tiles im letzten Frame (0 = direkt)
+    uint8_t lastDeferred;       // Auf den nächsten Frame verschobene Rechtecke
+    uint32_t deferredFrames;    // Frames mit erschöpftem Budget
+};
+
+/**
+ * Sprite-Tile für den Compositor
+ * Widgets zeichnen in Screen-Koordinaten (Tile-Ursprung = Screen-Position),
+ * der Clip darf zusätzlich enger sein (Container-Clip im Tile)
+ */
+class UITileSprite : public UISurface {
+public:
+    explicit UITileSprite(TFT_eSPI* tft) : UISurface(tft) {}
+    
+    /**
+     * @param originX/originY Screen-Position der linken oberen Tile-Ecke
+     * @param cx/cy/cw/ch Clip in Screen-Koordinaten
+     */
+    void setScreenClip(int16_t originX, int16_t originY, int16_t cx, int16_t cy, int16_t cw, int16_t ch);
+};
 
 class UIManager {
 public:
     UIManager(TFT_eSPI* tft, TouchManager* touch);
     ~UIManager();
 
+    /**
+     * Element als Top-Level-Knoten hinzufügen (Z-Order: Einfüge-Reihenfolge)
+     * Container bringen ihren Teilbaum mit
+     */
     bool add(UIElement* element);
+    
+    /**
+     * Element (samt Teilbaum) aus dem Baum entfernen, Bereich wird freigelegt
+     */
     bool remove(UIElement* element);
     void clear();
+    
+    // Wurzel des Widget-Baums
+    UIContainer* getRoot() { return &root; }
+    
+    // Tweens für Widget-Eigenschaften (werden bei remove() des Owners abgebrochen)
+    UIAnimator* getAnimator() { return &animator; }
+    
     void update();
     void drawAll();
-    void drawUpdates();
+    
+    /**
+     * Geänderte Bereiche zeichnen (Damage-Compositor)
+     * @param budgetUs Max. Renderzeit - nach Ablauf bleiben restliche
+     *                 Damage-Rechtecke für den nächsten Aufruf (0 = alles)
+     */
+    void drawUpdates(uint32_t budgetUs = 0);
+    
+    // Noch Damage aus einem vorherigen Frame offen?
+    bool hasPendingDamage() const { return !damage.isEmpty(); }
+    
+    /**
+     * Ganzen Screen neu aufbauen (beim nächsten drawUpdates())
+     * Hintergrund: BackgroundPainter falls gesetzt, sonst color
+     */
     void clearScreen(uint16_t color = COLOR_BLACK);
+    
+    /**
+     * Bereich neu zeichnen lassen (Hintergrund + alle Elemente darin)
+     * Für Inhalte die direkt gezeichnet wurden und überschrieben werden sollen
+     */
+    void invalidate(int16_t x, int16_t y, int16_t w, int16_t h);
+    
+    /**
+     * Hintergrund-Zeichner für freigelegte Bereiche setzen
+     * (z.B. UILayout: Header/Footer/Content-Hintergrund)
+     */
+    void setBackgroundPainter(BackgroundPainter painter) { backgroundPainter = painter; }
+    
+    /**
+     * Sprite-Rendering ein-/ausschalten
+     * Legt das Tile im PSRAM an (UI_SPRITE_TILE_PIXELS), DMA falls UI_SPRITE_DMA
+     * @return false wenn kein Speicher → bleibt beim direkten Zeichnen
+     */
+    bool setSpriteRendering(bool enable);
+    bool isSpriteRendering() const { return tileSprites[0] != nullptr; }
+    bool isTileDMA() const { return tileDMA; }
+    
+    /**
+     * Asynchroner Flush: drawUpdates() wartet nicht auf den letzten DMA-Transfer
+     * Der Aufrufer muss den Display-Bus halten bis isFlushBusy() false ist
+     */
+    void setAsyncFlush(bool enable) { waitFlush(); asyncFlush = enable; }
+    bool isAsyncFlush() const { return asyncFlush; }
+    
+    /**
+     * Zeichnen in ein Offscreen-Ziel in Display-Größe umleiten (z.B. UIFrameBuffer)
+     * Solange aktiv: direktes Zeichnen ohne Sprite-Tiles, das Display bleibt unberührt
+     * @param target Ziel oder nullptr = zurück zum Display (Screen wird neu aufgebaut)
+     */
+    void redirect(TFT_eSPI* target);
+    bool isRedirected() const { return display != nullptr; }
+    
+    /**
+     * Zeichenfenster: Damage wird darauf beschnitten, Teile außerhalb werden
+     * verworfen (z.B. Page-Slide: nur bereits aufgedeckte Spalten dürfen in
+     * den Bildspeicher, der Rest wird noch als alte Page angezeigt).
+     * Der Aufrufer invalidiert verworfene Bereiche später selbst.
+     */
+    void setDrawWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+    void clearDrawWindow() { drawWindowActive = false; }
+    bool hasDrawWindow() const { return drawWindowActive; }
+    
+    // Läuft noch ein Tile-Transfer?
+    bool isFlushBusy();
+    
+    // Auf laufenden Tile-Transfer warten (vor direktem Zeichnen)
+    void waitFlush();
+    
+    // Compositor-Statistik
+    const UIRenderStats& getRenderStats() const { return renderStats; }
+    void resetRenderStats();
+    
+    /**
+     * Render-Profil aller Elemente im Baum (auch versteckte Pages),
+     * sortiert nach Gesamtzeit
+     */
+    void printPerfStats();
+    void resetPerfStats();
+    
+    /**
+     * Damage-Overlay: Rechtecke des letzten Frames umranden
+     * (UI_PERF_OVERLAY_COLOR, wird im nächsten Frame wieder entfernt)
+     */
+    void setPerfOverlay(bool enable);
+    bool isPerfOverlay() const { return perfOverlay; }
+    
+    // Knoten der Zeichenliste (ohne Kinder versteckter Container)
     UIElement* getElement(int index);
-    int getElementCount() const { return elements.size(); }
+    int getElementCount();
     void printDebugInfo();
     
-    // Aktuelle Page setzen (für Touch-Event-Filterung)
-    void setCurrentPage(void* page);
+    /**
+     * Aktuelle Page setzen (Page-Container)
+     * Versteckte Top-Level-Knoten gelten als überdeckt (UIPage::show()
+     * löscht den Content-Bereich), laufender Touch wird verworfen
+     */
+    void setCurrentPage(UIContainer* pageRoot);
+    
+    /**
+     * Handler für Gesten die kein Element konsumiert hat
+     * (z.B. PageManager: Swipe → Seitenwechsel)
+     */
+    void setGestureHandler(GestureCallback handler) { gestureHandler = handler; }
+    
+    /**
+     * Hit-Test Benchmark: lineare Suche (oberstes Element von hinten) vs.
+     * Raster-Index mit denselben Filtern wie dispatchTouch()
+     * Erstellt temporär widgetCount Buttons/Labels in einer eigenen Arena
+     * (nicht im UIManager registriert), vergleicht das Ziel pro Query
+     * @param widgetCount Anzahl Test-Widgets
+     * @param queries Anzahl Hit-Tests pro Verfahren
+     * @return true wenn beide Verfahren für jede Query dasselbe Ziel liefern
+     */
+    static bool benchmarkHitTest(int widgetCount, int queries = 1000);
+    
+    /**
+     * Event-Handler-Pool + Objektgröße pro Widget-Typ (vorher/nachher)
+     * und Summe über alle Elemente im Baum
+     */
+    void printWidgetSizes();
+    
+    /**
+     * Theme wechseln (UITheme): nur Elemente deren Style-Eintrag sich
+     * geändert hat werden neu gezeichnet
+     * @return Anzahl neu zu zeichnender Elemente
+     */
+    int setTheme(ThemeId theme);
 
 private:
-    TFT_eSPI* tft;
+    TFT_eSPI* tft;                  // Zeichenziel (Display oder redirect()-Ziel)
+    TFT_eSPI* display;              // Display während redirect(), sonst nullptr
     TouchManager* touch;
-    std::vector<UIElement*> elements;
     bool lastTouchState;
     int16_t lastTouchX;
     int16_t lastTouchY;
-    void* currentPage;  // Aktuelle sichtbare Page
+    UIContainer* currentPage;  // Container der aktuellen Page
+    
+    // Widget-Baum und abgeflachte Zeichenliste (Z-Order, hinten → vorne)
+    // subtreeEnd[i]: Index hinter dem letzten Nachfahren von elements[i]
+    UIContainer root;
+    std::vector<UIElement*> elements;
+    std::vector<uint16_t> subtreeEnd;
+    uint32_t treeRevision;
+    bool treeDirty;
+    
+    // Hit-Test Index (nur sichtbare Elemente der Zeichenliste)
+    UIHitGrid hitGrid;
+    bool hitGridDirty;
+    uint32_t hitGridRevision;
+    
+    // Elemente die den laufenden Touch erhalten haben (bekommen Move/Release auch außerhalb)
+    std::vector<UIElement*> touchTargets;
+    
+    // Animationen
+    UIAnimator animator;
+    
+    // Gesten-Erkennung
+    UIGestureRecognizer gestures;
+    GestureCallback gestureHandler;
+    std::vector<UIElement*> kineticTargets;  // Empfänger von Kinetic-PAN nach FLING
+    
+    // Damage-Compositor
+    UIDamageTracker damage;
+    BackgroundPainter backgroundPainter;
+    uint16_t backgroundColor;
+    UIRenderStats renderStats;
+    
+    // Retained-Widgets mit verkleinertem Damage im laufenden Frame
+    struct RetainedDamage {
+        UIElement* element;
+        int16_t x, y, w, h;     // Gemeldeter Teilbereich (getDirtyBounds)
+        bool drawn;             // In diesem Frame bereits gezeichnet
+    };
+    std::vector<RetainedDamage> retainedDamage;
+    
+    // Sprite-Rendering (tileSprites[0] == nullptr → direkt auf das Display)
+    UITileSprite* tileSprites[2];   // [1] nur mit DMA (Ping-Pong)
+    uint8_t activeTile;             // Nächstes Tile zum Rendern
+    bool tileDMA;
+    bool asyncFlush;
+    
+    // Zeichenfenster (setDrawWindow())
+    bool drawWindowActive;
+    int16_t windowX, windowY, windowW, windowH;
+    
+    // Damage-Overlay (zuletzt umrandete Rechtecke)
+    bool perfOverlay;
+    DamageRect overlayRects[UI_DAMAGE_MAX_RECTS];
+    uint8_t overlayCount;
     
+    void ensureTree();
+    void flattenTree(UIContainer* container, bool clip, int16_t cx, int16_t cy, int16_t cw, int16_t ch);
+    void collectDamage();
+    void compose(uint32_t budgetUs);
+    uint32_t composeDirect(const DamageRect& rect, uint16_t* drawn);
+    uint32_t composeTiles(const DamageRect& rect, uint16_t* drawn, uint8_t* tiles);
+    uint16_t drawElements(TFT_eSPI* target, uint16_t first, int16_t x, int16_t y, int16_t w, int16_t h,
+                          bool backgroundPainted, uint32_t* pixels);
+    void setDrawClip(TFT_eSPI* target, int16_t originX, int16_t originY,
+                     int16_t x, int16_t y, int16_t w, int16_t h);
+    bool ensureTile(TFT_eSprite* tile, int16_t width);
+    void pushTile(TFT_eSprite* tile, int16_t x, int16_t y, int16_t w, int16_t h);
+    void eraseOverlay();
+    void drawOverlay();
+    void ensureHitGrid();
+    void captureTarget(UIElement* element);
+    void forgetTargets(UIElement* subtree);
+    void dispatchGesture(EventType type, EventData* data);
+    void dispatchTouch(int16_t x, int16_t y, bool pressed, unsigned long timestamp);
     void handleElementTouch(UIElement* element, int16_t x, int16_t y, bool pressed);
-    bool shouldProcessElement(UIElement* element);
 };
 
 #endif // UI_MANAGER_H
\ No newline at end of file
@@ -26,6 +26,9 @@
 #include <vector>
 #include "UIManager.h"
 #include "UIElement.h"
+#include "UIContainer.h"
+#include "UIArena.h"
+#include "UIFlexLayout.h"
 
 // Forward declarations
 class UILayout;
@@ -56,7 +59,8 @@ public:
     virtual ~UIPage();
 
     /**
-     * Seite erstellen (wird beim ersten Anzeigen aufgerufen)
+     * Seite erstellen (wird beim ersten Anzeigen aufgerufen,
+     * nach unload() erneut - zwischengespeicherten UI-Zustand dort zurücksetzen)
      * MUSS in abgeleiteten Klassen implementiert werden!
      * 
      * WICHTIG: Nur Content-Widgets erstellen (Y-Position >= 40)!
@@ -67,17 +71,58 @@ public:
      * Seite anzeigen
      * - UILayout aktualisieren (Titel, Zurück-Button, Battery-Icon)
      * - Content-Bereich löschen
-     * - Content-Elemente sichtbar machen
+     * - Content-Container sichtbar machen
      */
     void show();
 
     /**
      * Seite verstecken
-     * - Content-Elemente verstecken
+     * - Content-Container verstecken (ganzer Teilbaum)
      * - Button-States zurücksetzen
      */
     void hide();
     
+    /**
+     * Seite entladen (nur wenn nicht sichtbar)
+     * Teilbaum aus dem UIManager lösen, alle Widgets der Arena in einem
+     * Schritt freigeben - nächstes show() baut die Seite neu
+     * @return false wenn sichtbar
+     */
+    bool unload();
+
+    /**
+     * Bereits gebaut?
+     */
+    bool isBuilt() const { return built; }
+
+    /**
+     * Widget-Speicher der Seite (für Diagnose)
+     */
+    const UIArena& getArena() const { return arena; }
+
+    // Aufbau-/Abbau-Statistik
+    uint16_t getBuildCount() const { return buildCount; }
+    uint32_t getLastBuildUs() const { return lastBuildUs; }
+    uint32_t getLastUnloadUs() const { return lastUnloadUs; }
+    uint32_t getLastLayoutUs() const { return lastLayoutUs; }
+
+    /**
+     * Content-Bereich ändern (z.B. Footer ausgeblendet)
+     * Gebaute Pages ordnen ihr Flex-Layout neu an, ohne build()
+     */
+    void setContentBounds(int16_t x, int16_t y, int16_t w, int16_t h);
+
+    /**
+     * Flex-Layout auf den Content-Bereich anwenden (gecacht, siehe UIFlexBox::layout())
+     * @return true wenn neu berechnet
+     */
+    bool applyLayout();
+
+    /**
+     * Flex-Layout neu messen (z.B. nach Textänderung eines Auto-Eintrags)
+     */
+    void invalidateLayout();
+
     /**
      * Hook-Methode beim Verstecken
      * Kann in abgeleiteten Klassen überschrieben werden
@@ -95,6 +140,13 @@ public:
      */
     virtual void update();
 
+    /**
+     * Zeichnet update() direkt aufs Display (statt nur Widget-Setter)?
+     * Dann wartet der PageManager vorher auf den laufenden Tile-Transfer,
+     * sonst läuft der asynchrone Flush weiter bis draw() ihn abholt
+     */
+    virtual bool drawsInUpdate() const { return false; }
+
     /**
      * Seitenname abrufen
      */
@@ -112,6 +164,11 @@ public:
      */
     void setBackButton(bool enabled, int targetPageId = -1);
 
+    /**
+     * Content-Container (Wurzel des Page-Teilbaums)
+     */
+    UIContainer* getContent() { return &content; }
+
     /**
      * UILayout Instanz setzen (wird von PageManager aufgerufen)
      * @param uiLayout UILayout Pointer
@@ -129,25 +186,38 @@ protected:
     TFT_eSPI* tft;              // Display
     UILayout* uiLayout;         // Layout (Header/Footer) - von PageManager gesetzt
     PageManager* pageManager;   // Page Manager (für Navigation)
+    UIContainer content;        // Teilbaum der Page (Content-Bereich, geclippt)
+    UIArena arena;              // Widgets der Page: arena.create<UILabel>(...) statt new
     
     char pageName[32];          // Seitenname
     bool visible;               // Sichtbar?
     bool built;                 // Bereits gebaut?
+    uint16_t buildCount;        // Anzahl build()-Aufrufe
+    uint32_t lastBuildUs;       // Dauer des letzten Aufbaus
+    uint32_t lastUnloadUs;      // Dauer des letzten Abbaus
+    uint32_t lastLayoutUs;      // Dauer des letzten measure/arrange
+    UIFlexBox* contentLayout;   // Wurzel des Flex-Layouts (Arena), nullptr = Koordinaten von Hand
     PageLayout layout;          // Layout-Konfiguration (Content-Bereich)
     
     // Zurück-Button Konfiguration
     bool hasBackButton;         // Zurück-Button aktiviert?
     int backButtonTarget;       // Ziel-Seite
     
-    // Content-Elemente (von abgeleiteten Klassen verwaltet)
+    // Content-Elemente (von abgeleiteten Klassen verwaltet, Reihenfolge wie hinzugefügt)
     std::vector<UIElement*> contentElements;
     
     /**
-     * Element zum Content hinzufügen
+     * Element zum Content-Container hinzufügen
      * @param element UI-Element
      */
     void addContentElement(UIElement* element);
     
+    /**
+     * Flex-Layout des Content-Bereichs setzen (in build(), Boxen aus der Arena)
+     * Wird nach build() und bei Änderung des Content-Bereichs angewendet
+     */
+    void setContentLayout(UIFlexBox* root) { contentLayout = root; }
+    
     /**
      * Standard-Layout initialisieren (Content-Bereich)
      */
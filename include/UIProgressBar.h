@@ -16,7 +16,9 @@ public:
 
     // Override virtuelle Funktionen
     void draw(TFT_eSPI* tft) override;
+    const char* getTypeName() const override { return "ProgressBar"; }
     void handleTouch(int16_t x, int16_t y, bool pressed) override;
+    bool acceptsTouch() override { return eventHandler.hasHandler(EventType::CLICK); }
 
     // ProgressBar-spezifische Funktionen
     void setValue(int value);           // Wert setzen (0-100)
@@ -27,7 +29,6 @@ public:
 
 private:
     int value;                  // Aktueller Wert (0-100)
-    uint16_t barColor;          // Farbe des Balkens
     bool showText;              // Text anzeigen?
     bool showPercentage;        // Prozent-Zeichen anzeigen?
     
@@ -20,7 +20,9 @@ public:
 
     // Override virtuelle Funktionen
     void draw(TFT_eSPI* tft) override;
+    const char* getTypeName() const override { return "RadioButton"; }
     void handleTouch(int16_t x, int16_t y, bool pressed) override;
+    bool isOpaque() const override { return false; }  // Label ohne Hintergrund
 
     // RadioButton-spezifische Funktionen
     void setSelected(bool selected);
@@ -34,11 +36,13 @@ public:
     // Gruppe setzen (intern verwendet)
     void setGroup(UIRadioGroup* grp) { group = grp; }
 
+protected:
+    StyleState getStyleState() const override { return enabled ? StyleState::NORMAL : StyleState::DISABLED; }
+
 private:
     char label[32];             // Label-Text
     bool selected;              // Selected-Status
     bool wasInside;             // War Touch beim letzten Mal innerhalb?
-    uint16_t dotColor;          // Farbe des Punktes
     int16_t circleSize;         // Größe des Kreises
     int value;                  // Wert (für Identifikation)
     UIRadioGroup* group;        // Gruppe (für Deselection)
@@ -16,7 +16,10 @@ public:
 
     // Override virtuelle Funktionen
     void draw(TFT_eSPI* tft) override;
+    const char* getTypeName() const override { return "Slider"; }
     void handleTouch(int16_t x, int16_t y, bool pressed) override;
+    bool handleGesture(EventType type, EventData* data) override;
+    void getPaintBounds(int16_t* outX, int16_t* outY, int16_t* outW, int16_t* outH) override;
 
     // Slider-spezifische Funktionen
     void setValue(int value);           // Wert setzen (0-100)
@@ -27,10 +30,12 @@ public:
     bool isDragging() const { return dragging; }
 
 private:
+    static const int16_t VALUE_AREA_WIDTH = 40;   // Wert-Anzeige rechts neben dem Slider
+    static const int16_t VALUE_TEXT_HEIGHT = 16;  // Textgröße 2
+    
     int value;                  // Aktueller Wert (0-100)
     bool dragging;              // Wird gerade gezogen?
     uint16_t knobColor;         // Farbe des Schiebereglers
-    uint16_t barColor;          // Farbe des gefüllten Balkens
     bool showValue;             // Wert anzeigen?
     int knobRadius;             // Radius des Knobs
     
@@ -0,0 +1,51 @@
+/**
+ * UISurface.h
+ *
+ * Basisklasse für Offscreen-Zeichenziele (Sprite-Tiles, Framebuffer)
+ *
+ * Widgets zeichnen über TFT_eSPI* - die Grundprimitive (fillRect, drawPixel,
+ * drawChar, ...) sind virtuell und landen im Sprite. pushImage() ist in
+ * TFT_eSPI nicht virtuell und würde über den Display-Bus gehen → Pixel-Blöcke
+ * laufen über UISurface::push(), das Surfaces in der Registry erkennt.
+ */
+
+#ifndef UI_SURFACE_H
+#define UI_SURFACE_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+class UISurface : public TFT_eSprite {
+public:
+    explicit UISurface(TFT_eSPI* tft);
+    virtual ~UISurface();
+
+    /**
+     * RGB565-Block in die Surface kopieren (Viewport/Clip wird beachtet)
+     * @param data Pixel in Display-Byte-Reihenfolge (wie im Sprite)
+     */
+    virtual void blit(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+
+    /**
+     * Zeichenziel als Surface erkennen
+     * @return nullptr wenn target das Display ist
+     */
+    static UISurface* find(TFT_eSPI* target);
+
+    /**
+     * RGB565-Block auf ein beliebiges Ziel (Display oder Surface) kopieren
+     * @param data Pixel in Display-Byte-Reihenfolge
+     */
+    static void push(TFT_eSPI* target, int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+
+private:
+    // Verkettung aller Surfaces
+    UISurface* nextSurface;
+    static UISurface* firstSurface;
+
+    // Nicht kopierbar (Registry)
+    UISurface(const UISurface&) = delete;
+    UISurface& operator=(const UISurface&) = delete;
+};
+
+#endif // UI_SURFACE_H
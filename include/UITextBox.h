@@ -1,17 +1,26 @@
 /**
  * UITextBox.h
- * 
+ *
  * TextBox-Element für mehrzeilige Text-Anzeige
- * - Automatischer Zeilenumbruch
- * - Vertikales Scrolling
+ * - Automatischer Zeilenumbruch (nur der neu angehängte Text wird umbrochen)
+ * - Vertikales Scrolling (PAN-Geste, Kinetic-Scrolling nach FLING)
  * - Nur Anzeige (read-only)
+ *
+ * Zeilen liegen in einem Ringpuffer fester Größe (UI_TEXTBOX_BUFFER_SIZE
+ * Zeichen, UI_TEXTBOX_MAX_LINES Zeilen) - kein Heap pro Zeile, bei vollem
+ * Puffer fallen die ältesten Zeilen heraus.
+ *
+ * Retained: der Textbereich wird in einem Sprite (PSRAM) gepuffert. Beim
+ * Anhängen/Scrollen wird der Sprite-Inhalt verschoben und nur die neu
+ * sichtbaren Zeilen gerendert. Ohne Sprite-Speicher werden die betroffenen
+ * Zeilen direkt gezeichnet.
  */
 
 #ifndef UI_TEXTBOX_H
 #define UI_TEXTBOX_H
 
 #include "UIElement.h"
-#include <vector>
+#include "setupConf.h"
 
 class UITextBox : public UIElement {
 public:
@@ -20,7 +29,11 @@ public:
 
     // Override virtuelle Funktionen
     void draw(TFT_eSPI* tft) override;
+    const char* getTypeName() const override { return "TextBox"; }
     void handleTouch(int16_t x, int16_t y, bool pressed) override;
+    bool handleGesture(EventType type, EventData* data) override;
+    void getDirtyBounds(int16_t* outX, int16_t* outY, int16_t* outW, int16_t* outH) override;
+    void onBackgroundPainted() override { fullRedraw = true; }
 
     // TextBox-spezifische Funktionen
     void setText(const char* text);             // Text setzen (mit Auto-Wrap)
@@ -33,7 +46,13 @@ public:
     void setLineHeight(int height);             // Zeilenhöhe setzen
     void setFontSize(uint8_t size);             // Font-Größe (1-4)
     void setPadding(int padding);               // Innenabstand
-    
+
+    /**
+     * Am Ende bleiben: steht die Ansicht beim Anhängen am Ende,
+     * scrollt sie mit (Log-Verhalten, Standard: an)
+     */
+    void setAutoScroll(bool enabled) { autoScroll = enabled; }
+
     // Scroll-Funktionen
     void scrollUp(int lines = 1);
     void scrollDown(int lines = 1);
@@ -42,25 +61,89 @@ public:
     bool canScrollUp() const { return scrollY > 0; }
     bool canScrollDown() const { return scrollY < getMaxScroll(); }
 
+    // Puffer-Statistik
+    int getLineCount() const { return lineCount; }
+    uint32_t getDroppedLines() const { return droppedLines; }   // Herausgefallene Zeilen seit clear()
+
 private:
-    std::vector<String> lines;  // Text-Zeilen
-    int scrollY;                // Scroll-Offset (in Zeilen)
+    static const int16_t INDICATOR_WIDTH = 3;
+
+    // Zeile im Ringpuffer (nullterminiert ab offset)
+    struct LineRecord {
+        uint16_t offset;
+        uint16_t length;
+    };
+
+    char textBuffer[UI_TEXTBOX_BUFFER_SIZE];    // Zeichen aller Zeilen
+    LineRecord lineRing[UI_TEXTBOX_MAX_LINES];  // Zeilen-Einträge (ältester bei ringHead)
+    uint16_t ringHead;          // Slot der ältesten Zeile
+    uint16_t lineCount;         // Gespeicherte Zeilen
+    uint16_t writePos;          // Nächste freie Position in textBuffer
+    uint32_t firstLineNo;       // Fortlaufende Nummer der ältesten Zeile
+    uint32_t droppedLines;
+
+    int scrollY;                // Scroll-Offset (in Zeilen, relativ zur ältesten)
     int lineHeight;             // Höhe einer Zeile in Pixeln
     uint8_t fontSize;           // Font-Größe
     bool wordWrap;              // Automatischer Umbruch?
+    bool autoScroll;            // Am Ende mitscrollen?
     int padding;                // Innenabstand
     int maxVisibleLines;        // Maximale sichtbare Zeilen
-    
+    int16_t layoutWidth, layoutHeight;  // Größe bei der letzten Berechnung (Canvas, maxVisibleLines)
+
     // Touch-Scrolling
     bool scrolling;             // Wird gescrollt?
-    int16_t lastTouchY;         // Letzte Touch-Y-Position
     int16_t scrollStartY;       // Start-Y beim Scrolling
-    
-    void drawTextBox(TFT_eSPI* tft);
-    void wrapText(const char* text, std::vector<String>& outLines);
+    int scrollRemainder;        // Pixel-Rest unterhalb einer Zeilenhöhe
+
+    // Zuletzt gezeichneter Zustand (Display)
+    bool fullRedraw;            // Rahmen + alle Zeilen zeichnen
+    bool contentChanged;        // Sichtbare Zeilen ersetzt (clear/setText)
+    uint32_t drawnFirstLine;    // Nummer der obersten gezeichneten Zeile
+    int drawnRows;              // Gezeichnete Zeilen mit Text
+    int16_t drawnIndicatorY, drawnIndicatorH;   // 0 = kein Indikator
+    uint16_t drawnBgColor, drawnTextColor, drawnBorderColor;
+
+    // Textbereich-Sprite (nullptr → direkt zeichnen)
+    TFT_eSprite* canvas;
+    bool canvasFailed;          // Sprite-Anlage fehlgeschlagen, nicht erneut versuchen
+    bool canvasValid;
+    uint32_t canvasFirstLine;   // Nummer der obersten Zeile im Sprite
+    int canvasRows;             // Zeilen mit Text im Sprite
+
+    // Ringpuffer
+    const char* lineText(int index) const;      // index 0 = älteste Zeile
+    void pushLine(const char* text, int length);
+    void dropOldestLine();
+    void appendWrapped(const char* text, bool follow);
+    void resetLines();
+
+    // Sichtbarer Ausschnitt
+    uint32_t viewFirstLine() const { return firstLineNo + scrollY; }
+    int visibleRows() const;
+    void getChangedRows(int* first, int* end) const;
+    bool getIndicator(int16_t* outY, int16_t* outH) const;
+    int16_t textAreaWidth() const { return width - 2 * padding; }
+    bool styleChanged() const;
+
+    bool scrollByPixels(int pixels);
+    void drawRows(TFT_eSPI* tft, int first, int end);
+    void drawIndicator(TFT_eSPI* tft, bool clearOld);
+
+    void ensureCanvas(TFT_eSPI* tft);
+    void releaseCanvas();
+    void updateCanvas();
+    void renderCanvasRows(int first, int end);
+    void pushCanvasRows(TFT_eSPI* tft, int first, int end);
+
     int calculateMaxVisibleLines();
-    int getCharWidth(TFT_eSPI* tft);
-    int getMaxCharsPerLine(TFT_eSPI* tft);
+    int getMaxCharsPerLine() const;
+    void layoutChanged();
+
+    /**
+     * Größe seit layoutChanged() geändert (setBounds()/Flex-Layout)? → neu berechnen
+     */
+    void checkSize();
 };
 
-#endif // UI_TEXTBOX_H
\ No newline at end of file
+#endif // UI_TEXTBOX_H
@@ -0,0 +1,173 @@
+/**
+ * UITheme.h
+ *
+ * Gemeinsame Style-Tabelle (Flyweight) für alle UI-Elemente
+ *
+ * - Jedes Element hält nur einen 1-Byte-Index (StyleId) statt einer eigenen
+ *   ElementStyle-Kopie
+ * - Die ersten Einträge sind die Rollen-Styles des aktiven Themes (Button,
+ *   Label, ...). Weicht ein Element davon ab (z.B. setTextColor()), teilt es
+ *   sich einen Eintrag mit allen Elementen gleicher Rolle + gleicher
+ *   Abweichung (Referenzzähler, frei bei 0)
+ * - Zustands-Varianten (normal, gedrückt, deaktiviert, fokussiert) werden pro
+ *   Eintrag beim Theme-Wechsel einmal berechnet, draw() liest sie nur
+ * - setTheme() merkt sich welche Einträge sich geändert haben, der UIManager
+ *   markiert nur Elemente mit diesen Einträgen als geändert
+ * - Abweichungen (explizit gesetzte Farben) bleiben beim Theme-Wechsel erhalten
+ */
+
+#ifndef UI_THEME_H
+#define UI_THEME_H
+
+#include <Arduino.h>
+#include "setupConf.h"
+
+// Aufgelöster Style (eine Zustands-Variante)
+struct ElementStyle {
+    uint16_t bgColor;
+    uint16_t borderColor;
+    uint16_t textColor;
+    uint16_t accentColor;       // Balken, Häkchen, Punkt, Knopf
+    uint8_t borderWidth;
+    uint8_t cornerRadius;
+};
+
+// Vollständige Style-Beschreibung (Theme-Eintrag oder Abweichung eines Elements)
+struct StyleSpec {
+    uint16_t bgColor;
+    uint16_t borderColor;
+    uint16_t textColor;
+    uint16_t accentColor;
+    uint16_t pressedBgColor;
+    uint16_t pressedTextColor;
+    uint8_t borderWidth;
+    uint8_t cornerRadius;
+};
+
+// Einzelne Felder (Bitmaske der Abweichungen)
+enum StyleField : uint8_t {
+    STYLE_BG            = 0x01,
+    STYLE_BORDER        = 0x02,
+    STYLE_TEXT          = 0x04,
+    STYLE_ACCENT        = 0x08,
+    STYLE_PRESSED_BG    = 0x10,
+    STYLE_PRESSED_TEXT  = 0x20,
+    STYLE_BORDER_WIDTH  = 0x40,
+    STYLE_CORNER_RADIUS = 0x80
+};
+
+// Zustands-Varianten (vorberechnet)
+enum class StyleState : uint8_t {
+    NORMAL,
+    PRESSED,
+    DISABLED,
+    FOCUSED
+};
+
+// Rollen = Basis-Styles des Themes (Reihenfolge = Index in der Tabelle)
+enum class StyleRole : uint8_t {
+    ELEMENT,
+    LABEL,
+    BUTTON,
+    SLIDER,
+    PROGRESS_BAR,
+    CHECKBOX,
+    RADIO_BUTTON,
+    TEXTBOX,
+    JOYSTICK,
+    CONTAINER,
+    HEADER_BUTTON,      // UILayout: Zurück-Button
+    HEADER_TITLE,       // UILayout: Seiten-Titel
+    SLEEP_BUTTON,       // UILayout: Sleep-Button
+    BATTERY,            // UILayout: Battery-Icon (Hintergrund je Ladezustand)
+    FOOTER,             // UILayout: Footer-Text
+    COUNT
+};
+
+enum class ThemeId : uint8_t {
+    DARK,
+    HIGH_CONTRAST,      // Tageslicht: kräftige Farben, gelbe Bedienelemente
+    COUNT
+};
+
+// Index in die Style-Tabelle
+typedef uint8_t StyleId;
+
+class UITheme {
+public:
+    static const uint8_t ROLE_COUNT = static_cast<uint8_t>(StyleRole::COUNT);
+    static const uint8_t STATE_COUNT = static_cast<uint8_t>(StyleState::FOCUSED) + 1;
+
+    /**
+     * Aufgelöster Style eines Eintrags im gewünschten Zustand
+     */
+    static const ElementStyle& get(StyleId id, StyleState state = StyleState::NORMAL) {
+        if (!ready) init();
+        return records[id].states[static_cast<uint8_t>(state)];
+    }
+
+    static StyleId forRole(StyleRole role) { return static_cast<StyleId>(role); }
+    static StyleRole getRole(StyleId id) { return records[id].role; }
+
+    /**
+     * Ein Feld abweichend setzen
+     * @param id Bisheriger Eintrag des Elements (wird freigegeben)
+     * @return Neuer Eintrag (geteilt mit gleichen Abweichungen)
+     */
+    static StyleId setField(StyleId id, StyleField field, uint16_t value);
+
+    /**
+     * Alle Felder von style fest setzen (UIElement::setStyle())
+     * accentColor bleibt beim Theme-Wert
+     */
+    static StyleId setAll(StyleId id, const ElementStyle& style);
+
+    /**
+     * Zurück auf den Rollen-Style (alle Abweichungen entfallen)
+     */
+    static StyleId setRole(StyleId id, StyleRole role);
+
+    /**
+     * Eintrag freigeben (Element gelöscht)
+     */
+    static void release(StyleId id);
+
+    /**
+     * Theme wechseln: alle belegten Einträge neu berechnen
+     * @return Anzahl geänderter Einträge (0 = gleiches Theme)
+     */
+    static uint8_t setTheme(ThemeId theme);
+    static ThemeId getTheme() { return current; }
+    static const char* getThemeName(ThemeId theme);
+
+    /**
+     * Hat sich der Eintrag beim letzten setTheme() geändert?
+     */
+    static bool wasChanged(StyleId id) { return changed[id >> 3] & (1 << (id & 7)); }
+
+    /**
+     * Belegung der Tabelle ausgeben
+     */
+    static void printStats();
+
+private:
+    struct Record {
+        ElementStyle states[STATE_COUNT];   // Vorberechnete Varianten
+        StyleSpec overrides;                // Werte der abweichenden Felder
+        uint8_t mask;                       // Abweichende Felder (StyleField)
+        StyleRole role;
+        uint16_t refs;                      // Nutzer (nur Abweichungen, 0 = frei)
+    };
+
+    static Record records[UI_THEME_MAX_STYLES];
+    static uint8_t changed[(UI_THEME_MAX_STYLES + 7) / 8];
+    static ThemeId current;
+    static bool ready;
+    static uint32_t tableFull;
+
+    static void init();
+    static void compute(Record& record);
+    static StyleId acquire(StyleRole role, uint8_t mask, const StyleSpec& values);
+};
+
+#endif // UI_THEME_H
@@ -34,6 +34,15 @@ struct UserConfigStruct {
     uint16_t touchThreshold;
     uint8_t touchRotation;
     
+    // Touch Affin-Kalibrierung (Q16, Roh → Display in Rotation 1)
+    int32_t touchCalA;
+    int32_t touchCalB;
+    int32_t touchCalC;
+    int32_t touchCalD;
+    int32_t touchCalE;
+    int32_t touchCalF;
+    bool touchCalAffine;     // false = Min/Max-Kalibrierung verwenden
+    
     // ESP-NOW
     uint8_t espnowChannel;
     uint8_t espnowMaxPeers;
@@ -131,6 +140,8 @@ public:
     int16_t getTouchMaxY() const { return config.touchMaxY; }
     uint16_t getTouchThreshold() const { return config.touchThreshold; }
     uint8_t getTouchRotation() const { return config.touchRotation; }
+    bool hasTouchAffine() const { return config.touchCalAffine; }
+    void getTouchAffine(int32_t coeffs[6]) const;
     
     // ESP-NOW
     uint8_t getEspnowChannel() const { return config.espnowChannel; }
@@ -170,6 +181,8 @@ public:
     void setTouchCalibration(int16_t minX, int16_t maxX, int16_t minY, int16_t maxY);
     void setTouchThreshold(uint16_t value);
     void setTouchRotation(uint8_t value);
+    void setTouchAffine(const int32_t coeffs[6]);
+    void clearTouchAffine();
     
     // ESP-NOW
     void setEspnowChannel(uint8_t value);
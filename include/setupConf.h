@@ -38,6 +38,48 @@
 #define TOUCH_MISO  TFT_MISO  // = GPIO13 (HSPI)
 #define TOUCH_CLK   TFT_SCK   // = GPIO12 (HSPI)
 
+// Touch-Sampling-Task (IRQ-getrieben)
+#ifndef TOUCH_TASK_STACK_SIZE
+#define TOUCH_TASK_STACK_SIZE   3072    // Sampling-Task Stack
+#endif
+
+#ifndef TOUCH_TASK_PRIORITY
+#define TOUCH_TASK_PRIORITY     3       // Über loop() (1), unter ESP-NOW Worker (5)
+#endif
+
+#ifndef TOUCH_EVENT_QUEUE_SIZE
+#define TOUCH_EVENT_QUEUE_SIZE  16      // TouchPoint-Events (Task → UIManager)
+#endif
+
+#ifndef TOUCH_BURST_SAMPLES
+#define TOUCH_BURST_SAMPLES     5       // Samples pro Burst (Median/Trimmed-Mean)
+#endif
+
+#ifndef TOUCH_BUS_TIMEOUT_MS
+#define TOUCH_BUS_TIMEOUT_MS    20      // Max. Wartezeit auf HSPI (Display-Burst)
+#endif
+
+#ifndef TOUCH_SAMPLE_SPACING_MS
+#define TOUCH_SAMPLE_SPACING_MS 4       // Abstand zwischen Samples (XPT2046 Lib cached 3ms)
+#endif
+
+// Affine Kalibrierung (touchcal)
+#ifndef TOUCH_CAL_MARGIN
+#define TOUCH_CAL_MARGIN        30      // Abstand der Kalibrier-Kreuze zum Rand (px)
+#endif
+
+#ifndef TOUCH_CAL_TIMEOUT_MS
+#define TOUCH_CAL_TIMEOUT_MS    15000   // Max. Wartezeit pro Kalibrier-Punkt
+#endif
+
+#ifndef TOUCH_CAL_SAMPLES
+#define TOUCH_CAL_SAMPLES       8       // Gemittelte Messungen pro Kalibrier-Punkt
+#endif
+
+#ifndef TOUCH_CAL_MIN_SPAN
+#define TOUCH_CAL_MIN_SPAN      500     // Min. Roh-Spanne Min/Max (kleiner = defekte Kalibrierung)
+#endif
+
 // ═══════════════════════════════════════════════════════════════════════════
 // 💾 SD-KARTE PINS (VSPI - eigener Bus!)
 // ═══════════════════════════════════════════════════════════════════════════
@@ -138,6 +180,231 @@
 #define UI_CONTENT_Y            UI_STATUSBAR_HEIGHT
 #define UI_CONTENT_HEIGHT       (DISPLAY_HEIGHT - UI_STATUSBAR_HEIGHT - UI_NAVBAR_HEIGHT)
 
+// ═══════════════════════════════════════════════════════════════════════════
+// 👋 GESTEN-ERKENNUNG (UIGestureRecognizer)
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef GESTURE_TAP_SLOP
+#define GESTURE_TAP_SLOP            10      // Max. Bewegung (px) für Tap/Long-Press
+#endif
+
+#ifndef GESTURE_LONG_PRESS_MS
+#define GESTURE_LONG_PRESS_MS       600     // Haltezeit für Long-Press
+#endif
+
+#ifndef GESTURE_SWIPE_MIN_DISTANCE
+#define GESTURE_SWIPE_MIN_DISTANCE  60      // Min. Strecke (px) für Swipe
+#endif
+
+#ifndef GESTURE_SWIPE_MIN_VELOCITY
+#define GESTURE_SWIPE_MIN_VELOCITY  250     // Min. Geschwindigkeit (px/s) für Swipe
+#endif
+
+#ifndef GESTURE_FLING_MIN_VELOCITY
+#define GESTURE_FLING_MIN_VELOCITY  400     // Min. Geschwindigkeit (px/s) für Fling
+#endif
+
+#ifndef GESTURE_VELOCITY_WINDOW_MS
+#define GESTURE_VELOCITY_WINDOW_MS  100     // Zeitfenster für Geschwindigkeits-Schätzung
+#endif
+
+#ifndef GESTURE_KINETIC_FRICTION
+#define GESTURE_KINETIC_FRICTION    3.0f    // Abbremsrate Kinetic-Scroll (1/s, exponentiell)
+#endif
+
+#ifndef GESTURE_KINETIC_MIN_VELOCITY
+#define GESTURE_KINETIC_MIN_VELOCITY 40     // Unter dieser Geschwindigkeit (px/s) stoppen
+#endif
+
+// ═══════════════════════════════════════════════════════════════════════════
+// 🧩 DAMAGE-TRACKING (UIManager::drawUpdates)
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef UI_DAMAGE_MAX_RECTS
+#define UI_DAMAGE_MAX_RECTS         8       // Max. Damage-Rechtecke pro Frame (Rest wird vereinigt)
+#endif
+
+#ifndef UI_DAMAGE_MERGE_WASTE
+#define UI_DAMAGE_MERGE_WASTE       25      // Vereinigen wenn Mehrfläche <= x % der Einzelflächen
+#endif
+
+// Sprite-Rendering: Damage-Bereiche in PSRAM-Tile zusammensetzen, pro Tile ein Push
+#ifndef UI_SPRITE_RENDER
+#define UI_SPRITE_RENDER            0       // 1 = beim Start aktivieren (zur Laufzeit: 'ui sprite on')
+#endif
+
+#ifndef UI_SPRITE_TILE_PIXELS
+#define UI_SPRITE_TILE_PIXELS       (DISPLAY_WIDTH * 32)    // Max. Pixel pro Tile (2 Byte/Pixel)
+#endif
+
+#ifndef UI_SPRITE_DMA
+#define UI_SPRITE_DMA               1       // Tiles per DMA pushen (0 = blockierend)
+#endif
+
+#ifndef UI_ASYNC_FLUSH
+#define UI_ASYNC_FLUSH              1       // Letzten DMA-Transfer nicht abwarten (PageManager::draw())
+#endif
+
+// ═══════════════════════════════════════════════════════════════════════════
+// 🎞️ FRAME-SCHEDULER (PageManager::draw)
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef UI_TARGET_FPS
+#define UI_TARGET_FPS               30      // Ziel-Framerate (0 = in jedem loop() zeichnen)
+#endif
+
+#ifndef UI_FRAME_BUDGET_US
+#define UI_FRAME_BUDGET_US          12000   // Max. Renderzeit pro Frame, Rest im nächsten Frame (0 = unbegrenzt)
+#endif
+
+// ═══════════════════════════════════════════════════════════════════════════
+// 🧱 PAGE-ARENA (UIArena: Widgets einer Page, in einem Schritt freigegeben)
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef UI_ARENA_CHUNK_SIZE
+#define UI_ARENA_CHUNK_SIZE         4096    // Blockgröße in Byte (größere Objekte bekommen eigenen Block)
+#endif
+
+#ifndef UI_PAGE_CACHE_SIZE
+#define UI_PAGE_CACHE_SIZE          3       // Gebaute Pages (inkl. aktueller), älteste wird entladen (0 = alle behalten)
+#endif
+
+#ifndef UI_ARENA_PSRAM
+#define UI_ARENA_PSRAM              1       // Blöcke im PSRAM anlegen (interner Heap bleibt für WiFi/ESP-NOW)
+#endif
+
+// ═══════════════════════════════════════════════════════════════════════════
+// 📐 FLEX-LAYOUT (UIFlexBox: Widget-Bounds aus Constraints, einmal pro Build)
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef UI_LAYOUT_MAX_ITEMS
+#define UI_LAYOUT_MAX_ITEMS         8       // Einträge pro Box (festes Array in der Arena)
+#endif
+
+// ═══════════════════════════════════════════════════════════════════════════
+// 🖐️ EVENTS (UIEventHandler: zentraler Handler-Pool statt Tabelle pro Widget)
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef UI_EVENT_MAX_HANDLERS
+#define UI_EVENT_MAX_HANDLERS       96      // Registrierte Handler aller Widgets zusammen
+#endif
+
+#ifndef UI_EVENT_CALLBACK_SIZE
+#define UI_EVENT_CALLBACK_SIZE      16      // Inline-Speicher pro Callback in Byte (Captures, kein Heap)
+#endif
+
+// ═══════════════════════════════════════════════════════════════════════════
+// 🎨 THEME (UITheme: gemeinsame Style-Tabelle, 'ui theme')
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef UI_THEME_DEFAULT
+#define UI_THEME_DEFAULT            0       // 0 = Dark, 1 = High-Contrast (Tageslicht)
+#endif
+
+#ifndef UI_THEME_MAX_STYLES
+#define UI_THEME_MAX_STYLES         40      // Rollen-Styles + geteilte Abweichungen (z.B. setTextColor())
+#endif
+
+// ═══════════════════════════════════════════════════════════════════════════
+// 🎞️ ANIMATION (UIAnimator: zeitbasierte Tweens im Frame-Takt)
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef UI_ANIM_MAX_TWEENS
+#define UI_ANIM_MAX_TWEENS          16      // Gleichzeitig laufende Tweens (fester Pool)
+#endif
+
+// ═══════════════════════════════════════════════════════════════════════════
+// 📜 PAGE-SLIDE (Hardware-Scrolling VSCRSADD, 'ui slide')
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef UI_PAGE_SLIDE
+#define UI_PAGE_SLIDE               1       // Swipe-Navigation gleitet (0 = Seiten wechseln sofort)
+#endif
+
+#ifndef UI_PAGE_SLIDE_MS
+#define UI_PAGE_SLIDE_MS            250     // Dauer eines Slides (ein Streifen pro Frame)
+#endif
+
+// ═══════════════════════════════════════════════════════════════════════════
+// 📸 SCREEN-CAPTURE (ScreenCapture: Screenshot/Stream über Serial, 'screen')
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef UI_SCREEN_TILE
+#define UI_SCREEN_TILE              32      // Kachelgröße in Pixeln (Einheit für Diff + RLE)
+#endif
+
+#ifndef UI_SCREEN_INTERVAL_MS
+#define UI_SCREEN_INTERVAL_MS       500     // Stream: frühester Abstand zwischen zwei Frames
+#endif
+
+#ifndef UI_SCREEN_BUDGET_US
+#define UI_SCREEN_BUDGET_US         3000    // Stream: max. Lese-/Kodierzeit pro loop()
+#endif
+
+#ifndef UI_SCREEN_KEYFRAME
+#define UI_SCREEN_KEYFRAME          20      // Stream: jeder n-te Frame komplett (0 = nur der erste)
+#endif
+
+// ═══════════════════════════════════════════════════════════════════════════
+// 🔤 FONTS (UIFont: Anti-Aliasing-Atlas im PSRAM + Glyph-Cache)
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef UI_FONT_FILE
+#define UI_FONT_FILE                "/fonts/ui.vlw"     // TFT_eSPI Smooth-Font auf der SD-Karte ("" = keiner)
+#endif
+
+#ifndef UI_FONT_CACHE_BYTES
+#define UI_FONT_CACHE_BYTES         65536   // Pixel-Pool für gemischte Glyphen (PSRAM, voll → wird geleert)
+#endif
+
+#ifndef UI_FONT_CACHE_ENTRIES
+#define UI_FONT_CACHE_ENTRIES       512     // Max. gemischte Glyphen (Zweierpotenz)
+#endif
+
+#ifndef UI_FONT_BENCH_ITERATIONS
+#define UI_FONT_BENCH_ITERATIONS    200     // Textzeilen pro Verfahren im Font-Benchmark
+#endif
+
+// ═══════════════════════════════════════════════════════════════════════════
+// 📜 TEXTBOX (UITextBox: Ringpuffer, älteste Zeilen fallen heraus)
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef UI_TEXTBOX_BUFFER_SIZE
+#define UI_TEXTBOX_BUFFER_SIZE      4096    // Zeichenpuffer pro TextBox in Byte (inkl. Nullterminator je Zeile)
+#endif
+
+#ifndef UI_TEXTBOX_MAX_LINES
+#define UI_TEXTBOX_MAX_LINES        128     // Max. gespeicherte Zeilen (nach Umbruch)
+#endif
+
+#ifndef UI_TEXTBOX_CANVAS
+#define UI_TEXTBOX_CANVAS           1       // Textbereich als PSRAM-Sprite puffern (Scrollen per Blit statt Neuzeichnen)
+#endif
+
+// ═══════════════════════════════════════════════════════════════════════════
+// 🧪 RENDER-TESTS (UIFrameBuffer: Offscreen-Rendering, 'ui render' / 'ui golden')
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef UI_GOLDEN_DIR
+#define UI_GOLDEN_DIR               "/golden"   // Referenzbilder auf der SD-Karte (page_<id>.raw, RGB565)
+#endif
+
+#ifndef UI_RENDER_BENCH_FRAMES
+#define UI_RENDER_BENCH_FRAMES      30      // Update-Frames pro Page im Render-Benchmark
+#endif
+
+// ═══════════════════════════════════════════════════════════════════════════
+// 📊 RENDER-PROFIL ('ui perf' / 'ui overlay')
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef UI_PERF_OVERLAY
+#define UI_PERF_OVERLAY             0       // Damage-Overlay beim Start (1 = Rechtecke umranden)
+#endif
+
+#ifndef UI_PERF_OVERLAY_COLOR
+#define UI_PERF_OVERLAY_COLOR       COLOR_MAGENTA   // Rahmenfarbe des Overlays
+#endif
+
 // ═══════════════════════════════════════════════════════════════════════════
 // 📝 LOGHANDLER KONFIGURATION
 // ═══════════════════════════════════════════════════════════════════════════
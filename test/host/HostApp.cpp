@@ -0,0 +1,48 @@
+/**
+ * HostApp.cpp (Host-Build)
+ */
+
+#include "HostApp.h"
+#include "include/Globals.h"
+#include "include/DisplayHandler.h"
+#include "include/PageManager.h"
+#include "include/UserConfig.h"
+#include "include/UIManager.h"
+#include "include/SpiBusArbiter.h"
+
+static UIManager* ui = nullptr;
+
+namespace HostApp {
+    bool begin() {
+        spiBus.begin();
+
+        if (!display.begin(&userConfig)) {
+            Serial.println("HostApp: ❌ Display init fehlgeschlagen");
+            return false;
+        }
+
+        spiBus.attach(&display.getTft().getSPIinstance());
+        spiBus.setBurstHooks(SpiDevice::DISPLAY,
+                             []() { display.getTft().startWrite(); },
+                             []() { display.getTft().endWrite(); });
+
+        TFT_eSPI* tft = &display.getTft();
+        ui = new UIManager(tft, &touch);
+
+        pageManager = new PageManager(tft, ui);
+        pageManager->setBusArbiter(&spiBus);
+        pageManager->setDisplayHandler(&display);
+
+        if (!pageManager->init(&battery, &powerMgr)) {
+            Serial.println("HostApp: ❌ PageManager init fehlgeschlagen");
+            return false;
+        }
+
+        pageManager->showPage(PAGE_HOME);
+        return true;
+    }
+
+    UIManager* getUI() {
+        return ui;
+    }
+}
@@ -0,0 +1,31 @@
+/**
+ * HostApp.h (Host-Build)
+ *
+ * Aufbau wie setup() auf dem Gerät, nur ohne Hardware:
+ * Display (Shim) → UIManager → PageManager mit allen Pages.
+ */
+
+#ifndef HOST_APP_H
+#define HOST_APP_H
+
+#include <Arduino.h>
+
+class UIManager;
+
+namespace HostApp {
+    /**
+     * Verzeichnis als SD-Karte einhängen ("/golden/..." → root + "/golden/...")
+     * @return false wenn das Verzeichnis fehlt
+     */
+    bool mountSD(const char* root);
+
+    /**
+     * Display, UIManager und PageManager (global pageManager) anlegen
+     * @return false wenn PageManager::init() fehlschlägt
+     */
+    bool begin();
+
+    UIManager* getUI();
+}
+
+#endif // HOST_APP_H
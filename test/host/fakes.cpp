@@ -0,0 +1,189 @@
+/**
+ * fakes.cpp (Host-Build)
+ *
+ * Globale Instanzen wie Globals.cpp, Hardware-Manager als Fakes mit festen
+ * Werten (Golden-Images müssen auf jedem Rechner gleich aussehen):
+ * - Akku 80% / 3.95 V, ESP-NOW nicht verbunden, kein Touch
+ * - SD-Karte = Verzeichnis auf dem Host (HostApp::mountSD())
+ *
+ * Echt kompiliert werden UI*, Pages, PageManager, DisplayHandler,
+ * SpiBusArbiter und ESPNowPacket (siehe CMakeLists.txt).
+ */
+
+#include "HostApp.h"
+#include "include/Globals.h"
+#include "include/DisplayHandler.h"
+#include "include/PageManager.h"
+#include "include/BatteryMonitor.h"
+#include "include/JoystickHandler.h"
+#include "include/SDCardHandler.h"
+#include "include/LogHandler.h"
+#include "include/TouchManager.h"
+#include "include/UserConfig.h"
+#include "include/PowerManager.h"
+#include "include/ESPNowRemoteController.h"
+#include "include/SpiBusArbiter.h"
+#include "include/UIFont.h"
+#include <string>
+#include <sys/stat.h>
+
+// Globale Instanzen
+DisplayHandler display;
+BatteryMonitor battery;
+JoystickHandler joystick;
+SDCardHandler sdCard;
+LogHandler logger(nullptr, LOG_INFO);
+TouchManager touch;
+UserConfig userConfig;
+PowerManager powerMgr;
+ESPNowRemoteController espNow;
+SpiBusArbiter spiBus;
+UIFont uiFont("UI");
+
+PageManager* pageManager = nullptr;
+
+// ═══════════════════════════════════════════════════════════════════════════
+// SD-KARTE (Verzeichnis)
+// ═══════════════════════════════════════════════════════════════════════════
+
+static std::string sdRoot;
+
+static std::string hostPath(const char* path) {
+    return sdRoot + (path && path[0] == '/' ? "" : "/") + (path ? path : "");
+}
+
+SDCardHandler::SDCardHandler() : mounted(false), vspi(nullptr), mutex(nullptr) {}
+SDCardHandler::~SDCardHandler() {}
+
+bool SDCardHandler::begin() {
+    struct stat info;
+    mounted = !sdRoot.empty() && stat(sdRoot.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+    return mounted;
+}
+
+void SDCardHandler::end() {
+    mounted = false;
+}
+
+uint64_t SDCardHandler::getFreeSpace() {
+    return mounted ? 1024ULL * 1024 * 1024 : 0;
+}
+
+bool SDCardHandler::fileExists(const char* path) {
+    struct stat info;
+    return mounted && stat(hostPath(path).c_str(), &info) == 0;
+}
+
+size_t SDCardHandler::getFileSize(const char* path) {
+    struct stat info;
+    if (!mounted || stat(hostPath(path).c_str(), &info) != 0) return 0;
+    return info.st_size;
+}
+
+bool SDCardHandler::createDir(const char* path) {
+    return mounted && (mkdir(hostPath(path).c_str(), 0755) == 0 || fileExists(path));
+}
+
+bool SDCardHandler::writeBinaryFile(const char* path, const uint8_t* data, size_t len) {
+    if (!mounted || !data) return false;
+
+    FILE* file = fopen(hostPath(path).c_str(), "wb");
+    if (!file) return false;
+    size_t written = fwrite(data, 1, len, file);
+    fclose(file);
+    return written == len;
+}
+
+int SDCardHandler::readBinaryFile(const char* path, uint8_t* buffer, size_t maxLen) {
+    if (!mounted || !buffer) return -1;
+
+    FILE* file = fopen(hostPath(path).c_str(), "rb");
+    if (!file) return -1;
+    size_t bytes = fread(buffer, 1, maxLen, file);
+    fclose(file);
+    return (int)bytes;
+}
+
+namespace HostApp {
+    bool mountSD(const char* root) {
+        sdRoot = root ? root : "";
+        while (sdRoot.size() > 1 && sdRoot.back() == '/') sdRoot.pop_back();
+        return sdCard.begin();
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// HARDWARE-MANAGER (feste Werte)
+// ═══════════════════════════════════════════════════════════════════════════
+
+BatteryMonitor::BatteryMonitor() {}
+BatteryMonitor::~BatteryMonitor() {}
+float BatteryMonitor::getVoltage() { return 3.95f; }
+uint8_t BatteryMonitor::getPercent() { return 80; }
+bool BatteryMonitor::isCritical() { return false; }
+bool BatteryMonitor::isLow() { return false; }
+
+JoystickHandler::JoystickHandler() {}
+JoystickHandler::~JoystickHandler() {}
+void JoystickHandler::calibrateCenter() {}
+
+LogHandler::LogHandler(SDCardHandler* sdHandler, LogLevel minLevel) { (void)sdHandler; (void)minLevel; }
+LogHandler::~LogHandler() {}
+void LogHandler::logConnection(const char*, const char*, int8_t) {}
+
+TouchManager::TouchManager() {}
+TouchManager::~TouchManager() {}
+bool TouchManager::isAvailable() { return false; }
+bool TouchManager::isIRQActive() { return false; }
+bool TouchManager::isTouchActive() { return false; }
+bool TouchManager::pollEvent(TouchPoint*) { return false; }
+TouchPoint TouchManager::getTouchPoint() { return TouchPoint{}; }
+
+ConfigManager::ConfigManager() {}
+ConfigManager::~ConfigManager() {}
+UserConfig::UserConfig() {}
+UserConfig::~UserConfig() {}
+void UserConfig::setAutoShutdownEnabled(bool) {}
+
+PowerManager::PowerManager() {}
+PowerManager::~PowerManager() {}
+void PowerManager::sleep(WakeSource, uint32_t) {}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ESP-NOW (nie verbunden)
+// ═══════════════════════════════════════════════════════════════════════════
+
+ESPNowManager::ESPNowManager() {}
+ESPNowManager::~ESPNowManager() {}
+bool ESPNowManager::begin(uint8_t) { return false; }
+void ESPNowManager::end() {}
+void ESPNowManager::update() {}
+void ESPNowManager::printInfo() {}
+void ESPNowManager::processRxQueue() {}
+void ESPNowManager::handleSendStatus(const uint8_t*, bool) {}
+void ESPNowManager::checkTimeouts() {}
+bool ESPNowManager::addPeer(const uint8_t*, bool) { return false; }
+bool ESPNowManager::removePeer(const uint8_t*) { return false; }
+bool ESPNowManager::hasPeer(const uint8_t*) { return false; }
+bool ESPNowManager::isConnected() { return false; }
+bool ESPNowManager::isPeerConnected(const uint8_t*) { return false; }
+bool ESPNowManager::send(const uint8_t*, const ESPNowPacket&) { return false; }
+void ESPNowManager::onEvent(ESPNowEvent, ESPNowEventCallback) {}
+String ESPNowManager::getOwnMacString() { return String("00:00:00:00:00:00"); }
+
+bool ESPNowManager::stringToMac(const char* macStr, uint8_t* mac) {
+    if (!macStr || !mac) return false;
+
+    int values[6];
+    if (sscanf(macStr, "%x:%x:%x:%x:%x:%x",
+               &values[0], &values[1], &values[2], &values[3], &values[4], &values[5]) != 6) {
+        return false;
+    }
+    for (int i = 0; i < 6; i++) mac[i] = (uint8_t)values[i];
+    return true;
+}
+
+ESPNowRemoteController::ESPNowRemoteController() {}
+ESPNowRemoteController::~ESPNowRemoteController() {}
+void ESPNowRemoteController::processRxQueue() {}
+void ESPNowRemoteController::printInfo() {}
@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+"""
+make_vlw.py - Erzeugt das Test-Fixture fonts/ui.vlw (TFT_eSPI Smooth-Font)
+
+Synthetischer Anti-Aliasing-Font für den Font-Benchmark im Host-Build:
+der GLCD-Font aus shim/TFT_eSPI.cpp (5x7), doppelt skaliert, jeder Punkt
+als runder Fleck mit 4x4-Supersampling → echte Alpha-Zwischenwerte wie bei
+einem aus TrueType erzeugten Atlas. Zeichen 0x20-0x7E, Zeilenhöhe 16 px.
+
+Aufruf (im Verzeichnis test/host/fixtures):
+  python3 make_vlw.py
+"""
+
+import os
+import re
+import struct
+
+SCALE = 2           # Pixel pro GLCD-Punkt
+SUPERSAMPLE = 4     # Unterabtastung pro Pixel und Achse
+RADIUS = 0.75       # Fleck-Radius in GLCD-Punkten (>0.5 → Nachbarn verschmelzen)
+BASELINE_ROW = 7    # GLCD-Zeile 7 = Unterlänge
+ADVANCE = 6 * SCALE
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SHIM = os.path.join(HERE, "..", "shim", "TFT_eSPI.cpp")
+OUTPUT = os.path.join(HERE, "fonts", "ui.vlw")
+
+
+def load_glcd():
+    """GLCD-Tabelle (5 Spaltenbytes pro Zeichen ab 0x20) aus dem Shim lesen"""
+    source = open(SHIM, encoding="utf-8").read()
+    table = re.search(r"GLCD_FONT\[\] = \{(.*?)\};", source, re.S).group(1)
+    table = re.sub(r"//[^\n]*", "", table)
+    values = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}", table)]
+    return [values[i:i + 5] for i in range(0, len(values), 5)]
+
+
+def render(columns):
+    """Glyphe → (Breite, Höhe, dY, dX, Alpha-Bytes)"""
+    dots = [(col, row) for col, line in enumerate(columns) for row in range(8) if line & (1 << row)]
+    if not dots:
+        return 0, 0, 0, 0, b""
+
+    # Rand von einem Pixel für die Kanten
+    width = 5 * SCALE + 2
+    height = 8 * SCALE + 2
+    alpha = [[0] * width for _ in range(height)]
+    limit = (RADIUS * SCALE * SUPERSAMPLE) ** 2
+
+    for y in range(height):
+        for x in range(width):
+            hits = 0
+            for sy in range(SUPERSAMPLE):
+                for sx in range(SUPERSAMPLE):
+                    px = (x - 1) * SUPERSAMPLE + sx + 0.5
+                    py = (y - 1) * SUPERSAMPLE + sy + 0.5
+                    for col, row in dots:
+                        cx = (col + 0.5) * SCALE * SUPERSAMPLE
+                        cy = (row + 0.5) * SCALE * SUPERSAMPLE
+                        if (px - cx) ** 2 + (py - cy) ** 2 <= limit:
+                            hits += 1
+                            break
+            alpha[y][x] = min(255, hits * 256 // (SUPERSAMPLE * SUPERSAMPLE))
+
+    # Leere Zeilen/Spalten abschneiden
+    rows = [y for y in range(height) if any(alpha[y])]
+    cols = [x for x in range(width) if any(alpha[y][x] for y in range(height))]
+    top, bottom, left, right = rows[0], rows[-1], cols[0], cols[-1]
+
+    bitmap = bytes(alpha[y][x] for y in range(top, bottom + 1) for x in range(left, right + 1))
+    baseline = 1 + BASELINE_ROW * SCALE
+    return right - left + 1, bottom - top + 1, baseline - top, left - 1, bitmap
+
+
+def main():
+    glyphs = load_glcd()
+    records = b""
+    bitmaps = b""
+
+    for index, columns in enumerate(glyphs):
+        width, height, dy, dx, bitmap = render(columns)
+        records += struct.pack(">7i", 0x20 + index, height, width, ADVANCE, dy, dx, 0)
+        bitmaps += bitmap
+
+    ascent = BASELINE_ROW * SCALE
+    descent = SCALE
+    header = struct.pack(">6i", len(glyphs), 11, 8 * SCALE, 0, ascent, descent)
+
+    os.makedirs(os.path.dirname(OUTPUT), exist_ok=True)
+    with open(OUTPUT, "wb") as f:
+        f.write(header + records + bitmaps)
+    print(f"{OUTPUT}: {len(glyphs)} Glyphen, {len(header + records + bitmaps)} Byte")
+
+
+if __name__ == "__main__":
+    main()
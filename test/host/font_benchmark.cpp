@@ -0,0 +1,35 @@
+/**
+ * font_benchmark.cpp (Host-Build)
+ *
+ * Font-Benchmark (UIFont::benchmark()): TFT_eSPI drawString() gegen den
+ * Glyph-Cache, beide im UIFrameBuffer. Der Atlas kommt wie auf dem Gerät
+ * von der "SD-Karte" (UI_FONT_FILE), hier das Fixture fixtures/fonts/ui.vlw.
+ *
+ * Aufruf: font_benchmark <Fixture-Verzeichnis> [Zeilen]
+ */
+
+#include "HostApp.h"
+#include "include/Globals.h"
+#include "include/DisplayHandler.h"
+#include "include/SDCardHandler.h"
+#include "include/UserConfig.h"
+#include "include/UIFont.h"
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        Serial.println("Aufruf: font_benchmark <Fixture-Verzeichnis> [Zeilen]");
+        return 2;
+    }
+    uint16_t iterations = argc > 2 ? atoi(argv[2]) : UI_FONT_BENCH_ITERATIONS;
+
+    if (!HostApp::mountSD(argv[1])) {
+        Serial.printf("font_benchmark: ❌ Verzeichnis '%s' nicht gefunden\n", argv[1]);
+        return 2;
+    }
+    if (!display.begin(&userConfig)) return 2;
+    if (!uiFont.loadFromSD(&sdCard, UI_FONT_FILE)) return 1;
+
+    UIFont::benchmark(&display.getTft(), &uiFont, iterations);
+    UIFont::printStats();
+    return 0;
+}
@@ -0,0 +1,35 @@
+/**
+ * golden_test.cpp (Host-Build)
+ *
+ * Rendert jede Page offscreen und vergleicht mit test/golden/page_<id>.raw
+ * (PageManager::runGoldenTest(), gleiches Format wie 'ui golden' auf dem Gerät).
+ *
+ * Aufruf: golden_test <SD-Verzeichnis> [--update]
+ *   --update  Referenzbilder neu schreiben (nach gewollten UI-Änderungen)
+ *
+ * Die Uhr steht (HostClock::freeze), Uptime/Animationen sind damit fest.
+ */
+
+#include "HostApp.h"
+#include "include/Globals.h"
+#include "include/PageManager.h"
+#include "include/SDCardHandler.h"
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        Serial.println("Aufruf: golden_test <SD-Verzeichnis> [--update]");
+        return 2;
+    }
+    bool update = argc > 2 && strcmp(argv[2], "--update") == 0;
+
+    HostClock::freeze(0);
+
+    if (!HostApp::mountSD(argv[1])) {
+        Serial.printf("golden_test: ❌ Verzeichnis '%s' nicht gefunden\n", argv[1]);
+        return 2;
+    }
+    if (!HostApp::begin()) return 2;
+
+    int failures = pageManager->runGoldenTest(&sdCard, update);
+    return failures == 0 ? 0 : 1;
+}
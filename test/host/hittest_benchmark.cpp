@@ -0,0 +1,26 @@
+/**
+ * hittest_benchmark.cpp (Host-Build)
+ *
+ * Hit-Test Benchmark (UIManager::benchmarkHitTest()) für mehrere Widget-Zahlen:
+ * lineare Suche vs. Raster-Index, Ziel pro Query verglichen.
+ *
+ * Aufruf: hittest_benchmark [Queries] [Widgets...]
+ * Exit-Code 1 wenn ein Verfahren ein anderes Ziel liefert.
+ */
+
+#include <Arduino.h>
+#include "include/UIManager.h"
+
+int main(int argc, char** argv) {
+    int queries = argc > 1 ? atoi(argv[1]) : 10000;
+
+    std::vector<int> widgetCounts;
+    for (int i = 2; i < argc; i++) widgetCounts.push_back(atoi(argv[i]));
+    if (widgetCounts.empty()) widgetCounts = { 16, 64, 128, 512 };
+
+    bool identical = true;
+    for (int count : widgetCounts) {
+        identical &= UIManager::benchmarkHitTest(count, queries);
+    }
+    return identical ? 0 : 1;
+}
@@ -0,0 +1,24 @@
+/**
+ * render_benchmark.cpp (Host-Build)
+ *
+ * Render-Benchmark aller Pages (PageManager::benchmarkRender()) ohne Gerät:
+ * Primitiv-Zähler und Überzeichnung sind identisch zum Gerät, die Zeiten
+ * gelten für den Host-Rasterizer (nur relativ vergleichen).
+ *
+ * Aufruf: render_benchmark [Frames]
+ */
+
+#include "HostApp.h"
+#include "include/Globals.h"
+#include "include/PageManager.h"
+
+int main(int argc, char** argv) {
+    uint16_t frames = argc > 1 ? atoi(argv[1]) : UI_RENDER_BENCH_FRAMES;
+
+    if (!HostApp::begin()) return 2;
+
+    // Ungebremst: kein Warten auf den Frame-Takt
+    pageManager->setTargetFps(0);
+    pageManager->benchmarkRender(frames);
+    return 0;
+}
@@ -0,0 +1,64 @@
+/**
+ * Arduino.cpp (Host-Shim)
+ */
+
+#include "Arduino.h"
+#include <chrono>
+#include <thread>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+static const auto clockStart = std::chrono::steady_clock::now();
+static bool clockFrozen = false;
+static uint64_t frozenUs = 0;
+
+static uint64_t elapsedUs() {
+    if (clockFrozen) return frozenUs;
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - clockStart).count();
+}
+
+unsigned long millis() { return (unsigned long)(uint32_t)(elapsedUs() / 1000); }
+unsigned long micros() { return (unsigned long)(uint32_t)elapsedUs(); }
+
+void delay(uint32_t ms) {
+    if (clockFrozen) {
+        frozenUs += (uint64_t)ms * 1000;
+        return;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(uint32_t us) {
+    if (clockFrozen) {
+        frozenUs += us;
+        return;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void yield() {}
+
+namespace HostClock {
+    void freeze(uint32_t ms) {
+        clockFrozen = true;
+        frozenUs = (uint64_t)ms * 1000;
+    }
+
+    void advance(uint32_t ms) {
+        if (clockFrozen) frozenUs += (uint64_t)ms * 1000;
+    }
+
+    void release() { clockFrozen = false; }
+
+    bool isFrozen() { return clockFrozen; }
+}
+
+size_t HardwareSerial::printf(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int written = vprintf(format, args);
+    va_end(args);
+    return written > 0 ? (size_t)written : 0;
+}
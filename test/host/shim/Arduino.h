@@ -0,0 +1,202 @@
+/**
+ * Arduino.h (Host-Shim)
+ *
+ * Minimaler Arduino-Kern für den Host-Build (Linux): Typen, Zeit, Serial,
+ * String. Nur was die UI-Quellen und die eingebundenen Header brauchen.
+ *
+ * Zeit: millis()/micros() laufen normal (steady_clock). HostClock::freeze()
+ * hält sie an (Golden-Images: Animationen, Uptime usw. deterministisch).
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+// Wie der ESP32-Kern: FreeRTOS-Typen sind über Arduino.h sichtbar
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define PROGMEM
+#define IRAM_ATTR
+#define F(text) (text)
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+
+#define HIGH 0x1
+#define LOW  0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+using std::min;
+using std::max;
+using std::abs;
+
+template <typename T, typename L, typename H>
+inline T constrain(T value, L low, H high) {
+    return value < (T)low ? (T)low : (value > (T)high ? (T)high : value);
+}
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ZEIT
+// ═══════════════════════════════════════════════════════════════════════════
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+namespace HostClock {
+    void freeze(uint32_t ms);       // millis()/micros() stehen auf ms
+    void advance(uint32_t ms);      // Eingefrorene Zeit weiterstellen
+    void release();                 // Wieder Echtzeit
+    bool isFrozen();
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// GPIO (ohne Wirkung)
+// ═══════════════════════════════════════════════════════════════════════════
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return HIGH; }
+inline uint16_t analogRead(uint8_t) { return 0; }
+inline uint32_t analogReadMilliVolts(uint8_t) { return 0; }
+inline void analogReadResolution(uint8_t) {}
+inline bool ledcAttach(uint8_t, uint32_t, uint8_t) { return true; }
+inline bool ledcWrite(uint8_t, uint32_t) { return true; }
+inline void attachInterrupt(uint8_t, void (*)(), int) {}
+inline void detachInterrupt(uint8_t) {}
+inline uint8_t digitalPinToInterrupt(uint8_t pin) { return pin; }
+inline long random(long maxValue) { return maxValue > 0 ? rand() % maxValue : 0; }
+inline long random(long minValue, long maxValue) { return minValue + random(maxValue - minValue); }
+inline void randomSeed(unsigned long seed) { srand(seed); }
+
+// PSRAM = Host-Heap
+inline bool psramFound() { return true; }
+inline void* ps_malloc(size_t size) { return malloc(size); }
+
+// ═══════════════════════════════════════════════════════════════════════════
+// STRING
+// ═══════════════════════════════════════════════════════════════════════════
+
+class String {
+public:
+    String() {}
+    String(const char* text) : value(text ? text : "") {}
+    String(const std::string& text) : value(text) {}
+    String(char c) : value(1, c) {}
+    String(int number) : value(std::to_string(number)) {}
+    String(unsigned int number) : value(std::to_string(number)) {}
+    String(long number) : value(std::to_string(number)) {}
+    String(unsigned long number) : value(std::to_string(number)) {}
+    String(float number, unsigned int decimals = 2) { format(number, decimals); }
+    String(double number, unsigned int decimals = 2) { format(number, decimals); }
+
+    const char* c_str() const { return value.c_str(); }
+    unsigned int length() const { return value.length(); }
+    bool isEmpty() const { return value.empty(); }
+    char operator[](unsigned int index) const { return index < value.size() ? value[index] : 0; }
+    int indexOf(char c) const { size_t pos = value.find(c); return pos == std::string::npos ? -1 : (int)pos; }
+    String substring(unsigned int from) const { return from < value.size() ? String(value.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const {
+        return from < value.size() && to > from ? String(value.substr(from, to - from)) : String();
+    }
+    void trim() {
+        size_t first = value.find_first_not_of(" \t\r\n");
+        size_t last = value.find_last_not_of(" \t\r\n");
+        value = first == std::string::npos ? std::string() : value.substr(first, last - first + 1);
+    }
+    void toUpperCase() { for (char& c : value) c = toupper(c); }
+    int toInt() const { return atoi(value.c_str()); }
+    float toFloat() const { return atof(value.c_str()); }
+    bool startsWith(const String& prefix) const { return value.compare(0, prefix.value.size(), prefix.value) == 0; }
+    bool equals(const String& other) const { return value == other.value; }
+
+    String& operator+=(const String& other) { value += other.value; return *this; }
+    String& operator+=(const char* text) { value += text ? text : ""; return *this; }
+    String& operator+=(char c) { value += c; return *this; }
+    friend String operator+(const String& a, const String& b) { return String(a.value + b.value); }
+    friend String operator+(const String& a, const char* b) { return String(a.value + (b ? b : "")); }
+    friend String operator+(const char* a, const String& b) { return String((a ? a : "") + b.value); }
+    bool operator==(const String& other) const { return value == other.value; }
+    bool operator==(const char* text) const { return text && value == text; }
+    bool operator!=(const String& other) const { return value != other.value; }
+
+private:
+    std::string value;
+
+    void format(double number, unsigned int decimals) {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "%.*f", (int)decimals, number);
+        value = buffer;
+    }
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// SERIAL (stdout)
+// ═══════════════════════════════════════════════════════════════════════════
+
+#define DEC 10
+#define HEX 16
+
+class HardwareSerial {
+public:
+    void begin(unsigned long) {}
+    void end() {}
+    operator bool() const { return true; }
+
+    int available() { return 0; }
+    int read() { return -1; }
+    int peek() { return -1; }
+    void flush() { fflush(stdout); }
+    int availableForWrite() { return 4096; }
+    size_t write(uint8_t c) { return fwrite(&c, 1, 1, stdout); }
+    size_t write(const uint8_t* data, size_t size) { return fwrite(data, 1, size, stdout); }
+    void setTimeout(unsigned long) {}
+
+    size_t printf(const char* format, ...);
+
+    size_t print(const char* text) { return fputs(text, stdout) >= 0 ? strlen(text) : 0; }
+    size_t print(const String& text) { return print(text.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int number, int base = DEC) { return printf(base == HEX ? "%X" : "%d", number); }
+    size_t print(unsigned int number, int base = DEC) { return printf(base == HEX ? "%X" : "%u", number); }
+    size_t print(long number, int base = DEC) { return printf(base == HEX ? "%lX" : "%ld", number); }
+    size_t print(unsigned long number, int base = DEC) { return printf(base == HEX ? "%lX" : "%lu", number); }
+    size_t print(double number, int decimals = 2) { return printf("%.*f", decimals, number); }
+
+    template <typename T>
+    size_t println(const T& value) { size_t n = print(value); return n + println(); }
+    template <typename T>
+    size_t println(const T& value, int format) { size_t n = print(value, format); return n + println(); }
+    size_t println() { return print("\n"); }
+};
+
+extern HardwareSerial Serial;
+
+#include "ESP.h"
+
+#endif // HOST_ARDUINO_H
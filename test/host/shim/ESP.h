@@ -0,0 +1,32 @@
+/**
+ * ESP.h (Host-Shim)
+ *
+ * Chip-Infos mit festen Werten (InfoPage-Text bleibt für Golden-Images gleich).
+ */
+
+#ifndef HOST_ESP_H
+#define HOST_ESP_H
+
+#include <stdint.h>
+
+class EspClass {
+public:
+    uint32_t getFreeHeap() { return 200000; }
+    uint32_t getHeapSize() { return 320000; }
+    uint32_t getMinFreeHeap() { return 180000; }
+    uint32_t getMaxAllocHeap() { return 110000; }
+    uint32_t getPsramSize() { return 8 * 1024 * 1024; }
+    uint32_t getFreePsram() { return 7 * 1024 * 1024; }
+    uint32_t getCpuFreqMHz() { return 240; }
+    uint32_t getFlashChipSize() { return 16 * 1024 * 1024; }
+    const char* getChipModel() { return "ESP32-S3 (Host)"; }
+    uint8_t getChipRevision() { return 0; }
+    uint8_t getChipCores() { return 2; }
+    const char* getSdkVersion() { return "host"; }
+    uint64_t getEfuseMac() { return 0; }
+    void restart() {}
+};
+
+extern EspClass ESP;
+
+#endif // HOST_ESP_H
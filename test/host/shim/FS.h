@@ -0,0 +1,12 @@
+/**
+ * FS.h (Host-Shim)
+ *
+ * Dateien laufen über SDCardHandler (fakes.cpp, Verzeichnis als SD-Karte).
+ */
+
+#ifndef HOST_FS_H
+#define HOST_FS_H
+
+#include <Arduino.h>
+
+#endif // HOST_FS_H
@@ -0,0 +1,29 @@
+/**
+ * FreeRTOS.cpp (Host-Shim)
+ */
+
+#include "freertos/semphr.h"
+#include <chrono>
+#include <mutex>
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() {
+    return new std::recursive_timed_mutex();
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t semaphore, TickType_t ticks) {
+    auto* mutex = static_cast<std::recursive_timed_mutex*>(semaphore);
+    if (ticks == portMAX_DELAY) {
+        mutex->lock();
+        return pdTRUE;
+    }
+    return mutex->try_lock_for(std::chrono::milliseconds(ticks)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t semaphore) {
+    static_cast<std::recursive_timed_mutex*>(semaphore)->unlock();
+    return pdTRUE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore) {
+    delete static_cast<std::recursive_timed_mutex*>(semaphore);
+}
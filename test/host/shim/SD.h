@@ -0,0 +1,10 @@
+/**
+ * SD.h (Host-Shim)
+ */
+
+#ifndef HOST_SD_H
+#define HOST_SD_H
+
+#include <FS.h>
+
+#endif // HOST_SD_H
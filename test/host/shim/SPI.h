@@ -0,0 +1,65 @@
+/**
+ * SPI.h (Host-Shim)
+ *
+ * SPI-Bus ohne Hardware: Transfers liefern 0, beginTransaction() merkt sich
+ * den Takt (SpiBusArbiter prüft getClockDivider()).
+ */
+
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include <Arduino.h>
+
+#define FSPI 0
+#define HSPI 1
+
+#define SPI_MODE0 0
+#define SPI_MODE1 1
+#define SPI_MODE2 2
+#define SPI_MODE3 3
+
+#define SPI_LSBFIRST 0
+#define SPI_MSBFIRST 1
+#define LSBFIRST SPI_LSBFIRST
+#define MSBFIRST SPI_MSBFIRST
+
+#define HOST_SPI_APB_CLOCK 80000000UL
+
+class SPISettings {
+public:
+    SPISettings() : _clock(1000000), _bitOrder(SPI_MSBFIRST), _dataMode(SPI_MODE0) {}
+    SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode)
+        : _clock(clock), _bitOrder(bitOrder), _dataMode(dataMode) {}
+
+    uint32_t _clock;
+    uint8_t _bitOrder;
+    uint8_t _dataMode;
+};
+
+class SPIClass {
+public:
+    explicit SPIClass(uint8_t bus = HSPI) : bus(bus), divider(0) {}
+
+    void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) {
+        (void)sck; (void)miso; (void)mosi; (void)ss;
+        setFrequency(1000000);
+    }
+    void end() {}
+
+    void beginTransaction(SPISettings settings) { setFrequency(settings._clock); }
+    void endTransaction() {}
+
+    // Teiler wie ESP32 (APB / Frequenz), 0 = nie gesetzt
+    void setFrequency(uint32_t frequency) { divider = frequency > 0 ? HOST_SPI_APB_CLOCK / frequency : 0; }
+    uint32_t getClockDivider() { return divider; }
+
+    uint8_t transfer(uint8_t) { return 0; }
+    uint16_t transfer16(uint16_t) { return 0; }
+    void transferBytes(const uint8_t*, uint8_t* out, uint32_t size) { if (out) memset(out, 0, size); }
+
+private:
+    uint8_t bus;
+    uint32_t divider;
+};
+
+#endif // HOST_SPI_H
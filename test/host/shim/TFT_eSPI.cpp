@@ -0,0 +1,812 @@
+/**
+ * TFT_eSPI.cpp (Host-Shim)
+ *
+ * Clipping, Datum und die Zerlegung der zusammengesetzten Primitive folgen
+ * TFT_eSPI 2.5 (Sprite-Pfad), damit Zähler und Pixel dem Gerät entsprechen.
+ */
+
+#include "TFT_eSPI.h"
+
+// GLCD-Font 5x7 (Spalten, Bit 0 = oben), Zeichen 0x20-0x7E
+static const uint8_t GLCD_FIRST = 0x20;
+static const uint8_t GLCD_LAST = 0x7E;
+static const uint8_t GLCD_FONT[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x5F, 0x00, 0x00,  0x00, 0x07, 0x00, 0x07, 0x00,  // ' ' ! "
+    0x14, 0x7F, 0x14, 0x7F, 0x14,  0x24, 0x2A, 0x7F, 0x2A, 0x12,  0x23, 0x13, 0x08, 0x64, 0x62,  // # $ %
+    0x36, 0x49, 0x56, 0x20, 0x50,  0x00, 0x08, 0x07, 0x03, 0x00,  0x00, 0x1C, 0x22, 0x41, 0x00,  // & ' (
+    0x00, 0x41, 0x22, 0x1C, 0x00,  0x2A, 0x1C, 0x7F, 0x1C, 0x2A,  0x08, 0x08, 0x3E, 0x08, 0x08,  // ) * +
+    0x00, 0x80, 0x70, 0x30, 0x00,  0x08, 0x08, 0x08, 0x08, 0x08,  0x00, 0x00, 0x60, 0x60, 0x00,  // , - .
+    0x20, 0x10, 0x08, 0x04, 0x02,  0x3E, 0x51, 0x49, 0x45, 0x3E,  0x00, 0x42, 0x7F, 0x40, 0x00,  // / 0 1
+    0x72, 0x49, 0x49, 0x49, 0x46,  0x21, 0x41, 0x49, 0x4D, 0x33,  0x18, 0x14, 0x12, 0x7F, 0x10,  // 2 3 4
+    0x27, 0x45, 0x45, 0x45, 0x39,  0x3C, 0x4A, 0x49, 0x49, 0x31,  0x41, 0x21, 0x11, 0x09, 0x07,  // 5 6 7
+    0x36, 0x49, 0x49, 0x49, 0x36,  0x46, 0x49, 0x49, 0x29, 0x1E,  0x00, 0x00, 0x14, 0x00, 0x00,  // 8 9 :
+    0x00, 0x40, 0x34, 0x00, 0x00,  0x00, 0x08, 0x14, 0x22, 0x41,  0x14, 0x14, 0x14, 0x14, 0x14,  // ; < =
+    0x00, 0x41, 0x22, 0x14, 0x08,  0x02, 0x01, 0x59, 0x09, 0x06,  0x3E, 0x41, 0x5D, 0x59, 0x4E,  // > ? @
+    0x7C, 0x12, 0x11, 0x12, 0x7C,  0x7F, 0x49, 0x49, 0x49, 0x36,  0x3E, 0x41, 0x41, 0x41, 0x22,  // A B C
+    0x7F, 0x41, 0x41, 0x41, 0x3E,  0x7F, 0x49, 0x49, 0x49, 0x41,  0x7F, 0x09, 0x09, 0x09, 0x01,  // D E F
+    0x3E, 0x41, 0x41, 0x51, 0x73,  0x7F, 0x08, 0x08, 0x08, 0x7F,  0x00, 0x41, 0x7F, 0x41, 0x00,  // G H I
+    0x20, 0x40, 0x41, 0x3F, 0x01,  0x7F, 0x08, 0x14, 0x22, 0x41,  0x7F, 0x40, 0x40, 0x40, 0x40,  // J K L
+    0x7F, 0x02, 0x1C, 0x02, 0x7F,  0x7F, 0x04, 0x08, 0x10, 0x7F,  0x3E, 0x41, 0x41, 0x41, 0x3E,  // M N O
+    0x7F, 0x09, 0x09, 0x09, 0x06,  0x3E, 0x41, 0x51, 0x21, 0x5E,  0x7F, 0x09, 0x19, 0x29, 0x46,  // P Q R
+    0x26, 0x49, 0x49, 0x49, 0x32,  0x03, 0x01, 0x7F, 0x01, 0x03,  0x3F, 0x40, 0x40, 0x40, 0x3F,  // S T U
+    0x1F, 0x20, 0x40, 0x20, 0x1F,  0x3F, 0x40, 0x38, 0x40, 0x3F,  0x63, 0x14, 0x08, 0x14, 0x63,  // V W X
+    0x03, 0x04, 0x78, 0x04, 0x03,  0x61, 0x59, 0x49, 0x4D, 0x43,  0x00, 0x7F, 0x41, 0x41, 0x41,  // Y Z [
+    0x02, 0x04, 0x08, 0x10, 0x20,  0x00, 0x41, 0x41, 0x41, 0x7F,  0x04, 0x02, 0x01, 0x02, 0x04,  // \ ] ^
+    0x40, 0x40, 0x40, 0x40, 0x40,  0x00, 0x03, 0x07, 0x08, 0x00,  0x20, 0x54, 0x54, 0x78, 0x40,  // _ ` a
+    0x7F, 0x28, 0x44, 0x44, 0x38,  0x38, 0x44, 0x44, 0x44, 0x28,  0x38, 0x44, 0x44, 0x28, 0x7F,  // b c d
+    0x38, 0x54, 0x54, 0x54, 0x18,  0x00, 0x08, 0x7E, 0x09, 0x02,  0x18, 0xA4, 0xA4, 0x9C, 0x78,  // e f g
+    0x7F, 0x08, 0x04, 0x04, 0x78,  0x00, 0x44, 0x7D, 0x40, 0x00,  0x20, 0x40, 0x40, 0x3D, 0x00,  // h i j
+    0x7F, 0x10, 0x28, 0x44, 0x00,  0x00, 0x41, 0x7F, 0x40, 0x00,  0x7C, 0x04, 0x78, 0x04, 0x78,  // k l m
+    0x7C, 0x08, 0x04, 0x04, 0x78,  0x38, 0x44, 0x44, 0x44, 0x38,  0xFC, 0x18, 0x24, 0x24, 0x18,  // n o p
+    0x18, 0x24, 0x24, 0x18, 0xFC,  0x7C, 0x08, 0x04, 0x04, 0x08,  0x48, 0x54, 0x54, 0x54, 0x24,  // q r s
+    0x04, 0x04, 0x3F, 0x44, 0x24,  0x3C, 0x40, 0x40, 0x20, 0x7C,  0x1C, 0x20, 0x40, 0x20, 0x1C,  // t u v
+    0x3C, 0x40, 0x30, 0x40, 0x3C,  0x44, 0x28, 0x10, 0x28, 0x44,  0x4C, 0x90, 0x90, 0x90, 0x7C,  // w x y
+    0x44, 0x64, 0x54, 0x4C, 0x44,  0x00, 0x08, 0x36, 0x41, 0x00,  0x00, 0x00, 0x77, 0x00, 0x00,  // z { |
+    0x00, 0x41, 0x36, 0x08, 0x00,  0x02, 0x01, 0x02, 0x04, 0x02                                   // } ~
+};
+
+static const uint8_t GLCD_BASELINE = 7;
+
+// UTF-8 → Codepunkt (ungültige Folgen als einzelnes Byte)
+static uint16_t decodeUTF8(const uint8_t* text, size_t* index, size_t length) {
+    uint8_t c = text[(*index)++];
+    if (c < 0x80) return c;
+
+    if ((c & 0xE0) == 0xC0 && *index < length) {
+        return ((c & 0x1F) << 6) | (text[(*index)++] & 0x3F);
+    }
+    if ((c & 0xF0) == 0xE0 && *index + 1 < length) {
+        uint16_t value = ((c & 0x0F) << 12) | ((text[*index] & 0x3F) << 6) | (text[*index + 1] & 0x3F);
+        *index += 2;
+        return value;
+    }
+    if ((c & 0xF8) == 0xF0 && *index + 2 < length) {
+        *index += 3;
+        return 0xFFFD;      // Außerhalb BMP (Emoji) - im GLCD-Font ohnehin leer
+    }
+    return c;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// DISPLAY
+// ═══════════════════════════════════════════════════════════════════════════
+
+TFT_eSPI::TFT_eSPI(int16_t width, int16_t height)
+    : _init_width(width), _init_height(height)
+    , _width(width), _height(height), rotation(0)
+    , cursor_x(0), cursor_y(0)
+    , textcolor(TFT_WHITE), textbgcolor(TFT_WHITE)
+    , textsize(1), textfont(1), textdatum(TL_DATUM)
+    , textwrapX(true), textwrapY(false), _swapBytes(false)
+    , _img(nullptr), _imgDisplayOrder(false)
+{
+    _panel.assign((size_t)_width * _height, 0);
+    _img = _panel.data();
+    resetViewport();
+}
+
+void TFT_eSPI::init(uint8_t tc) {
+    (void)tc;
+    setRotation(rotation);
+    fillScreen(TFT_BLACK);
+}
+
+void TFT_eSPI::setRotation(uint8_t r) {
+    rotation = r & 3;
+    bool landscape = rotation & 1;
+    _width = landscape ? _init_height : _init_width;
+    _height = landscape ? _init_width : _init_height;
+
+    _panel.assign((size_t)_width * _height, 0);
+    _img = _panel.data();
+    resetViewport();
+}
+
+SPIClass& TFT_eSPI::getSPIinstance() {
+    static SPIClass spi;
+    return spi;
+}
+
+int16_t TFT_eSPI::width() {
+    return _vpDatum ? _xWidth : _width;
+}
+
+int16_t TFT_eSPI::height() {
+    return _vpDatum ? _yHeight : _height;
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) {
+    x += _xDatum;
+    y += _yDatum;
+    if (!_img || x < 0 || y < 0 || x >= _width || y >= _height) return 0;
+
+    uint16_t value = _img[y * _width + x];
+    return _imgDisplayOrder ? (uint16_t)((value >> 8) | (value << 8)) : value;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// VIEWPORT
+// ═══════════════════════════════════════════════════════════════════════════
+
+void TFT_eSPI::setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum) {
+    _xDatum = x;
+    _yDatum = y;
+    _xWidth = w;
+    _yHeight = h;
+
+    // Voller Bildschirm als Ausgangslage (width() ohne Datum)
+    _vpDatum = false;
+    _vpOoB = false;
+    _vpX = 0;
+    _vpY = 0;
+    _vpW = width();
+    _vpH = height();
+
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > width()) w = width() - x;
+    if (y + h > height()) h = height() - y;
+
+    if (w < 1 || h < 1) {
+        _xDatum = 0;
+        _yDatum = 0;
+        _xWidth = width();
+        _yHeight = height();
+        _vpOoB = true;
+        return;
+    }
+
+    if (!vpDatum) {
+        _xDatum = 0;
+        _yDatum = 0;
+        _xWidth = width();
+        _yHeight = height();
+    }
+
+    _vpX = x;
+    _vpY = y;
+    _vpW = x + w;
+    _vpH = y + h;
+    _vpDatum = vpDatum;
+}
+
+void TFT_eSPI::resetViewport() {
+    _vpDatum = false;
+    _vpOoB = false;
+    _xDatum = 0;
+    _yDatum = 0;
+    _vpX = 0;
+    _vpY = 0;
+    _vpW = _width;
+    _vpH = _height;
+    _xWidth = _width;
+    _yHeight = _height;
+}
+
+bool TFT_eSPI::checkViewport(int32_t x, int32_t y, int32_t w, int32_t h) {
+    if (_vpOoB) return false;
+    x += _xDatum;
+    y += _yDatum;
+    if (x >= _vpW || y >= _vpH) return false;
+    if (x + w <= _vpX || y + h <= _vpY) return false;
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// GRUNDPRIMITIVE
+// ═══════════════════════════════════════════════════════════════════════════
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+    if (_vpOoB || !_img) return;
+
+    x += _xDatum;
+    y += _yDatum;
+    if (x < _vpX || y < _vpY || x >= _vpW || y >= _vpH) return;
+
+    storePixel(x, y, color);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+    if (_vpOoB || !_img) return;
+
+    x += _xDatum;
+    y += _yDatum;
+    if (y < _vpY || x >= _vpW || y >= _vpH) return;
+    if (x < _vpX) { w += x - _vpX; x = _vpX; }
+    if (x + w > _vpW) w = _vpW - x;
+    if (w < 1) return;
+
+    for (int32_t i = 0; i < w; i++) storePixel(x + i, y, color);
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+    if (_vpOoB || !_img) return;
+
+    x += _xDatum;
+    y += _yDatum;
+    if (x < _vpX || x >= _vpW || y >= _vpH) return;
+    if (y < _vpY) { h += y - _vpY; y = _vpY; }
+    if (y + h > _vpH) h = _vpH - y;
+    if (h < 1) return;
+
+    for (int32_t i = 0; i < h; i++) storePixel(x, y + i, color);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    if (_vpOoB || !_img) return;
+
+    x += _xDatum;
+    y += _yDatum;
+    if (x >= _vpW || y >= _vpH) return;
+    if (x < _vpX) { w += x - _vpX; x = _vpX; }
+    if (y < _vpY) { h += y - _vpY; y = _vpY; }
+    if (x + w > _vpW) w = _vpW - x;
+    if (y + h > _vpH) h = _vpH - y;
+    if (w < 1 || h < 1) return;
+
+    for (int32_t row = 0; row < h; row++) {
+        for (int32_t col = 0; col < w; col++) storePixel(x + col, y + row, color);
+    }
+}
+
+void TFT_eSPI::drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color) {
+    // Bresenham in Läufen (wie TFT_eSprite::drawLine)
+    bool steep = abs(ye - ys) > abs(xe - xs);
+    if (steep) {
+        std::swap(xs, ys);
+        std::swap(xe, ye);
+    }
+    if (xs > xe) {
+        std::swap(xs, xe);
+        std::swap(ys, ye);
+    }
+
+    int32_t dx = xe - xs;
+    int32_t dy = abs(ye - ys);
+    int32_t err = dx >> 1;
+    int32_t ystep = ys < ye ? 1 : -1;
+    int32_t xstart = xs;
+    int32_t dlen = 0;
+
+    for (; xs <= xe; xs++) {
+        dlen++;
+        err -= dy;
+        if (err < 0) {
+            err += dx;
+            if (steep) {
+                if (dlen == 1) drawPixel(ys, xstart, color);
+                else drawFastVLine(ys, xstart, dlen, color);
+            } else {
+                if (dlen == 1) drawPixel(xstart, ys, color);
+                else drawFastHLine(xstart, ys, dlen, color);
+            }
+            dlen = 0;
+            ys += ystep;
+            xstart = xs + 1;
+        }
+    }
+    if (dlen) {
+        if (steep) drawFastVLine(ys, xstart, dlen, color);
+        else drawFastHLine(xstart, ys, dlen, color);
+    }
+}
+
+void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size) {
+    if (_vpOoB) return;
+    if (size == 0) size = 1;
+
+    // Zeichen komplett außerhalb des Viewports
+    if (x >= _vpW - _xDatum || y >= _vpH - _yDatum ||
+        x + 6 * size - 1 < _vpX - _xDatum || y + 8 * size - 1 < _vpY - _yDatum) {
+        return;
+    }
+
+    bool fillbg = (bg != color);
+    const uint8_t* glyph = (c >= GLCD_FIRST && c <= GLCD_LAST) ? GLCD_FONT + (c - GLCD_FIRST) * 5 : nullptr;
+
+    for (int8_t i = 0; i < 6; i++) {
+        uint8_t line = (i < 5 && glyph) ? glyph[i] : 0;
+        for (int8_t j = 0; j < 8; j++, line >>= 1) {
+            if (line & 0x1) {
+                if (size == 1) drawPixel(x + i, y + j, color);
+                else fillRect(x + i * size, y + j * size, size, size, color);
+            } else if (fillbg) {
+                if (size == 1) drawPixel(x + i, y + j, bg);
+                else fillRect(x + i * size, y + j * size, size, size, bg);
+            }
+        }
+    }
+}
+
+int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font) {
+    (void)font;     // Nur GLCD-Font
+    drawChar(x, y, uniCode, textcolor, textbgcolor, textsize);
+    return 6 * textsize;
+}
+
+int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y) {
+    return drawChar(uniCode, x, y, textfont);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ZUSAMMENGESETZTE PRIMITIVE
+// ═══════════════════════════════════════════════════════════════════════════
+
+void TFT_eSPI::fillScreen(uint32_t color) {
+    fillRect(0, 0, _width, _height, color);
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    drawFastHLine(x, y, w, color);
+    drawFastHLine(x, y + h - 1, w, color);
+    drawFastVLine(x, y + 1, h - 2, color);
+    drawFastVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+void TFT_eSPI::drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, uint32_t color) {
+    int32_t f = 1 - r;
+    int32_t ddF_x = 1;
+    int32_t ddF_y = -2 * r;
+    int32_t x = 0;
+
+    while (x < r) {
+        if (f >= 0) {
+            r--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        if (cornername & 0x4) {
+            drawPixel(x0 + x, y0 + r, color);
+            drawPixel(x0 + r, y0 + x, color);
+        }
+        if (cornername & 0x2) {
+            drawPixel(x0 + x, y0 - r, color);
+            drawPixel(x0 + r, y0 - x, color);
+        }
+        if (cornername & 0x8) {
+            drawPixel(x0 - r, y0 + x, color);
+            drawPixel(x0 - x, y0 + r, color);
+        }
+        if (cornername & 0x1) {
+            drawPixel(x0 - r, y0 - x, color);
+            drawPixel(x0 - x, y0 - r, color);
+        }
+    }
+}
+
+void TFT_eSPI::fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, int32_t delta, uint32_t color) {
+    int32_t f = 1 - r;
+    int32_t ddF_x = 1;
+    int32_t ddF_y = -r - r;
+    int32_t y = 0;
+
+    delta++;
+    while (y < r) {
+        if (f >= 0) {
+            if (cornername & 0x1) drawFastHLine(x0 - y, y0 + r, y + y + delta, color);
+            if (cornername & 0x2) drawFastHLine(x0 - y, y0 - r, y + y + delta, color);
+            r--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+
+        y++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        if (cornername & 0x1) drawFastHLine(x0 - r, y0 + y, r + r + delta, color);
+        if (cornername & 0x2) drawFastHLine(x0 - r, y0 - y, r + r + delta, color);
+    }
+}
+
+void TFT_eSPI::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+    drawFastHLine(x + r, y, w - r - r, color);
+    drawFastHLine(x + r, y + h - 1, w - r - r, color);
+    drawFastVLine(x, y + r, h - r - r, color);
+    drawFastVLine(x + w - 1, y + r, h - r - r, color);
+
+    drawCircleHelper(x + r, y + r, r, 1, color);
+    drawCircleHelper(x + w - r - 1, y + r, r, 2, color);
+    drawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+    drawCircleHelper(x + r, y + h - r - 1, r, 8, color);
+}
+
+void TFT_eSPI::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+    fillRect(x, y + r, w, h - r - r, color);
+
+    fillCircleHelper(x + r, y + h - r - 1, r, 1, w - r - r - 1, color);
+    fillCircleHelper(x + r, y + r, r, 2, w - r - r - 1, color);
+}
+
+void TFT_eSPI::drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+    if (r <= 0) return;
+
+    int32_t x = 1;
+    int32_t dx = 1;
+    int32_t dy = r + r;
+    int32_t p = -(r >> 1);
+
+    drawPixel(x0 + r, y0, color);
+    drawPixel(x0 - r, y0, color);
+    drawPixel(x0, y0 - r, color);
+    drawPixel(x0, y0 + r, color);
+
+    while (x < r) {
+        if (p >= 0) {
+            dy -= 2;
+            p -= dy;
+            r--;
+        }
+
+        dx += 2;
+        p += dx;
+
+        drawPixel(x0 + x, y0 + r, color);
+        drawPixel(x0 - x, y0 + r, color);
+        drawPixel(x0 - x, y0 - r, color);
+        drawPixel(x0 + x, y0 - r, color);
+        if (r == x) break;
+        drawPixel(x0 + r, y0 + x, color);
+        drawPixel(x0 - r, y0 + x, color);
+        drawPixel(x0 - r, y0 - x, color);
+        drawPixel(x0 + r, y0 - x, color);
+        x++;
+    }
+}
+
+void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+    int32_t x = 0;
+    int32_t dx = 1;
+    int32_t dy = r + r;
+    int32_t p = -(r >> 1);
+
+    drawFastHLine(x0 - r, y0, dy + 1, color);
+
+    while (x < r) {
+        if (p >= 0) {
+            drawFastHLine(x0 - x, y0 + r, 2 * x + 1, color);
+            drawFastHLine(x0 - x, y0 - r, 2 * x + 1, color);
+            dy -= 2;
+            p -= dy;
+            r--;
+        }
+
+        dx += 2;
+        p += dx;
+        x++;
+
+        drawFastHLine(x0 - r, y0 + x, 2 * r + 1, color);
+        drawFastHLine(x0 - r, y0 - x, 2 * r + 1, color);
+    }
+}
+
+void TFT_eSPI::drawTriangle(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint32_t color) {
+    drawLine(x1, y1, x2, y2, color);
+    drawLine(x2, y2, x3, y3, color);
+    drawLine(x3, y3, x1, y1, color);
+}
+
+void TFT_eSPI::fillTriangle(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint32_t color) {
+    // Nach y sortieren, dann Scanlines (wie Adafruit_GFX/TFT_eSPI)
+    if (y1 > y2) { std::swap(y1, y2); std::swap(x1, x2); }
+    if (y2 > y3) { std::swap(y3, y2); std::swap(x3, x2); }
+    if (y1 > y2) { std::swap(y1, y2); std::swap(x1, x2); }
+
+    if (y1 == y3) {
+        int32_t a = std::min({x1, x2, x3});
+        int32_t b = std::max({x1, x2, x3});
+        drawFastHLine(a, y1, b - a + 1, color);
+        return;
+    }
+
+    int32_t dx12 = x2 - x1, dy12 = y2 - y1;
+    int32_t dx13 = x3 - x1, dy13 = y3 - y1;
+    int32_t dx23 = x3 - x2, dy23 = y3 - y2;
+    int32_t sa = 0, sb = 0;
+    int32_t last = (y2 == y3) ? y2 : y2 - 1;
+    int32_t y;
+
+    for (y = y1; y <= last; y++) {
+        int32_t a = x1 + sa / dy12;
+        int32_t b = x1 + sb / dy13;
+        sa += dx12;
+        sb += dx13;
+        if (a > b) std::swap(a, b);
+        drawFastHLine(a, y, b - a + 1, color);
+    }
+
+    sa = dx23 * (y - y2);
+    sb = dx13 * (y - y1);
+    for (; y <= y3; y++) {
+        int32_t a = x2 + sa / dy23;
+        int32_t b = x1 + sb / dy13;
+        sa += dx23;
+        sb += dx13;
+        if (a > b) std::swap(a, b);
+        drawFastHLine(a, y, b - a + 1, color);
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// PIXEL-BLÖCKE
+// ═══════════════════════════════════════════════════════════════════════════
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data) {
+    pushImage(x, y, w, h, const_cast<const uint16_t*>(data));
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+    if (_vpOoB || !_img || !data) return;
+
+    x += _xDatum;
+    y += _yDatum;
+    if (x >= _vpW || y >= _vpH) return;
+
+    int32_t dx = 0, dy = 0, dw = w, dh = h;
+    if (x < _vpX) { dx = _vpX - x; dw -= dx; x = _vpX; }
+    if (y < _vpY) { dy = _vpY - y; dh -= dy; y = _vpY; }
+    if (x + dw > _vpW) dw = _vpW - x;
+    if (y + dh > _vpH) dh = _vpH - y;
+    if (dw < 1 || dh < 1) return;
+
+    // Ohne swapBytes liegen die Daten in Display-Byte-Reihenfolge vor
+    for (int32_t row = 0; row < dh; row++) {
+        const uint16_t* line = data + (dy + row) * w + dx;
+        for (int32_t col = 0; col < dw; col++) {
+            uint16_t value = line[col];
+            uint16_t color = _swapBytes ? value : (uint16_t)((value >> 8) | (value << 8));
+            storePixel(x + col, y + row, color);
+        }
+    }
+}
+
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer) {
+    (void)buffer;
+    pushImage(x, y, w, h, data);
+}
+
+void TFT_eSPI::readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data) {
+    for (int32_t row = 0; row < h; row++) {
+        for (int32_t col = 0; col < w; col++) {
+            uint16_t color = readPixel(x + col, y + row);
+            data[row * w + col] = _swapBytes ? color : (uint16_t)((color >> 8) | (color << 8));
+        }
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TEXT
+// ═══════════════════════════════════════════════════════════════════════════
+
+int16_t TFT_eSPI::textWidth(const char* string) {
+    if (!string) return 0;
+
+    size_t length = strlen(string);
+    size_t index = 0;
+    int16_t width = 0;
+    while (index < length) {
+        decodeUTF8(reinterpret_cast<const uint8_t*>(string), &index, length);
+        width += 6;
+    }
+    return width * textsize;
+}
+
+int16_t TFT_eSPI::drawString(const char* string, int32_t poX, int32_t poY) {
+    if (!string) return 0;
+
+    int16_t cwidth = textWidth(string);
+    int16_t cheight = 8 * textsize;
+    int16_t baseline = GLCD_BASELINE * textsize;
+
+    switch (textdatum) {
+        case TC_DATUM:   poX -= cwidth / 2; break;
+        case TR_DATUM:   poX -= cwidth; break;
+        case ML_DATUM:   poY -= cheight / 2; break;
+        case MC_DATUM:   poX -= cwidth / 2; poY -= cheight / 2; break;
+        case MR_DATUM:   poX -= cwidth; poY -= cheight / 2; break;
+        case BL_DATUM:   poY -= cheight; break;
+        case BC_DATUM:   poX -= cwidth / 2; poY -= cheight; break;
+        case BR_DATUM:   poX -= cwidth; poY -= cheight; break;
+        case L_BASELINE: poY -= baseline; break;
+        case C_BASELINE: poX -= cwidth / 2; poY -= baseline; break;
+        case R_BASELINE: poX -= cwidth; poY -= baseline; break;
+        default: break;
+    }
+
+    size_t length = strlen(string);
+    size_t index = 0;
+    int16_t sumX = 0;
+    while (index < length) {
+        uint16_t uniCode = decodeUTF8(reinterpret_cast<const uint8_t*>(string), &index, length);
+        sumX += drawChar(uniCode, poX + sumX, poY, textfont);
+    }
+    return sumX;
+}
+
+int16_t TFT_eSPI::drawCentreString(const char* string, int32_t x, int32_t y, uint8_t font) {
+    uint8_t datum = textdatum;
+    uint8_t previousFont = textfont;
+    textdatum = TC_DATUM;
+    textfont = font;
+    int16_t width = drawString(string, x, y);
+    textdatum = datum;
+    textfont = previousFont;
+    return width;
+}
+
+int16_t TFT_eSPI::drawNumber(long number, int32_t x, int32_t y) {
+    char buffer[24];
+    snprintf(buffer, sizeof(buffer), "%ld", number);
+    return drawString(buffer, x, y);
+}
+
+size_t TFT_eSPI::write(uint8_t c) {
+    if (c == '\n') {
+        cursor_y += 8 * textsize;
+        cursor_x = 0;
+        return 1;
+    }
+    if (c == '\r') return 1;
+
+    if (textwrapX && cursor_x + 6 * textsize > width()) {
+        cursor_y += 8 * textsize;
+        cursor_x = 0;
+    }
+    drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+    cursor_x += 6 * textsize;
+    return 1;
+}
+
+size_t TFT_eSPI::print(const char* text) {
+    size_t count = 0;
+    for (const char* c = text; c && *c; c++) count += write((uint8_t)*c);
+    return count;
+}
+
+size_t TFT_eSPI::print(double number, int decimals) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.*f", decimals, number);
+    return print(buffer);
+}
+
+size_t TFT_eSPI::printNumber(const char* format, long number) {
+    char buffer[24];
+    snprintf(buffer, sizeof(buffer), format, number);
+    return print(buffer);
+}
+
+size_t TFT_eSPI::printf(const char* format, ...) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    return print(buffer);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// SPRITE
+// ═══════════════════════════════════════════════════════════════════════════
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI* tft)
+    : TFT_eSPI(0, 0), _tft(tft), _created(false), _bpp(16)
+    , _sx(0), _sy(0), _sw(0), _sh(0), _scolor(TFT_BLACK)
+{
+    _panel.clear();
+    _img = nullptr;
+    _imgDisplayOrder = true;
+}
+
+TFT_eSprite::~TFT_eSprite() {
+    deleteSprite();
+}
+
+void* TFT_eSprite::createSprite(int16_t width, int16_t height, uint8_t frames) {
+    (void)frames;
+    if (_created) return _img;
+    if (width < 1 || height < 1) return nullptr;
+
+    _buffer.assign((size_t)width * height, 0);
+    _img = _buffer.data();
+    _init_width = _width = width;
+    _init_height = _height = height;
+    _created = true;
+
+    _sx = 0;
+    _sy = 0;
+    _sw = width;
+    _sh = height;
+
+    resetViewport();
+    return _img;
+}
+
+void TFT_eSprite::deleteSprite() {
+    if (!_created) return;
+
+    _buffer.clear();
+    _buffer.shrink_to_fit();
+    _img = nullptr;
+    _created = false;
+    _width = _height = 0;
+    resetViewport();
+}
+
+void* TFT_eSprite::setColorDepth(int8_t bpp) {
+    // Nur 16 Bit (alle Sprites der UI)
+    if (bpp != 16) {
+        Serial.printf("TFT_eSprite (Host): ⚠️ %d Bit nicht unterstützt, nutze 16 Bit\n", bpp);
+    }
+    _bpp = 16;
+    return _img;
+}
+
+void TFT_eSprite::fillSprite(uint32_t color) {
+    if (!_created || _vpOoB) return;
+    fillRect(_vpX - _xDatum, _vpY - _yDatum, _vpW - _vpX, _vpH - _vpY, color);
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+    if (!_created || !_tft) return;
+
+    bool swap = _tft->getSwapBytes();
+    _tft->setSwapBytes(false);
+    _tft->pushImage(x, y, _width, _height, _img);
+    _tft->setSwapBytes(swap);
+}
+
+void TFT_eSprite::setScrollRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > _width) w = _width - x;
+    if (y + h > _height) h = _height - y;
+    if (w < 1 || h < 1) return;
+
+    _sx = x;
+    _sy = y;
+    _sw = w;
+    _sh = h;
+    _scolor = color;
+}
+
+void TFT_eSprite::scroll(int16_t dx, int16_t dy) {
+    if (!_created || abs(dx) >= _sw || abs(dy) >= _sh) {
+        if (_created) {
+            for (int32_t row = 0; row < _sh; row++) {
+                for (int32_t col = 0; col < _sw; col++) storePixel(_sx + col, _sy + row, _scolor);
+            }
+        }
+        return;
+    }
+
+    // Block verschieben (Quelle und Ziel überlappen → Richtung beachten)
+    int32_t w = _sw - abs(dx);
+    int32_t h = _sh - abs(dy);
+    int32_t srcX = dx < 0 ? _sx - dx : _sx;
+    int32_t srcY = dy < 0 ? _sy - dy : _sy;
+    int32_t dstX = dx < 0 ? _sx : _sx + dx;
+    int32_t dstY = dy < 0 ? _sy : _sy + dy;
+
+    if (dy > 0) {
+        for (int32_t row = h - 1; row >= 0; row--) {
+            memmove(_img + (dstY + row) * _width + dstX, _img + (srcY + row) * _width + srcX, w * sizeof(uint16_t));
+        }
+    } else {
+        for (int32_t row = 0; row < h; row++) {
+            memmove(_img + (dstY + row) * _width + dstX, _img + (srcY + row) * _width + srcX, w * sizeof(uint16_t));
+        }
+    }
+
+    // Freigelegte Streifen füllen
+    for (int32_t row = 0; row < _sh; row++) {
+        for (int32_t col = 0; col < _sw; col++) {
+            bool exposedX = dx > 0 ? col < dx : (dx < 0 && col >= _sw + dx);
+            bool exposedY = dy > 0 ? row < dy : (dy < 0 && row >= _sh + dy);
+            if (exposedX || exposedY) storePixel(_sx + col, _sy + row, _scolor);
+        }
+    }
+}
@@ -0,0 +1,251 @@
+/**
+ * TFT_eSPI.h (Host-Shim)
+ *
+ * Software-Rasterizer mit der Schnittstelle von TFT_eSPI/TFT_eSprite:
+ * - Gleiche virtuelle Grundprimitive (drawPixel, drawFastHLine/VLine, fillRect,
+ *   drawLine, drawChar) - zusammengesetzte Primitive (fillRoundRect, drawCircle,
+ *   drawString, ...) rufen sie auf wie die Bibliothek, UIFrameBuffer zählt also
+ *   dieselben Aufrufe wie auf dem Gerät
+ * - Viewport/Datum (_vpX.._vpOoB, _xDatum/_yDatum) mit denselben Regeln
+ * - Display: RGB565-Panel im Speicher (native Farbwerte)
+ * - Sprite: Puffer in Display-Byte-Reihenfolge wie TFT_eSprite (16 Bit)
+ * - Eingebauter GLCD-Font (Font 1, 5x7 in 6x8-Zelle, setTextSize skaliert)
+ *
+ * Nicht nachgebildet: SPI/DMA-Timing (pushImageDMA kopiert sofort),
+ * Hardware-Rotation (Panel hat die Größe der aktuellen Rotation),
+ * Smooth-/Free-Fonts der Bibliothek (UIFont rendert selbst).
+ */
+
+#ifndef HOST_TFT_ESPI_H
+#define HOST_TFT_ESPI_H
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <vector>
+
+#ifndef TFT_WIDTH
+#define TFT_WIDTH  320
+#endif
+#ifndef TFT_HEIGHT
+#define TFT_HEIGHT 480
+#endif
+
+// Farben (RGB565)
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_DARKCYAN    0x03EF
+#define TFT_MAROON      0x7800
+#define TFT_PURPLE      0x780F
+#define TFT_OLIVE       0x7BE0
+#define TFT_LIGHTGREY   0xD69A
+#define TFT_DARKGREY    0x7BEF
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_ORANGE      0xFDA0
+#define TFT_GREENYELLOW 0xB7E0
+#define TFT_PINK        0xFE19
+#define TFT_BROWN       0x9A60
+#define TFT_GOLD        0xFEA0
+#define TFT_SILVER      0xC618
+#define TFT_SKYBLUE     0x867D
+#define TFT_VIOLET      0x915C
+#define TFT_TRANSPARENT 0x0120
+
+// Text-Datum
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define CL_DATUM 3
+#define MC_DATUM 4
+#define CC_DATUM 4
+#define MR_DATUM 5
+#define CR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+#define L_BASELINE  9
+#define C_BASELINE 10
+#define R_BASELINE 11
+
+// Attribute
+#define CP437_SWITCH 1
+#define UTF8_SWITCH  2
+#define PSRAM_ENABLE 3
+
+class TFT_eSPI {
+public:
+    TFT_eSPI(int16_t width = TFT_WIDTH, int16_t height = TFT_HEIGHT);
+    virtual ~TFT_eSPI() {}
+
+    void init(uint8_t tc = 0);
+    void begin(uint8_t tc = 0) { init(tc); }
+
+    // Grundprimitive (virtuell wie in TFT_eSPI)
+    virtual void drawPixel(int32_t x, int32_t y, uint32_t color);
+    virtual void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size);
+    virtual void drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color);
+    virtual void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+    virtual void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+    virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    virtual int16_t drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font);
+    virtual int16_t drawChar(uint16_t uniCode, int32_t x, int32_t y);
+    virtual int16_t width();
+    virtual int16_t height();
+    virtual uint16_t readPixel(int32_t x, int32_t y);
+
+    // Zusammengesetzte Primitive
+    void fillScreen(uint32_t color);
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+    void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+    void drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+    void fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+    void drawTriangle(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint32_t color);
+    void fillTriangle(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint32_t color);
+
+    // Pixel-Blöcke
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data);
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+    void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer = nullptr);
+    void readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data);
+    void setSwapBytes(bool swap) { _swapBytes = swap; }
+    bool getSwapBytes() { return _swapBytes; }
+
+    // Viewport
+    void setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum = true);
+    void resetViewport();
+    bool checkViewport(int32_t x, int32_t y, int32_t w, int32_t h);
+    int32_t getViewportX() { return _xDatum; }
+    int32_t getViewportY() { return _yDatum; }
+    int32_t getViewportWidth() { return _xWidth; }
+    int32_t getViewportHeight() { return _yHeight; }
+    bool getViewportDatum() { return _vpDatum; }
+
+    // Text (GLCD-Font)
+    void setTextColor(uint16_t color) { textcolor = textbgcolor = color; }
+    void setTextColor(uint16_t fg, uint16_t bg, bool bgfill = false) { textcolor = fg; textbgcolor = bg; (void)bgfill; }
+    void setTextSize(uint8_t size) { textsize = size > 0 ? size : 1; }
+    void setTextDatum(uint8_t datum) { textdatum = datum; }
+    uint8_t getTextDatum() { return textdatum; }
+    void setTextFont(uint8_t font) { textfont = font; }
+    void setTextWrap(bool wrapX, bool wrapY = false) { textwrapX = wrapX; textwrapY = wrapY; }
+    void setTextPadding(uint16_t) {}
+    void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+    int16_t getCursorX() { return cursor_x; }
+    int16_t getCursorY() { return cursor_y; }
+    int16_t textWidth(const char* string);
+    int16_t textWidth(const String& string) { return textWidth(string.c_str()); }
+    int16_t fontHeight() { return 8 * textsize; }
+    int16_t drawString(const char* string, int32_t x, int32_t y);
+    int16_t drawString(const String& string, int32_t x, int32_t y) { return drawString(string.c_str(), x, y); }
+    int16_t drawCentreString(const char* string, int32_t x, int32_t y, uint8_t font);
+    int16_t drawNumber(long number, int32_t x, int32_t y);
+
+    // Print (Cursor)
+    size_t write(uint8_t c);
+    size_t print(const char* text);
+    size_t print(const String& text) { return print(text.c_str()); }
+    size_t print(int number) { return printNumber("%d", number); }
+    size_t print(long number) { return printNumber("%ld", number); }
+    size_t print(unsigned long number) { return printNumber("%lu", number); }
+    size_t print(double number, int decimals = 2);
+    size_t println(const char* text = "") { return print(text) + write('\n'); }
+    size_t printf(const char* format, ...);
+
+    // Display-Steuerung
+    void setRotation(uint8_t r);
+    uint8_t getRotation() { return rotation; }
+    void invertDisplay(bool) {}
+    void writecommand(uint8_t) {}
+    void writedata(uint8_t) {}
+    void startWrite() {}
+    void endWrite() {}
+    SPIClass& getSPIinstance();
+    uint16_t color565(uint8_t r, uint8_t g, uint8_t b) { return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3); }
+
+    // DMA (synchron: pushImageDMA ist sofort fertig)
+    bool initDMA(bool ctrl_cs = false) { (void)ctrl_cs; return true; }
+    void deInitDMA() {}
+    bool dmaBusy() { return false; }
+    void dmaWait() {}
+
+    /**
+     * Host: Panel-Pixel (native RGB565, zeilenweise, width() x height())
+     */
+    const uint16_t* getPanelPixels() const { return _img; }
+
+protected:
+    int32_t _init_width, _init_height;
+    int32_t _width, _height;
+    uint8_t rotation;
+
+    // Viewport
+    int32_t _vpX, _vpY, _vpW, _vpH;
+    int32_t _xDatum, _yDatum;
+    int32_t _xWidth, _yHeight;
+    bool _vpDatum;
+    bool _vpOoB;
+
+    // Text
+    int32_t cursor_x, cursor_y;
+    uint32_t textcolor, textbgcolor;
+    uint8_t textsize, textfont, textdatum;
+    bool textwrapX, textwrapY;
+    bool _swapBytes;
+
+    // Zeichenspeicher (Display: Panel, Sprite: Puffer)
+    uint16_t* _img;
+    bool _imgDisplayOrder;      // true = Display-Byte-Reihenfolge (Sprite)
+    std::vector<uint16_t> _panel;
+
+    void storePixel(int32_t x, int32_t y, uint16_t color) {
+        _img[y * _width + x] = _imgDisplayOrder ? (uint16_t)((color >> 8) | (color << 8)) : color;
+    }
+
+private:
+    void drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, uint32_t color);
+    void fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, int32_t delta, uint32_t color);
+    size_t printNumber(const char* format, long number);
+};
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+    explicit TFT_eSprite(TFT_eSPI* tft);
+    ~TFT_eSprite() override;
+
+    void* createSprite(int16_t width, int16_t height, uint8_t frames = 1);
+    void deleteSprite();
+    bool created() const { return _created; }
+
+    void* setColorDepth(int8_t bpp);
+    int8_t getColorDepth() { return _bpp; }
+    void setAttribute(uint8_t attr, uint8_t value) { (void)attr; (void)value; }
+    void* getPointer() { return _created ? _img : nullptr; }
+
+    void fillSprite(uint32_t color);
+    void pushSprite(int32_t x, int32_t y);
+
+    int16_t width() override { return _created ? (_vpDatum ? _xWidth : _width) : 0; }
+    int16_t height() override { return _created ? (_vpDatum ? _yHeight : _height) : 0; }
+
+    // Scrollen innerhalb eines Rechtecks (freigelegte Fläche = color)
+    void setScrollRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color = TFT_BLACK);
+    void scroll(int16_t dx, int16_t dy = 0);
+
+protected:
+    TFT_eSPI* _tft;
+    bool _created;
+    int8_t _bpp;
+    std::vector<uint16_t> _buffer;
+    int32_t _sx, _sy, _sw, _sh;
+    uint16_t _scolor;
+};
+
+#endif // HOST_TFT_ESPI_H
@@ -0,0 +1,10 @@
+/**
+ * WiFi.h (Host-Shim)
+ */
+
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+
+#endif // HOST_WIFI_H
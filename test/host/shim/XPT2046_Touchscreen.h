@@ -0,0 +1,22 @@
+/**
+ * XPT2046_Touchscreen.h (Host-Shim)
+ *
+ * Nur TS_Point für TouchManager.h (Touch-Eingaben gibt es auf dem Host nicht).
+ */
+
+#ifndef HOST_XPT2046_TOUCHSCREEN_H
+#define HOST_XPT2046_TOUCHSCREEN_H
+
+#include <SPI.h>
+
+class TS_Point {
+public:
+    TS_Point() : x(0), y(0), z(0) {}
+    TS_Point(int16_t x, int16_t y, int16_t z) : x(x), y(y), z(z) {}
+
+    int16_t x, y, z;
+};
+
+class XPT2046_Touchscreen;
+
+#endif // HOST_XPT2046_TOUCHSCREEN_H
@@ -0,0 +1,10 @@
+/**
+ * esp32-hal.h (Host-Shim)
+ */
+
+#ifndef HOST_ESP32_HAL_H
+#define HOST_ESP32_HAL_H
+
+#include <Arduino.h>
+
+#endif // HOST_ESP32_HAL_H
@@ -0,0 +1,26 @@
+/**
+ * esp_heap_caps.h (Host-Shim)
+ *
+ * Alle Speicherarten liegen im Host-Heap.
+ */
+
+#ifndef HOST_ESP_HEAP_CAPS_H
+#define HOST_ESP_HEAP_CAPS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+#define HOST_HEAP_FREE_BYTES (8UL * 1024 * 1024)
+
+inline void* heap_caps_malloc(size_t size, uint32_t caps) { (void)caps; return malloc(size); }
+inline void heap_caps_free(void* memory) { free(memory); }
+inline size_t heap_caps_get_free_size(uint32_t caps) { (void)caps; return HOST_HEAP_FREE_BYTES; }
+inline size_t heap_caps_get_largest_free_block(uint32_t caps) { (void)caps; return HOST_HEAP_FREE_BYTES; }
+
+#endif // HOST_ESP_HEAP_CAPS_H
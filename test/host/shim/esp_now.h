@@ -0,0 +1,36 @@
+/**
+ * esp_now.h (Host-Shim)
+ *
+ * Nur Typen für ESPNowManager.h (Funk gibt es auf dem Host nicht).
+ */
+
+#ifndef HOST_ESP_NOW_H
+#define HOST_ESP_NOW_H
+
+#include <stdint.h>
+
+#define ESP_NOW_ETH_ALEN 6
+#define ESP_NOW_KEY_LEN 16
+#define ESP_NOW_MAX_DATA_LEN 250
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+typedef enum {
+    ESP_NOW_SEND_SUCCESS = 0,
+    ESP_NOW_SEND_FAIL
+} esp_now_send_status_t;
+
+typedef struct {
+    uint8_t* src_addr;
+    uint8_t* des_addr;
+    void* rx_ctrl;
+} esp_now_recv_info_t;
+
+typedef struct {
+    uint8_t* src_addr;
+    uint8_t* des_addr;
+} wifi_tx_info_t;
+
+#endif // HOST_ESP_NOW_H
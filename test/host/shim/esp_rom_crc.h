@@ -0,0 +1,24 @@
+/**
+ * esp_rom_crc.h (Host-Shim)
+ *
+ * CRC32 (IEEE 802.3, reflektiert) wie die ROM-Funktion des ESP32:
+ * esp_rom_crc32_le(0, data, len) entspricht zlib crc32().
+ */
+
+#ifndef HOST_ESP_ROM_CRC_H
+#define HOST_ESP_ROM_CRC_H
+
+#include <stdint.h>
+
+inline uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t* data, uint32_t length) {
+    crc = ~crc;
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320UL & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+#endif // HOST_ESP_ROM_CRC_H
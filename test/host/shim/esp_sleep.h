@@ -0,0 +1,23 @@
+/**
+ * esp_sleep.h (Host-Shim)
+ *
+ * Nur Typen für PowerManager.h (Sleep gibt es auf dem Host nicht).
+ */
+
+#ifndef HOST_ESP_SLEEP_H
+#define HOST_ESP_SLEEP_H
+
+#include <stdint.h>
+
+typedef int gpio_num_t;
+
+typedef enum {
+    ESP_SLEEP_WAKEUP_UNDEFINED = 0,
+    ESP_SLEEP_WAKEUP_EXT0 = 2,
+    ESP_SLEEP_WAKEUP_EXT1 = 3,
+    ESP_SLEEP_WAKEUP_TIMER = 4,
+    ESP_SLEEP_WAKEUP_TOUCHPAD = 5,
+    ESP_SLEEP_WAKEUP_GPIO = 7
+} esp_sleep_wakeup_cause_t;
+
+#endif // HOST_ESP_SLEEP_H
@@ -0,0 +1,10 @@
+/**
+ * esp_wifi.h (Host-Shim)
+ */
+
+#ifndef HOST_ESP_WIFI_H
+#define HOST_ESP_WIFI_H
+
+#include "esp_now.h"
+
+#endif // HOST_ESP_WIFI_H
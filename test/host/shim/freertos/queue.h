@@ -0,0 +1,12 @@
+/**
+ * queue.h (Host-Shim)
+ *
+ * Nur Typen: Queues nutzen Touch-Task und ESP-NOW, beide nicht im Host-Build.
+ */
+
+#ifndef HOST_FREERTOS_QUEUE_H
+#define HOST_FREERTOS_QUEUE_H
+
+#include "FreeRTOS.h"
+
+#endif // HOST_FREERTOS_QUEUE_H
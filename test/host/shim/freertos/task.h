@@ -0,0 +1,14 @@
+/**
+ * task.h (Host-Shim)
+ *
+ * Nur Typen: der Host-Build startet keine Tasks.
+ */
+
+#ifndef HOST_FREERTOS_TASK_H
+#define HOST_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+typedef void (*TaskFunction_t)(void*);
+
+#endif // HOST_FREERTOS_TASK_H
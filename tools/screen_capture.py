@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+"""
+screen_capture.py - Host-Decoder für den 'screen'-Befehl (ScreenCapture)
+
+Liest die SCR-Zeilen vom seriellen Port (oder aus einem Mitschnitt), setzt die
+RLE-Kacheln zu einem RGB565-Bild zusammen und schreibt pro Frame ein PNG.
+Andere Ausgaben (Logs, Echo) werden übersprungen, beschädigte Zeilen
+(Adler-32) verworfen - der nächste Keyframe ersetzt sie.
+
+Beispiele:
+  python3 screen_capture.py --port /dev/ttyACM0 --once          # Screenshot
+  python3 screen_capture.py --port /dev/ttyACM0 --stream 500    # Stream bis Strg+C
+  python3 screen_capture.py --file mitschnitt.log               # Mitschnitt dekodieren
+
+Benötigt pyserial nur für --port (pip install pyserial).
+"""
+
+import argparse
+import base64
+import os
+import struct
+import sys
+import time
+import zlib
+
+
+def decode_rle(data, count):
+    """RLE → Liste von RGB565-Werten (Kopfbyte: Bit 7 = Wiederholung)"""
+    pixels = []
+    i = 0
+    while i < len(data):
+        head = data[i]
+        i += 1
+        if head & 0x80:
+            value = (data[i] << 8) | data[i + 1]
+            i += 2
+            pixels.extend([value] * ((head & 0x7F) + 1))
+        else:
+            for _ in range(head + 1):
+                pixels.append((data[i] << 8) | data[i + 1])
+                i += 2
+    if len(pixels) != count:
+        raise ValueError("RLE: %d statt %d Pixel" % (len(pixels), count))
+    return pixels
+
+
+def rgb565_to_rgb888(value):
+    r = (value >> 11) & 0x1F
+    g = (value >> 5) & 0x3F
+    b = value & 0x1F
+    return (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)
+
+
+def write_png(path, width, height, rgb565):
+    """PNG ohne Zusatzpakete (RGB, 8 Bit)"""
+    rows = bytearray()
+    for y in range(height):
+        rows.append(0)      # Filter: keiner
+        for value in rgb565[y * width:(y + 1) * width]:
+            rows.extend(rgb565_to_rgb888(value))
+
+    def chunk(kind, payload):
+        body = kind + payload
+        return struct.pack(">I", len(payload)) + body + struct.pack(">I", zlib.crc32(body) & 0xFFFFFFFF)
+
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 2, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(bytes(rows), 6)))
+        f.write(chunk(b"IEND", b""))
+
+
+class ScreenDecoder:
+    def __init__(self, out_dir, verbose=False):
+        self.out_dir = out_dir
+        self.verbose = verbose
+        self.width = 0
+        self.height = 0
+        self.pixels = []
+        self.frame = None
+        self.have_full = False
+        self.written = 0
+        self.dropped = 0
+
+    def feed(self, line):
+        """Eine Textzeile verarbeiten; gibt den PNG-Pfad zurück wenn ein Frame fertig ist"""
+        start = line.find("SCR ")
+        if start < 0:
+            return None
+        parts = line[start:].split()
+        try:
+            if parts[1] == "F":
+                self.begin_frame(int(parts[2]), int(parts[3]), int(parts[4]), parts[6] == "1")
+            elif parts[1] == "T":
+                self.tile(parts)
+            elif parts[1] == "E":
+                return self.end_frame(int(parts[2]), int(parts[3]))
+        except (IndexError, ValueError) as error:
+            self.dropped += 1
+            if self.verbose:
+                print("⚠️  Zeile verworfen: %s" % error, file=sys.stderr)
+        return None
+
+    def begin_frame(self, number, width, height, full):
+        if (width, height) != (self.width, self.height):
+            self.width, self.height = width, height
+            self.pixels = [0] * (width * height)
+            self.have_full = False
+        self.frame = number
+        if full:
+            self.have_full = True
+
+    def tile(self, parts):
+        if self.frame is None:
+            return
+        x, y, w, h = (int(v) for v in parts[2:6])
+        checksum = int(parts[6], 16)
+        data = base64.b64decode(parts[7], validate=True)
+        if zlib.adler32(data) != checksum:
+            raise ValueError("Adler-32 stimmt nicht (Kachel %d,%d)" % (x, y))
+        if x < 0 or y < 0 or x + w > self.width or y + h > self.height:
+            raise ValueError("Kachel außerhalb des Bildes")
+
+        tile = decode_rle(data, w * h)
+        for row in range(h):
+            offset = (y + row) * self.width + x
+            self.pixels[offset:offset + w] = tile[row * w:(row + 1) * w]
+
+    def end_frame(self, number, tiles):
+        if self.frame != number:
+            return None
+        self.frame = None
+        if not self.have_full:
+            # Differenz ohne vorheriges Vollbild → warten auf Keyframe
+            return None
+
+        path = os.path.join(self.out_dir, "screen_%05d.png" % number)
+        write_png(path, self.width, self.height, self.pixels)
+        self.written += 1
+        print("✅ Frame %d: %d Kacheln → %s" % (number, tiles, path))
+        return path
+
+
+def read_lines_serial(port, baud, command):
+    import serial   # pyserial
+
+    connection = serial.Serial(port, baud, timeout=0.2)
+    time.sleep(0.1)
+    connection.write((command + "\n").encode())
+    buffer = b""
+
+    def lines():
+        nonlocal buffer
+        while True:
+            buffer += connection.read(4096)
+            while b"\n" in buffer:
+                raw, buffer = buffer.split(b"\n", 1)
+                yield raw.decode("ascii", errors="replace")
+
+    return connection, lines()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decoder für den 'screen'-Befehl (RLE-Kacheln → PNG)")
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--port", help="Serieller Port, z.B. /dev/ttyACM0 oder COM5")
+    source.add_argument("--file", help="Mitschnitt der seriellen Ausgabe ('-' = stdin)")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--stream", type=int, metavar="MS", help="Stream starten (Frame-Intervall in ms)")
+    parser.add_argument("--once", action="store_true", help="Nach dem ersten vollständigen Frame beenden")
+    parser.add_argument("--out", default=".", help="Zielverzeichnis für PNGs")
+    parser.add_argument("--verbose", action="store_true", help="Verworfene Zeilen melden")
+    args = parser.parse_args()
+
+    os.makedirs(args.out, exist_ok=True)
+    decoder = ScreenDecoder(args.out, args.verbose)
+    connection = None
+
+    if args.port:
+        command = "screen stream %d" % args.stream if args.stream else "screen"
+        connection, lines = read_lines_serial(args.port, args.baud, command)
+    elif args.file == "-":
+        lines = sys.stdin
+    else:
+        lines = open(args.file, "r", encoding="ascii", errors="replace")
+
+    try:
+        for line in lines:
+            if decoder.feed(line) and args.once:
+                break
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if connection:
+            if args.stream:
+                connection.write(b"screen stop\n")
+            connection.close()
+
+    print("%d PNG geschrieben, %d Zeilen verworfen" % (decoder.written, decoder.dropped))
+
+
+if __name__ == "__main__":
+    main()